@@ -12,8 +12,10 @@
 // Implementation of class BilinearForm
 
 #include "fem.hpp"
+#include "../general/annotation.hpp"
 #include "../general/device.hpp"
 #include "../mesh/nurbs.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace mfem
@@ -23,13 +25,22 @@ void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
 
-   if (precompute_sparsity == 0 || fes->GetVDim() > 1)
+   if (precompute_sparsity == 0)
    {
       mat = new SparseMatrix(height);
       return;
    }
 
-   const Table &elem_dof = fes->GetElementToDofTable();
+   const int ndofs = fes->GetNDofs();
+   Table elem_dof(fes->GetElementToDofTable());
+   {
+      // remove the orientation signs, if any
+      int *J = elem_dof.GetJ();
+      for (int k = 0; k < elem_dof.Size_of_connections(); k++)
+      {
+         J[k] = UnsignIndex(J[k]);
+      }
+   }
    Table dof_dof;
 
    if (interior_face_integs.Size() > 0)
@@ -41,19 +52,75 @@ void BilinearForm::AllocMat()
          mfem::Mult(*face_elem, elem_dof, face_dof);
          delete face_elem;
       }
-      Transpose(face_dof, dof_face, height);
+      Transpose(face_dof, dof_face, ndofs);
       mfem::Mult(dof_face, face_dof, dof_dof);
    }
    else
    {
       // the sparsity pattern is defined from the map: element->dof
       Table dof_elem;
-      Transpose(elem_dof, dof_elem, height);
+      Transpose(elem_dof, dof_elem, ndofs);
       mfem::Mult(dof_elem, elem_dof, dof_dof);
    }
 
    dof_dof.SortRows();
 
+   const int vdim = fes->GetVDim();
+   if (vdim > 1)
+   {
+      // Expand the scalar pattern, assuming that all vector components are
+      // coupled. The column indices of each row remain sorted.
+      const int *dI = dof_dof.GetI();
+      const int *dJ = dof_dof.GetJ();
+      const bool by_nodes = (fes->GetOrdering() == Ordering::byNODES);
+
+      int *I = Memory<int>(height + 1);
+      int *J = Memory<int>(vdim*vdim*dI[ndofs]);
+      I[0] = 0;
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int i = 0; i < ndofs; i++)
+         {
+            const int row = by_nodes ? i + c*ndofs : c + i*vdim;
+            I[row + 1] = vdim*(dI[i + 1] - dI[i]);
+         }
+      }
+      for (int row = 0; row < height; row++) { I[row + 1] += I[row]; }
+      for (int c = 0; c < vdim; c++)
+      {
+         for (int i = 0; i < ndofs; i++)
+         {
+            const int row = by_nodes ? i + c*ndofs : c + i*vdim;
+            int *row_J = J + I[row];
+            if (by_nodes)
+            {
+               for (int cc = 0; cc < vdim; cc++)
+               {
+                  for (int k = dI[i]; k < dI[i + 1]; k++)
+                  {
+                     *(row_J++) = dJ[k] + cc*ndofs;
+                  }
+               }
+            }
+            else
+            {
+               for (int k = dI[i]; k < dI[i + 1]; k++)
+               {
+                  for (int cc = 0; cc < vdim; cc++)
+                  {
+                     *(row_J++) = cc + dJ[k]*vdim;
+                  }
+               }
+            }
+         }
+      }
+      real_t *data = Memory<real_t>(I[height]);
+
+      mat = new SparseMatrix(I, J, data, height, height, true, true, true);
+      *mat = 0.0;
+      return;
+   }
+
    int *I = dof_dof.GetI();
    int *J = dof_dof.GetJ();
    real_t *data = Memory<real_t>(I[height]);
@@ -72,6 +139,7 @@ BilinearForm::BilinearForm(FiniteElementSpace * f)
    mat = mat_e = NULL;
    extern_bfs = 0;
    precompute_sparsity = 0;
+   threaded_assembly = false;
    diag_policy = DIAG_KEEP;
 
    assembly = AssemblyLevel::LEGACY;
@@ -86,6 +154,7 @@ BilinearForm::BilinearForm (FiniteElementSpace * f, BilinearForm * bf, int ps)
    mat_e = NULL;
    extern_bfs = 1;
    precompute_sparsity = ps;
+   threaded_assembly = false;
    diag_policy = DIAG_KEEP;
 
    assembly = AssemblyLevel::LEGACY;
@@ -453,6 +522,92 @@ void BilinearForm::AssembleBdrElementMatrix(
    }
 }
 
+void BilinearForm::AssembleDomainThreaded()
+{
+   MFEM_ASSERT(mat && mat->Finalized(), "the sparsity must be precomputed");
+
+   const Mesh *mesh = fes->GetMesh();
+   const int NE = fes->GetNE();
+   const int *I = mat->HostReadI();
+   const int *J = mat->HostReadJ();
+   real_t *A = mat->HostReadWriteData();
+
+   for (int k = 0; k < domain_integs.Size(); k++)
+   {
+      if (domain_integs_marker[k]) { domain_integs_marker[k]->HostRead(); }
+   }
+
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+   #pragma omp parallel
+#endif
+   {
+      DenseMatrix el_mat, el_mat_k;
+      Array<int> el_vdofs;
+      DofTransformation doftrans;
+      IsoparametricTransformation eltrans;
+
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+      #pragma omp for schedule(static)
+#endif
+      for (int i = 0; i < NE; i++)
+      {
+         const int elem_attr = mesh->GetAttribute(i);
+         const FiniteElement &fe = *fes->GetFE(i);
+
+         el_mat.SetSize(0);
+         for (int k = 0; k < domain_integs.Size(); k++)
+         {
+            if (domain_integs_marker[k] == NULL ||
+                (*(domain_integs_marker[k]))[elem_attr-1] == 1)
+            {
+               if (el_mat.Size() == 0)
+               {
+                  fes->GetElementTransformation(i, &eltrans);
+               }
+               domain_integs[k]->AssembleElementMatrix(fe, eltrans, el_mat_k);
+               if (el_mat.Size() == 0)
+               {
+                  el_mat = el_mat_k;
+               }
+               else
+               {
+                  el_mat += el_mat_k;
+               }
+            }
+         }
+         if (el_mat.Size() == 0) { continue; }
+
+         fes->GetElementVDofs(i, el_vdofs, doftrans);
+         doftrans.TransformDual(el_mat);
+
+         // Add the element matrix to the sorted CSR rows; the zero entries are
+         // added too since they do not change the (precomputed) sparsity.
+         const int n = el_vdofs.Size();
+         for (int r = 0; r < n; r++)
+         {
+            int row = el_vdofs[r];
+            const real_t s = (row < 0) ? -1.0 : 1.0;
+            if (row < 0) { row = -1-row; }
+            const int *row_begin = J + I[row], *row_end = J + I[row+1];
+            for (int c = 0; c < n; c++)
+            {
+               int col = el_vdofs[c];
+               real_t a = s*el_mat(r, c);
+               if (col < 0) { col = -1-col; a = -a; }
+               const int *pos = std::lower_bound(row_begin, row_end, col);
+               MFEM_ASSERT(pos != row_end && *pos == col,
+                           "entry (" << row << ", " << col << ") is not in "
+                           "the precomputed sparsity pattern");
+#if defined(MFEM_USE_OPENMP) && defined(MFEM_THREAD_SAFE)
+               #pragma omp atomic
+#endif
+               A[pos - J] += a;
+            }
+         }
+      }
+   }
+}
+
 void BilinearForm::Assemble(int skip_zeros)
 {
    if (ext)
@@ -485,6 +640,7 @@ void BilinearForm::Assemble(int skip_zeros)
 
    if (domain_integs.Size())
    {
+      bool patchwise = false;
       for (int k = 0; k < domain_integs.Size(); k++)
       {
          if (domain_integs_marker[k] != NULL)
@@ -499,12 +655,20 @@ void BilinearForm::Assemble(int skip_zeros)
          {
             MFEM_VERIFY(fes->GetNURBSext(), "Patchwise integration requires a "
                         << "NURBS FE space");
+            patchwise = true;
          }
       }
 
+      // Element-wise integration, all elements are handled by the threaded
+      // assembly when it is used
+      const bool threaded = threaded_assembly && !patchwise && !static_cond &&
+                            !hybridization && !element_matrices &&
+                            mat->Finalized();
+      if (threaded) { AssembleDomainThreaded(); }
+      const int seq_ne = threaded ? 0 : fes->GetNE();
+
       DofTransformation doftrans;
-      // Element-wise integration
-      for (int i = 0; i < fes -> GetNE(); i++)
+      for (int i = 0; i < seq_ne; i++)
       {
          // Set both doftrans (potentially needed to assemble the element
          // matrix) and vdofs, which is also needed when the element matrices
@@ -1245,6 +1409,7 @@ void BilinearForm::EliminateVDofsInRHS(
 
 void BilinearForm::Mult(const Vector &x, Vector &y) const
 {
+   MFEM_PERF_SCOPE("BilinearForm::Mult");
    if (ext)
    {
       ext->Mult(x, y);
@@ -1257,6 +1422,7 @@ void BilinearForm::Mult(const Vector &x, Vector &y) const
 
 void BilinearForm::MultTranspose(const Vector & x, Vector & y) const
 {
+   MFEM_PERF_SCOPE("BilinearForm::MultTranspose");
    if (ext)
    {
       ext->MultTranspose(x, y);
@@ -1313,6 +1479,30 @@ void BilinearForm::SetDiagonalPolicy(DiagonalPolicy policy)
    diag_policy = policy;
 }
 
+MemoryReport BilinearForm::GetMemoryReport() const
+{
+   MemoryReport report("BilinearForm");
+   if (mat) { report.AddChild(mat->GetMemoryReport("mat")); }
+   if (mat_e) { report.AddChild(mat_e->GetMemoryReport("mat_e")); }
+   if (element_matrices)
+   {
+      report.Add("element_matrices", element_matrices->GetMemory());
+   }
+   if (ext) { report.AddChild(ext->GetMemoryReport()); }
+
+   MemoryReport integs("integrators");
+   for (const Array<BilinearFormIntegrator*> *list :
+        {&domain_integs, &boundary_integs, &interior_face_integs,
+         &boundary_face_integs})
+   {
+      for (const BilinearFormIntegrator *integ : *list)
+      {
+         integs.AddChild(integ->GetMemoryReport());
+      }
+   }
+   return report.AddChild(integs);
+}
+
 BilinearForm::~BilinearForm()
 {
    delete mat_e;
@@ -89,6 +89,11 @@ protected:
        Full Assembly (FA). */
    bool sort_sparse_matrix = false;
 
+   /** Indicates if the parallel system operator overlaps the exchange of the
+       shared dofs with the element computations when using Partial Assembly
+       (PA), see EnableCommunicationOverlap(). */
+   bool comm_overlap = false;
+
    /** @brief Indicates the Mesh::sequence corresponding to the current state of
        the BilinearForm. */
    long sequence;
@@ -134,9 +139,16 @@ protected:
 
    int precompute_sparsity;
 
+   /// Use the threaded element assembly, see UseThreadedAssembly().
+   bool threaded_assembly;
+
    /// Allocate appropriate SparseMatrix and assign it to #mat
    void AllocMat();
 
+   /** @brief Assemble the domain integrators into the finalized #mat using
+       OpenMP threads, see UseThreadedAssembly(). */
+   void AssembleDomainThreaded();
+
    /** @brief For partially conforming trial and/or test FE spaces, complete the
        assembly process by performing $ P^t A P $ where $ A $ is the
        internal sparse matrix and $ P $ is the conforming prolongation
@@ -150,6 +162,7 @@ protected:
       fes = NULL; sequence = -1;
       mat = mat_e = NULL; extern_bfs = 0;
       precompute_sparsity = 0;
+      threaded_assembly = false;
       diag_policy = DIAG_KEEP;
       assembly = AssemblyLevel::LEGACY;
       batch = 1;
@@ -209,6 +222,24 @@ public:
       sort_sparse_matrix = enable_it;
    }
 
+   /** @brief Overlap the exchange of the shared dofs with the element
+       computations in the parallel system operator, when using
+       AssemblyLevel::PARTIAL.
+
+       When enabled, FormSystemMatrix() and FormLinearSystem() of a
+       ParBilinearForm on a conforming space use a PAOverlapRAPOperator instead
+       of a RAPOperator, provided that all domain integrators support
+       BilinearFormIntegrator::AddMultPARange() and have no attribute markers.
+       Only the action of the prolongation is overlapped, not the reduction
+       of its transpose. Disabled by default. */
+   void EnableCommunicationOverlap(bool enable = true)
+   {
+      comm_overlap = enable;
+   }
+
+   /// Return true if EnableCommunicationOverlap() was enabled.
+   bool CommunicationOverlapIsEnabled() const { return comm_overlap; }
+
    /// Returns the assembly level
    AssemblyLevel GetAssemblyLevel() const { return assembly; }
 
@@ -236,11 +267,36 @@ public:
                             BilinearFormIntegrator *constr_integ,
                             const Array<int> &ess_tdof_list);
 
-   /** @brief For scalar FE spaces, precompute the sparsity pattern of the
-       matrix (assuming dense element matrices) based on the types of
-       integrators present in the bilinear form. */
+   /** @brief Precompute the sparsity pattern of the matrix (assuming dense
+       element matrices) based on the types of integrators present in the
+       bilinear form.
+
+       For vector FE spaces, all vector components are assumed to be coupled,
+       so the matrix stores explicit zeros for the uncoupled components. */
    void UsePrecomputedSparsity(int ps = 1) { precompute_sparsity = ps; }
 
+   /** @brief Enable the threaded assembly of the domain integrators.
+
+       The CSR sparsity pattern of the matrix is precomputed from the
+       element-to-dof Table (see UsePrecomputedSparsity()) and the element
+       matrices are computed and added to it concurrently, using atomic
+       updates, without going through the intermediate row-wise (LIL) format.
+       The threads are only used when MFEM is built with both MFEM_USE_OPENMP
+       and MFEM_THREAD_SAFE: without MFEM_THREAD_SAFE the integrators keep
+       their scratch data in members and cannot be shared between threads.
+       Otherwise the elements are processed sequentially, still skipping the
+       LIL stage. With threads, the coefficients used by the domain integrators
+       must also be thread-safe.
+
+       The standard sequential assembly is used when static condensation,
+       hybridization, pre-computed element matrices or patch-wise integrators
+       are present. This method should be called before assembly. */
+   void UseThreadedAssembly(bool enable = true)
+   {
+      threaded_assembly = enable;
+      if (enable) { precompute_sparsity = 1; }
+   }
+
    /** @brief Use the given CSR sparsity pattern to allocate the internal
        SparseMatrix.
 
@@ -731,6 +787,12 @@ public:
    /// Indicate that integrators are not owned by the BilinearForm
    void UseExternalIntegrators() { extern_bfs = 1; }
 
+   /** @brief Return a report of the memory held by the form: the assembled
+       matrices, the element matrices, the assembly level extension (e.g. the
+       E-vectors and the EA data) and the data of the integrators (e.g. the PA
+       data). The finite element space is not included. */
+   virtual MemoryReport GetMemoryReport() const;
+
    /** @brief Deletes internal matrices, bilinear integrators, and the
        BilinearFormExtension */
    virtual ~BilinearForm();
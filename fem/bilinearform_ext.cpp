@@ -108,6 +108,18 @@ void MFBilinearFormExtension::Update()
    bdr_face_restrict_lex = nullptr;
 }
 
+MemoryReport MFBilinearFormExtension::GetMemoryReport() const
+{
+   MemoryReport report("MFBilinearFormExtension");
+   MemoryReport evecs("E-vectors");
+   for (const Vector *v : {&localX, &localY, &int_face_X, &int_face_Y,
+                           &bdr_face_X, &bdr_face_Y})
+   {
+      evecs.Add(v->GetMemory());
+   }
+   return report.AddChild(evecs);
+}
+
 void MFBilinearFormExtension::FormSystemMatrix(const Array<int> &ess_tdof_list,
                                                OperatorHandle &A)
 {
@@ -251,6 +263,7 @@ PABilinearFormExtension::PABilinearFormExtension(BilinearForm *form)
    elem_restrict = NULL;
    int_face_restrict_lex = NULL;
    bdr_face_restrict_lex = NULL;
+   range_mult = false;
 }
 
 void PABilinearFormExtension::SetupRestrictionOperators(const L2FaceValues m)
@@ -365,18 +378,28 @@ void PABilinearFormExtension::Assemble()
    {
       integ->AssemblePABoundaryFaces(*a->FESpace());
    }
+
+   // The domain integrators can be applied to ranges of elements if they all
+   // support it, without attribute markers.
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   range_mult = !DeviceCanUseCeed() && integrators.Size() > 0 &&
+                dynamic_cast<const ElementRestriction*>(elem_restrict);
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      range_mult = range_mult && !integrators[i]->Patchwise() &&
+                   integrators[i]->SupportsAddMultPARange() &&
+                   elem_markers[i] == nullptr;
+   }
 }
 
 void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
 
-   auto assemble_diagonal_with_markers = [&](BilinearFormIntegrator &integ,
-                                             const Array<int> *markers,
-                                             const Array<int> &attributes,
-                                             Vector &d)
+   auto apply_markers = [&](const Array<int> *markers,
+                            const Array<int> &attributes,
+                            Vector &d)
    {
-      integ.AssembleDiagonalPA(d);
       if (markers)
       {
          const int ne = attributes.Size();
@@ -398,6 +421,15 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
       }
    };
 
+   auto assemble_diagonal_with_markers = [&](BilinearFormIntegrator &integ,
+                                             const Array<int> *markers,
+                                             const Array<int> &attributes,
+                                             Vector &d)
+   {
+      integ.AssembleDiagonalPA(d);
+      apply_markers(markers, attributes, d);
+   };
+
    const int iSz = integrators.Size();
    if (elem_restrict && !DeviceCanUseCeed())
    {
@@ -451,6 +483,63 @@ void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
       }
       bdr_face_restrict_lex->AddAbsMultTranspose(bdr_face_Y, y);
    }
+
+   // The face integrators without a face diagonal kernel are skipped, i.e.
+   // their contribution to the diagonal is omitted.
+   auto warn_no_face_diagonal = [](const BilinearFormIntegrator &integ)
+   {
+      if (!integ.SupportsFaceDiagonalPA())
+      {
+         MFEM_WARNING("The face integrator does not support the diagonal "
+                      "assembly: its contribution to the diagonal is omitted.");
+         return true;
+      }
+      return false;
+   };
+
+   Array<BilinearFormIntegrator*> &int_face_integs = *a->GetFBFI();
+   if (int_face_restrict_lex && int_face_integs.Size() > 0)
+   {
+      MFEM_VERIFY(dynamic_cast<const L2FaceRestriction*>(int_face_restrict_lex),
+                  "Only L2 spaces are supported with face integrators.");
+      int_face_Y = 0.0;
+      bool has_diagonal = false;
+      for (int i = 0; i < int_face_integs.Size(); ++i)
+      {
+         if (warn_no_face_diagonal(*int_face_integs[i])) { continue; }
+         int_face_integs[i]->AssembleDiagonalPAFaces(int_face_Y);
+         has_diagonal = true;
+      }
+      if (has_diagonal)
+      {
+         int_face_restrict_lex->AddMultTranspose(int_face_Y, y);
+      }
+   }
+
+   Array<BilinearFormIntegrator*> &bdr_face_integs = *a->GetBFBFI();
+   if (bdr_face_restrict_lex && bdr_face_integs.Size() > 0)
+   {
+      MFEM_VERIFY(dynamic_cast<const L2FaceRestriction*>(bdr_face_restrict_lex),
+                  "Only L2 spaces are supported with face integrators.");
+      Array<Array<int>*> &bdr_face_markers = *a->GetBFBFI_Marker();
+      Vector d_face(bdr_face_Y.Size());
+      d_face.UseDevice(true);
+      bdr_face_Y = 0.0;
+      bool has_diagonal = false;
+      for (int i = 0; i < bdr_face_integs.Size(); ++i)
+      {
+         if (warn_no_face_diagonal(*bdr_face_integs[i])) { continue; }
+         d_face = 0.0;
+         bdr_face_integs[i]->AssembleDiagonalPAFaces(d_face);
+         apply_markers(bdr_face_markers[i], *bdr_face_attributes, d_face);
+         bdr_face_Y += d_face;
+         has_diagonal = true;
+      }
+      if (has_diagonal)
+      {
+         bdr_face_restrict_lex->AddMultTranspose(bdr_face_Y, y);
+      }
+   }
 }
 
 void PABilinearFormExtension::Update()
@@ -465,9 +554,28 @@ void PABilinearFormExtension::Update()
    bdr_face_restrict_lex = nullptr;
 }
 
+MemoryReport PABilinearFormExtension::GetMemoryReport() const
+{
+   MemoryReport report("PABilinearFormExtension");
+   MemoryReport evecs("E-vectors");
+   for (const Vector *v : {&tmp_evec, &localX, &localY, &int_face_X,
+                           &int_face_Y, &bdr_face_X, &bdr_face_Y,
+                           &int_face_dXdn, &int_face_dYdn, &bdr_face_dXdn,
+                           &bdr_face_dYdn})
+   {
+      evecs.Add(v->GetMemory());
+   }
+   return report.AddChild(evecs);
+}
+
 void PABilinearFormExtension::FormSystemMatrix(const Array<int> &ess_tdof_list,
                                                OperatorHandle &A)
 {
+   if (Operator *rap = NewOverlapRAP())
+   {
+      A.Reset(new ConstrainedOperator(rap, ess_tdof_list, true));
+      return;
+   }
    Operator *oper;
    Operator::FormSystemOperator(ess_tdof_list, oper);
    A.Reset(oper); // A will own oper
@@ -479,6 +587,17 @@ void PABilinearFormExtension::FormLinearSystem(const Array<int> &ess_tdof_list,
                                                Vector &X, Vector &B,
                                                int copy_interior)
 {
+   if (Operator *rap = NewOverlapRAP())
+   {
+      // Same as Operator::FormLinearSystem() with the overlapping operator
+      const Operator *P = GetProlongation();
+      InitTVectors(P, GetRestriction(), P, x, b, X, B);
+      if (!copy_interior) { X.SetSubVectorComplement(ess_tdof_list, 0.0); }
+      auto *constrained = new ConstrainedOperator(rap, ess_tdof_list, true);
+      constrained->EliminateRHS(X, B);
+      A.Reset(constrained);
+      return;
+   }
    Operator *oper;
    Operator::FormLinearSystem(ess_tdof_list, x, b, oper, X, B, copy_interior);
    A.Reset(oper); // A will own oper
@@ -563,6 +682,12 @@ void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
       }
    }
 
+   AddMultFaces(x, y, useAbs);
+}
+
+void PABilinearFormExtension::AddMultFaces(const Vector &x, Vector &y,
+                                           const bool useAbs) const
+{
    Array<BilinearFormIntegrator*> &intFaceIntegrators = *a->GetFBFI();
    const int iFISz = intFaceIntegrators.Size();
    if (int_face_restrict_lex && iFISz>0)
@@ -846,6 +971,130 @@ void PABilinearFormExtension::AddMultWithMarkers(
    }
 }
 
+Operator *PABilinearFormExtension::NewOverlapRAP() const
+{
+#ifdef MFEM_USE_MPI
+   if (range_mult && a->CommunicationOverlapIsEnabled())
+   {
+      auto P = dynamic_cast<const ConformingProlongationOperator*>(
+                  GetProlongation());
+      if (P) { return new PAOverlapRAPOperator(*this, *P); }
+   }
+#endif
+   return nullptr;
+}
+
+#ifdef MFEM_USE_MPI
+PAOverlapRAPOperator::PAOverlapRAPOperator(
+   const PABilinearFormExtension &ext_, const ConformingProlongationOperator &P_)
+   : Operator(P_.Width()), ext(ext_), P(P_)
+{
+   MFEM_VERIFY(ext.range_mult, "the integrators do not support element ranges");
+   const FiniteElementSpace &fes = *ext.trial_fes;
+   const int ne = fes.GetNE();
+   const int vdim = fes.GetVDim();
+
+   Array<bool> external(P.Height());
+   external = false;
+   for (int ldof : P.GetExternalLDofs()) { external[ldof] = true; }
+
+   // Mark the halo elements, the ones that touch an external ldof
+   const ElementRestriction &R =
+      static_cast<const ElementRestriction&>(*ext.elem_restrict);
+   const int *gather_map = R.GatherMap().HostRead();
+   const int nd = (ne > 0) ? R.GatherMap().Size() / ne : 0;
+   Array<bool> halo(ne);
+   for (int e = 0; e < ne; e++)
+   {
+      bool touches = false;
+      for (int i = 0; i < nd; i++)
+      {
+         const int gid = gather_map[i + e*nd];
+         const int j = (gid >= 0) ? gid : -1-gid;
+         for (int c = 0; c < vdim; c++)
+         {
+            touches = touches || external[fes.DofToVDof(j, c)];
+         }
+      }
+      halo[e] = touches;
+   }
+
+   // Group the elements into contiguous ranges. Short runs of interior
+   // elements are added to the halo ranges to limit the number of kernel
+   // launches.
+   const int min_interior_run = 16;
+   for (int e = 0; e < ne; )
+   {
+      int e_end = e + 1;
+      while (e_end < ne && halo[e_end] == halo[e]) { e_end++; }
+      const bool interior = !halo[e] && (e_end - e >= min_interior_run);
+      Array<int> &ranges = interior ? interior_ranges : halo_ranges;
+      const int n = ranges.Size();
+      if (n > 0 && ranges[n-1] == e) { ranges[n-1] = e_end; }
+      else { ranges.Append(e); ranges.Append(e_end); }
+      e = e_end;
+   }
+
+   mem_class = P.GetMemoryClass();
+   MemoryType mem_type = GetMemoryType(ext.GetMemoryClass()*mem_class);
+   Px.SetSize(P.Height(), mem_type);
+   APx.SetSize(P.Height(), mem_type);
+}
+
+void PAOverlapRAPOperator::AddMultRanges(const Array<int> &ranges) const
+{
+   const ElementRestriction &R =
+      static_cast<const ElementRestriction&>(*ext.elem_restrict);
+   Array<BilinearFormIntegrator*> &integrators = *ext.a->GetDBFI();
+   for (int r = 0; r < ranges.Size(); r += 2)
+   {
+      const int e_begin = ranges[r], e_end = ranges[r+1];
+      R.MultRange(Px, ext.localX, e_begin, e_end);
+      for (BilinearFormIntegrator *integ : integrators)
+      {
+         integ->AddMultPARange(ext.localX, ext.localY, e_begin, e_end);
+      }
+   }
+}
+
+void PAOverlapRAPOperator::Mult(const Vector &x, Vector &y) const
+{
+   P.MultBegin(x, Px);
+   ext.localY = 0.0;
+   AddMultRanges(interior_ranges);
+   P.MultEnd(Px);
+   AddMultRanges(halo_ranges);
+   ext.elem_restrict->MultTranspose(ext.localY, APx);
+   ext.AddMultFaces(Px, APx);
+   // The reduction of P^T has no local work to overlap with
+   P.MultTransposeBegin(APx, y);
+   P.MultTransposeEnd(y);
+}
+
+void PAOverlapRAPOperator::AbsMult(const Vector &x, Vector &y) const
+{
+   P.Mult(x, Px);
+   ext.AbsMult(Px, APx);
+   P.MultTranspose(APx, y);
+}
+
+void PAOverlapRAPOperator::AssembleDiagonal(Vector &diag) const
+{
+   ext.AssembleDiagonal(APx);
+   P.MultTranspose(APx, diag);
+}
+
+int PAOverlapRAPOperator::GetNumInteriorElements() const
+{
+   int n = 0;
+   for (int r = 0; r < interior_ranges.Size(); r += 2)
+   {
+      n += interior_ranges[r+1] - interior_ranges[r];
+   }
+   return n;
+}
+#endif
+
 // Data and methods for element-assembled bilinear forms
 EABilinearFormExtension::EABilinearFormExtension(BilinearForm *form)
    : PABilinearFormExtension(form),
@@ -857,6 +1106,17 @@ EABilinearFormExtension::EABilinearFormExtension(BilinearForm *form)
    }
 }
 
+MemoryReport EABilinearFormExtension::GetMemoryReport() const
+{
+   MemoryReport report = PABilinearFormExtension::GetMemoryReport();
+   MemoryReport ea("EABilinearFormExtension");
+   ea.Add("ea_data", ea_data.GetMemory());
+   ea.Add("ea_data_int", ea_data_int.GetMemory());
+   ea.Add("ea_data_ext", ea_data_ext.GetMemory());
+   ea.Add("ea_data_bdr", ea_data_bdr.GetMemory());
+   return ea.AddChild(report);
+}
+
 void EABilinearFormExtension::Assemble()
 {
    SetupRestrictionOperators(L2FaceValues::SingleValued);
@@ -22,6 +22,9 @@ namespace mfem
 class BilinearForm;
 class MixedBilinearForm;
 class DiscreteLinearOperator;
+#ifdef MFEM_USE_MPI
+class ConformingProlongationOperator;
+#endif
 
 /// Class extending the BilinearForm class to support different AssemblyLevels.
 /**  FA - Full Assembly
@@ -61,6 +64,10 @@ public:
                                  OperatorHandle &A, Vector &X, Vector &B,
                                  int copy_interior = 0) = 0;
    virtual void Update() = 0;
+
+   /// Return a report of the memory held by the extension.
+   virtual MemoryReport GetMemoryReport() const
+   { return MemoryReport("BilinearFormExtension"); }
 };
 
 /// Data and methods for partially-assembled bilinear forms
@@ -80,6 +87,13 @@ protected:
    const Operator *elem_restrict; // Not owned
    const FaceRestriction *int_face_restrict_lex; // Not owned
    const FaceRestriction *bdr_face_restrict_lex; // Not owned
+   /// True if the domain integrators can be applied to ranges of elements,
+   /// see BilinearFormIntegrator::AddMultPARange().
+   bool range_mult;
+
+#ifdef MFEM_USE_MPI
+   friend class PAOverlapRAPOperator;
+#endif
 
 public:
    PABilinearFormExtension(BilinearForm*);
@@ -99,11 +113,24 @@ public:
    void MultTranspose(const Vector &x, Vector &y) const override;
    void Update() override;
 
+   MemoryReport GetMemoryReport() const override;
+
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
    void MultInternal(const Vector &x, Vector &y,
                      const bool useAbs = false) const;
 
+   /// Add the action of the interior face, boundary and boundary face
+   /// integrators on the L-vector @a x to the L-vector @a y.
+   void AddMultFaces(const Vector &x, Vector &y,
+                     const bool useAbs = false) const;
+
+   /** @brief Return a new PAOverlapRAPOperator for the conforming parallel
+       prolongation, or NULL if the overlap is not enabled (see
+       BilinearForm::EnableCommunicationOverlap()) or not supported by the
+       domain integrators, see range_mult. */
+   Operator *NewOverlapRAP() const;
+
    /// @brief Accumulate the action (or transpose) of the integrator on @a x
    /// into @a y, taking into account the (possibly null) @a markers array.
    ///
@@ -143,6 +170,47 @@ protected:
       Vector &dydn) const;
 };
 
+#ifdef MFEM_USE_MPI
+/** @brief The action $P^T A P$ of a partially assembled bilinear form $A$ on a
+    conforming parallel space, overlapping the exchange of the shared dofs with
+    the element computations.
+
+    The elements are split into contiguous ranges of interior elements, which
+    touch no external (not owned) dofs, and of halo elements. Mult() starts the
+    exchange of $P x$, applies the domain integrators on the interior elements,
+    completes the exchange and then applies them on the halo elements. */
+class PAOverlapRAPOperator : public Operator
+{
+protected:
+   const PABilinearFormExtension &ext;
+   const ConformingProlongationOperator &P;
+   /// The element ranges [ranges[2i], ranges[2i+1]).
+   Array<int> interior_ranges, halo_ranges;
+   mutable Vector Px, APx;
+   MemoryClass mem_class;
+
+   /// Apply the domain integrators to the elements in @a ranges.
+   void AddMultRanges(const Array<int> &ranges) const;
+
+public:
+   PAOverlapRAPOperator(const PABilinearFormExtension &ext,
+                        const ConformingProlongationOperator &P);
+
+   MemoryClass GetMemoryClass() const override { return mem_class; }
+
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// Same as RAPOperator::AbsMult(), without overlap.
+   void AbsMult(const Vector &x, Vector &y) const override;
+
+   /// Same as RAPOperator::AssembleDiagonal().
+   void AssembleDiagonal(Vector &diag) const override;
+
+   /// Return the number of interior elements.
+   int GetNumInteriorElements() const;
+};
+#endif
+
 /// Data and methods for element-assembled bilinear forms
 class EABilinearFormExtension : public PABilinearFormExtension
 {
@@ -161,6 +229,8 @@ public:
 
    void Assemble() override;
 
+   MemoryReport GetMemoryReport() const override;
+
    void Mult(const Vector &x, Vector &y) const override
    { MultInternal(x, y, false); }
    void AbsMult(const Vector &x, Vector &y) const override
@@ -242,6 +312,8 @@ public:
    void Mult(const Vector &x, Vector &y) const override;
    void MultTranspose(const Vector &x, Vector &y) const override;
    void Update() override;
+
+   MemoryReport GetMemoryReport() const override;
 };
 
 /// Class extending the MixedBilinearForm class to support different AssemblyLevels.
@@ -12,6 +12,7 @@
 // Implementation of Bilinear Form Integrators
 
 #include "fem.hpp"
+#include "../general/forall.hpp"
 #include <cmath>
 #include <algorithm>
 #include <memory>
@@ -115,6 +116,82 @@ void BilinearFormIntegrator::AssembleDiagonalPA_ADAt(const Vector &, Vector &)
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AssembleDiagonalPAFaces(Vector &)
+{
+   MFEM_ABORT("BilinearFormIntegrator::AssembleDiagonalPAFaces(...)\n"
+              "   is not implemented for this class.");
+}
+
+void BilinearFormIntegrator::ProbeDiagonalPA(const int ne, Vector &diag) const
+{
+   MFEM_VERIFY(probe_diagonal, "This integrator has no specialized PA diagonal"
+               " kernel; call EnableDiagonalProbing() to compute the diagonal"
+               " with one operator application per element dof.");
+   if (ne == 0) { return; }
+   const int nd = diag.Size() / ne;
+   MFEM_VERIFY(nd*ne == diag.Size(), "Invalid E-vector size.");
+
+   Vector x(diag.Size()), y(diag.Size());
+   x.UseDevice(true);
+   y.UseDevice(true);
+   x = 0.0;
+   for (int i = 0; i < nd; i++)
+   {
+      // Set the i-th local dof to one in all elements
+      auto X = Reshape(x.ReadWrite(), nd, ne);
+      mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
+      {
+         if (i > 0) { X(i-1,e) = 0.0; }
+         X(i,e) = 1.0;
+      });
+      y = 0.0;
+      AddMultPA(x, y);
+      const auto Y = Reshape(y.Read(), nd, ne);
+      auto D = Reshape(diag.ReadWrite(), nd, ne);
+      mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e) { D(i,e) += Y(i,e); });
+   }
+}
+
+void BilinearFormIntegrator::ProbeDiagonalPA_ADAt(const int ne,
+                                                  const Vector &D,
+                                                  Vector &diag) const
+{
+   MFEM_VERIFY(probe_diagonal, "This integrator has no specialized PA diagonal"
+               " kernel; call EnableDiagonalProbing() to compute the diagonal"
+               " with one operator application per element dof.");
+   if (ne == 0) { return; }
+   const int trial_nd = D.Size() / ne;
+   const int test_nd = diag.Size() / ne;
+   MFEM_VERIFY(trial_nd*ne == D.Size() && test_nd*ne == diag.Size(),
+               "Invalid E-vector size.");
+
+   Vector x(D.Size()), y(diag.Size());
+   x.UseDevice(true);
+   y.UseDevice(true);
+   x = 0.0;
+   for (int i = 0; i < trial_nd; i++)
+   {
+      // Set the i-th local trial dof to one in all elements
+      auto X = Reshape(x.ReadWrite(), trial_nd, ne);
+      mfem::forall(ne, [=] MFEM_HOST_DEVICE (int e)
+      {
+         if (i > 0) { X(i-1,e) = 0.0; }
+         X(i,e) = 1.0;
+      });
+      y = 0.0;
+      AddMultPA(x, y);
+      // y now holds the i-th column of the element matrices
+      const auto Y = Reshape(y.Read(), test_nd, ne);
+      const auto DD = Reshape(D.Read(), trial_nd, ne);
+      auto d = Reshape(diag.ReadWrite(), test_nd, ne);
+      mfem::forall(test_nd*ne, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int j = idx % test_nd, e = idx / test_nd;
+         d(j,e) += DD(i,e) * Y(j,e) * Y(j,e);
+      });
+   }
+}
+
 void BilinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator:AddMultPA:(...)\n"
@@ -127,6 +204,13 @@ void BilinearFormIntegrator::AddAbsMultPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultPARange(const Vector &, Vector &, int,
+                                            int) const
+{
+   MFEM_ABORT("BilinearFormIntegrator::AddMultPARange(...)\n"
+              "   is not implemented for this class.");
+}
+
 void BilinearFormIntegrator::AddMultNURBSPA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator::AddMultNURBSPA(...)\n"
@@ -431,6 +515,16 @@ void SumIntegrator::AddMultPA(const Vector& x, Vector& y) const
    }
 }
 
+MemoryReport SumIntegrator::GetMemoryReport() const
+{
+   MemoryReport report("SumIntegrator");
+   for (int i = 0; i < integrators.Size(); i++)
+   {
+      report.AddChild(integrators[i]->GetMemoryReport());
+   }
+   return report;
+}
+
 void SumIntegrator::AddAbsMultPA(const Vector& x, Vector& y) const
 {
    for (int i = 0; i < integrators.Size(); i++)
@@ -71,6 +71,29 @@ public:
    /// Assemble diagonal of $A D A^T$ ($A$ is this integrator) and add it to @a diag.
    virtual void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag);
 
+   /** @brief Allow AssembleDiagonalPA() and AssembleDiagonalPA_ADAt() to be
+       computed by probing the partially assembled operator, for the
+       integrators that do not have a specialized diagonal kernel.
+
+       Probing requires one application of the element operator per local dof,
+       i.e. its cost is O(ndof) times the cost of AddMultPA(), so it is
+       disabled by default and the integrators relying on it abort. */
+   virtual void EnableDiagonalProbing(bool enable = true)
+   { probe_diagonal = enable; }
+
+   /** @brief Return true if the integrator implements
+       AssembleDiagonalPAFaces(), i.e. the diagonal of its partially assembled
+       face operator. */
+   virtual bool SupportsFaceDiagonalPA() const { return false; }
+
+   /** @brief Assemble the diagonal of the partially assembled face operator
+       and add it to the face E-vector @a diag.
+
+       The faces are the ones given to AssemblePAInteriorFaces() or
+       AssemblePABoundaryFaces(), and @a diag has the layout of the
+       corresponding FaceRestriction with L2FaceValues::DoubleValued. */
+   virtual void AssembleDiagonalPAFaces(Vector &diag);
+
    /// Method for partially assembled action.
    /** Perform the action of integrator on the input @a x and add the result to
        the output @a y. Both @a x and @a y are E-vectors, i.e. they represent
@@ -82,6 +105,19 @@ public:
 
    virtual void AddAbsMultPA(const Vector &x, Vector &y) const;
 
+   /// Method for partially assembled action on a range of elements.
+   /** Same as AddMultPA(), restricted to the elements in the range
+       [@a e_begin, @a e_end). The E-vectors @a x and @a y cover all the
+       elements, only the entries of the elements in the range are used.
+
+       This method can be called only after the method AssemblePA() has been
+       called, and only if SupportsAddMultPARange() returns true. */
+   virtual void AddMultPARange(const Vector &x, Vector &y, int e_begin,
+                               int e_end) const;
+
+   /// Return true if the integrator implements AddMultPARange().
+   virtual bool SupportsAddMultPARange() const { return false; }
+
    /// Method for partially assembled action on NURBS patches.
    virtual void AddMultNURBSPA(const Vector&x, Vector&y) const;
 
@@ -328,7 +364,40 @@ public:
    virtual void AddMultPAFaceNormalDerivatives(const Vector &x, const Vector &dxdn,
                                                Vector &y, Vector &dydn) const;
 
+   /** @brief Return a report of the memory held by the integrator, e.g. its
+       partially assembled data. The default implementation reports nothing. */
+   virtual MemoryReport GetMemoryReport() const
+   { return MemoryReport("BilinearFormIntegrator"); }
+
    virtual ~BilinearFormIntegrator() { }
+
+protected:
+   /// Whether ProbeDiagonalPA() and ProbeDiagonalPA_ADAt() may be used.
+   bool probe_diagonal = false;
+
+   /// Return a report named @a name with the partially assembled @a pa_data.
+   static MemoryReport PADataMemoryReport(const std::string &name,
+                                          const Vector &pa_data)
+   { return MemoryReport(name).Add("pa_data", pa_data.GetMemory()); }
+
+   /** @brief Compute the diagonal of the partially assembled element matrices
+       of a square integrator by applying AddMultPA() to the unit vectors of
+       the local element dofs, and add it to the E-vector @a diag.
+
+       The number of dofs per element is deduced from the size of @a diag and
+       the number of elements @a ne. This requires one application of the
+       operator per local dof, and is used by integrators that do not provide
+       a specialized diagonal kernel, if EnableDiagonalProbing() was called. */
+   void ProbeDiagonalPA(const int ne, Vector &diag) const;
+
+   /** @brief Compute the diagonal of $A D A^T$, where $A$ is the partially
+       assembled (mixed) element operator, by applying AddMultPA() to the unit
+       vectors of the local trial dofs, and add it to the test E-vector
+       @a diag. The trial E-vector @a D holds the diagonal $D$.
+
+       The result is exact when the test space is discontinuous; otherwise the
+       element contributions of shared test dofs are summed. */
+   void ProbeDiagonalPA_ADAt(const int ne, const Vector &D, Vector &diag) const;
 };
 
 /** Wraps a given @a BilinearFormIntegrator and transposes the resulting element
@@ -390,6 +459,18 @@ public:
       bfi->AssemblePABoundaryFaces(fes);
    }
 
+   /// The diagonal of the transpose is the diagonal of the wrapped integrator.
+   void AssembleDiagonalPA(Vector &diag) override
+   {
+      bfi->AssembleDiagonalPA(diag);
+   }
+
+   void EnableDiagonalProbing(bool enable = true) override
+   {
+      BilinearFormIntegrator::EnableDiagonalProbing(enable);
+      bfi->EnableDiagonalProbing(enable);
+   }
+
    void AddMultTransposePA(const Vector &x, Vector &y) const override
    {
       bfi->AddMultPA(x, y);
@@ -400,6 +481,11 @@ public:
       bfi->AddMultTransposePA(x, y);
    }
 
+   MemoryReport GetMemoryReport() const override
+   {
+      return MemoryReport("TransposeIntegrator").AddChild(bfi->GetMemoryReport());
+   }
+
    void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                    const bool add) override;
 
@@ -496,6 +582,15 @@ public:
 
    void AssembleDiagonalPA(Vector &diag) override;
 
+   void EnableDiagonalProbing(bool enable = true) override
+   {
+      BilinearFormIntegrator::EnableDiagonalProbing(enable);
+      for (int i = 0; i < integrators.Size(); i++)
+      {
+         integrators[i]->EnableDiagonalProbing(enable);
+      }
+   }
+
    void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
 
    void AssemblePABoundaryFaces(const FiniteElementSpace &fes) override;
@@ -508,6 +603,8 @@ public:
 
    void AddAbsMultPA(const Vector& x, Vector& y) const override;
 
+   MemoryReport GetMemoryReport() const override;
+
    void AssembleMF(const FiniteElementSpace &fes) override;
 
    void AddMultMF(const Vector &x, Vector &y) const override;
@@ -532,6 +629,95 @@ public:
    virtual ~SumIntegrator();
 };
 
+/** @brief Sum-factorized partial assembly of the mixed bilinear forms
+    $(D\, \mathcal{A} u, \mathcal{B} v)$ between scalar $H^1$ or $L_2$ spaces
+    on tensor-product elements, where each of $\mathcal{A}$ and $\mathcal{B}$ is
+    either the identity or the gradient and $D$ is the scalar, vector, or
+    matrix quadrature point data.
+
+    This class is used by the partial assembly of MixedScalarMassIntegrator,
+    MixedScalarDerivativeIntegrator, MixedScalarWeakDerivativeIntegrator,
+    MixedDirectionalDerivativeIntegrator, MixedScalarWeakDivergenceIntegrator
+    and MixedGradGradIntegrator.
+
+    The mixed integrators with an H(curl) or H(div) trial or test space, e.g.
+    MixedDotProductIntegrator, MixedCrossProductIntegrator and
+    MixedGradDivIntegrator, are not covered: each vector component of these
+    elements uses a different combination of the open and closed 1D bases, so
+    they need the kernels of the vector FE integrators (see
+    MixedVectorGradientIntegrator and VectorFEDivergenceIntegrator). */
+class MixedScalarPAOperator
+{
+protected:
+   bool trial_grad, test_grad;
+   int dim, ne, trial_d1d, test_d1d, quad1D;
+   const DofToQuad *trial_maps;  ///< Not owned
+   const DofToQuad *test_maps;   ///< Not owned
+   Vector pa_data;
+
+public:
+   MixedScalarPAOperator()
+      : trial_grad(false), test_grad(false), dim(0), ne(0), trial_d1d(0),
+        test_d1d(0), quad1D(0), trial_maps(NULL), test_maps(NULL) { }
+
+   /// Return the number of elements in the last call to Setup().
+   int GetNE() const { return ne; }
+
+   /// Return a report named @a name with the partially assembled data.
+   MemoryReport GetMemoryReport(const std::string &name) const
+   { return MemoryReport(name).Add("pa_data", pa_data.GetMemory()); }
+
+   /** @brief Compute the quadrature point data for the trial and test spaces
+       @a trial_fes and @a test_fes and the integration rule @a ir.
+
+       If @a trial_grad (@a test_grad) is true, the gradient of the trial
+       (test) functions is used, otherwise their value. The coefficient @a
+       coeff must be scalar when neither gradient is used and vector-valued
+       when exactly one of them is used; when both gradients are used, it can
+       be a scalar, a diagonal matrix (vector), or a full matrix coefficient.
+       The quadrature point data is scaled by @a alpha. */
+   void Setup(const FiniteElementSpace &trial_fes,
+              const FiniteElementSpace &test_fes, const IntegrationRule &ir,
+              bool trial_grad, bool test_grad, CoefficientVector &coeff,
+              real_t alpha = 1.0);
+
+   /// Compute y += A x, using E-vectors in lexicographic ordering.
+   void AddMult(const Vector &x, Vector &y) const;
+
+   /// Compute y += A^T x, using E-vectors in lexicographic ordering.
+   void AddMultTranspose(const Vector &x, Vector &y) const;
+
+   /// arguments: NE, B_in, G_in, B_out, G_out, pa_data, transpose, x, y,
+   /// D1D_in, D1D_out, Q1D
+   using ApplyKernelType = void (*)(const int, const Array<real_t> &,
+                                    const Array<real_t> &,
+                                    const Array<real_t> &,
+                                    const Array<real_t> &, const Vector &,
+                                    const bool, const Vector &, Vector &,
+                                    const int, const int, const int);
+
+   /// arguments: DIM, GRAD_IN, GRAD_OUT, D1D_IN, D1D_OUT, Q1D
+   MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType,
+                         (int, int, int, int, int, int));
+
+   /// Register the kernels for all value/gradient combinations, in both
+   /// directions, for the given numbers of 1D trial and test dofs.
+   template <int DIM, int D1D_TRIAL, int D1D_TEST, int Q1D>
+   static void AddSpecialization()
+   {
+      ApplyPAKernels::Specialization<DIM,0,0,D1D_TRIAL,D1D_TEST,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,1,0,D1D_TRIAL,D1D_TEST,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,0,1,D1D_TRIAL,D1D_TEST,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,1,1,D1D_TRIAL,D1D_TEST,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,0,0,D1D_TEST,D1D_TRIAL,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,1,0,D1D_TEST,D1D_TRIAL,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,0,1,D1D_TEST,D1D_TRIAL,Q1D>::Add();
+      ApplyPAKernels::Specialization<DIM,1,1,D1D_TEST,D1D_TRIAL,Q1D>::Add();
+   }
+
+   struct Kernels { Kernels(); };
+};
+
 /** An abstract class for integrating the product of two scalar basis functions
     with an optional scalar coefficient. */
 class MixedScalarIntegrator: public BilinearFormIntegrator
@@ -780,13 +966,27 @@ private:
 
 /** Class for integrating the bilinear form $a(u,v) := (Q u, v)$ in either 1D, 2D,
     or 3D and where $Q$ is an optional scalar coefficient, $u$ and $v$ are each in $H^1$
-    or $L_2$. */
+    or $L_2$. Partial assembly (PA) is supported on tensor-product elements. */
 class MixedScalarMassIntegrator : public MixedScalarIntegrator
 {
 public:
    MixedScalarMassIntegrator() { same_calc_shape = true; }
    MixedScalarMassIntegrator(Coefficient &q)
       : MixedScalarIntegrator(q) { same_calc_shape = true; }
+
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedScalarMassIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
+protected:
+   MixedScalarPAOperator pa_op;
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (\vec{V} u, v)$ in either 2D, or
@@ -800,7 +1000,8 @@ public:
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (Q \nabla u, v)$ in 1D where Q
-    is an optional scalar coefficient, $u$ is in $H^1$, and $v$ is in $L_2$. */
+    is an optional scalar coefficient, $u$ is in $H^1$, and $v$ is in $L_2$.
+    Partial assembly (PA) is supported. */
 class MixedScalarDerivativeIntegrator : public MixedScalarIntegrator
 {
 public:
@@ -808,7 +1009,20 @@ public:
    MixedScalarDerivativeIntegrator(Coefficient &q)
       : MixedScalarIntegrator(q) {}
 
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedScalarDerivativeIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
 protected:
+   MixedScalarPAOperator pa_op;
+
    inline virtual bool VerifyFiniteElementTypes(
       const FiniteElement & trial_fe,
       const FiniteElement & test_fe) const
@@ -835,7 +1049,8 @@ protected:
 };
 
 /** Class for integrating the bilinear form $a(u,v) := -(Q u, \nabla v)$ in 1D where $Q$
-    is an optional scalar coefficient, $u$ is in $L_2$, and $v$ is in $H^1$. */
+    is an optional scalar coefficient, $u$ is in $L_2$, and $v$ is in $H^1$.
+    Partial assembly (PA) is supported. */
 class MixedScalarWeakDerivativeIntegrator : public MixedScalarIntegrator
 {
 public:
@@ -843,7 +1058,20 @@ public:
    MixedScalarWeakDerivativeIntegrator(Coefficient &q)
       : MixedScalarIntegrator(q) {}
 
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedScalarWeakDerivativeIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
 protected:
+   MixedScalarPAOperator pa_op;
+
    inline virtual bool VerifyFiniteElementTypes(
       const FiniteElement & trial_fe,
       const FiniteElement & test_fe) const
@@ -1030,7 +1258,11 @@ protected:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector&, Vector&) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("MixedScalarCurlIntegrator", pa_data); }
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
    // PA extension
    Vector pa_data;
@@ -1200,7 +1432,7 @@ public:
 
 /** Class for integrating the bilinear form $a(u,v) := (Q \nabla u, \nabla v)$ in 3D
     or in 2D and where $Q$ is a scalar or matrix coefficient $u$ and $v$ are both in
-    $H^1$. */
+    $H^1$. Partial assembly (PA) is supported on tensor-product elements. */
 class MixedGradGradIntegrator : public MixedVectorIntegrator
 {
 public:
@@ -1212,6 +1444,17 @@ public:
    MixedGradGradIntegrator(MatrixCoefficient &mq)
       : MixedVectorIntegrator(mq) { same_calc_shape = true; }
 
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedGradGradIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
    inline virtual bool VerifyFiniteElementTypes(
       const FiniteElement & trial_fe,
       const FiniteElement & test_fe) const
@@ -1254,6 +1497,9 @@ public:
                                      ElementTransformation &Trans,
                                      DenseMatrix & shape)
    { test_fe.CalcPhysDShape(Trans, shape); }
+
+protected:
+   MixedScalarPAOperator pa_op;
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (\vec{V} \times \nabla u, \nabla v)$ in 3D
@@ -1750,13 +1996,25 @@ public:
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (\vec{V} \cdot \nabla u, v)$ in 2D or
-    3D and where $\vec{V}$ is a vector coefficient, $u$ is in $H^1$ and $v$ is in $H^1$ or $L_2$. */
+    3D and where $\vec{V}$ is a vector coefficient, $u$ is in $H^1$ and $v$ is in $H^1$ or $L_2$.
+    Partial assembly (PA) is supported on tensor-product elements. */
 class MixedDirectionalDerivativeIntegrator : public MixedScalarVectorIntegrator
 {
 public:
    MixedDirectionalDerivativeIntegrator(VectorCoefficient &vq)
       : MixedScalarVectorIntegrator(vq, true) {}
 
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedDirectionalDerivativeIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
    inline virtual bool VerifyFiniteElementTypes(
       const FiniteElement & trial_fe,
       const FiniteElement & test_fe) const
@@ -1780,6 +2038,9 @@ public:
                                   ElementTransformation &Trans,
                                   DenseMatrix & shape)
    { vector_fe.CalcPhysDShape(Trans, shape); }
+
+protected:
+   MixedScalarPAOperator pa_op;
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (-\hat{V} \cdot \nabla u, \nabla \cdot v)$ in 2D
@@ -1862,13 +2123,25 @@ public:
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (-\hat{V} u, \nabla v)$ in 2D or 3D
-    and where $\hat{V}$ is a vector coefficient, $u$ is in $H^1$ or $L_2$ and $v$ is in $H^1$. */
+    and where $\hat{V}$ is a vector coefficient, $u$ is in $H^1$ or $L_2$ and $v$ is in $H^1$.
+    Partial assembly (PA) is supported on tensor-product elements. */
 class MixedScalarWeakDivergenceIntegrator : public MixedScalarVectorIntegrator
 {
 public:
    MixedScalarWeakDivergenceIntegrator(VectorCoefficient &vq)
       : MixedScalarVectorIntegrator(vq, false) {}
 
+   using BilinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &trial_fes,
+                   const FiniteElementSpace &test_fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return pa_op.GetMemoryReport("MixedScalarWeakDivergenceIntegrator"); }
+   void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
+
    inline virtual bool VerifyFiniteElementTypes(
       const FiniteElement & trial_fe,
       const FiniteElement & test_fe) const
@@ -1892,6 +2165,9 @@ public:
                                   ElementTransformation &Trans,
                                   DenseMatrix & shape)
    { vector_fe.CalcPhysDShape(Trans, shape); shape *= -1.0; }
+
+protected:
+   MixedScalarPAOperator pa_op;
 };
 
 /** Class for integrating the bilinear form $a(u,v) := (Q \nabla u, v)$ in either 2D
@@ -1942,7 +2218,11 @@ protected:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector&, Vector&) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("MixedVectorGradientIntegrator", pa_data); }
    void AddMultTransposePA(const Vector&, Vector&) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
 private:
    DenseMatrix Jinv;
@@ -2001,7 +2281,11 @@ protected:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector&, Vector&) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("MixedVectorCurlIntegrator", pa_data); }
    void AddMultTransposePA(const Vector&, Vector&) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
 private:
    // PA extension
@@ -2060,7 +2344,11 @@ protected:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector&, Vector&) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("MixedVectorWeakCurlIntegrator", pa_data); }
    void AddMultTransposePA(const Vector&, Vector&) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
 private:
    // PA extension
@@ -2157,7 +2445,11 @@ public:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("GradientIntegrator", pa_data); }
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
@@ -2341,6 +2633,14 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   void AddMultPARange(const Vector &x, Vector &y, int e_begin,
+                       int e_end) const override;
+
+   bool SupportsAddMultPARange() const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("DiffusionIntegrator", pa_data); }
+
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2463,6 +2763,14 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   void AddMultPARange(const Vector &x, Vector &y, int e_begin,
+                       int e_end) const override;
+
+   bool SupportsAddMultPARange() const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("MassIntegrator", pa_data); }
+
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
    void AddMultTransposePA(const Vector&, Vector&) const override;
@@ -2556,6 +2864,9 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("ConvectionIntegrator", pa_data); }
+
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
 
    static const IntegrationRule &GetRule(const FiniteElement &el,
@@ -2686,6 +2997,9 @@ public:
    void AssembleDiagonalPA(Vector &diag) override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("VectorMassIntegrator", pa_data); }
    void AddMultMF(const Vector &x, Vector &y) const override;
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
@@ -2718,6 +3032,9 @@ protected:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector&, Vector&) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("VectorFEDivergenceIntegrator", pa_data); }
    void AddMultTransposePA(const Vector&, Vector&) const override;
 
 private:
@@ -2900,6 +3217,9 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &fes) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("CurlCurlIntegrator", pa_data); }
    void AddAbsMultPA(const Vector &x, Vector &y) const override;
    void AssembleDiagonalPA(Vector& diag) override;
 
@@ -3046,8 +3366,12 @@ public:
    void AssemblePA(const FiniteElementSpace &trial_fes,
                    const FiniteElementSpace &test_fes) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("VectorFEMassIntegrator", pa_data); }
    void AddAbsMultPA(const Vector &x, Vector &y) const override;
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
    void AssembleDiagonalPA(Vector& diag) override;
    void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                    const bool add) override;
@@ -3096,7 +3420,11 @@ public:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("VectorDivergenceIntegrator", pa_data); }
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
+   void AssembleDiagonalPA_ADAt(const Vector &D, Vector &diag) override;
 
    static const IntegrationRule &GetRule(const FiniteElement &trial_fe,
                                          const FiniteElement &test_fe,
@@ -3147,6 +3475,9 @@ public:
    using BilinearFormIntegrator::AssemblePA;
    void AssemblePA(const FiniteElementSpace &fes) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("DivDivIntegrator", pa_data); }
    void AssembleDiagonalPA(Vector& diag) override;
    void AssembleEA(const FiniteElementSpace &fes, Vector &emat,
                    const bool add) override;
@@ -3241,6 +3572,9 @@ public:
    void AssembleDiagonalPA(Vector &diag) override;
    void AssembleDiagonalMF(Vector &diag) override;
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("VectorDiffusionIntegrator", pa_data); }
    void AddMultMF(const Vector &x, Vector &y) const override;
    bool SupportsCeed() const override { return DeviceCanUseCeed(); }
 
@@ -3381,6 +3715,8 @@ public:
    void AddMultPA(const Vector &x, Vector &y) const override;
 
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
+
+   void AssembleDiagonalPA(Vector &diag) override;
 };
 
 /** Integrator for the DG form:
@@ -3459,6 +3795,13 @@ public:
 
    void AddMultPA(const Vector&, Vector&) const override;
 
+   bool SupportsFaceDiagonalPA() const override { return true; }
+
+   void AssembleDiagonalPAFaces(Vector &diag) override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("DGTraceIntegrator", pa_data); }
+
    using BilinearFormIntegrator::AssembleEAInteriorFaces;
    void AssembleEAInteriorFaces(const FiniteElementSpace& fes,
                                 Vector &ea_data_int,
@@ -3576,6 +3919,9 @@ public:
    void AddMultPAFaceNormalDerivatives(const Vector &x, const Vector &dxdn,
                                        Vector &y, Vector &dydn) const override;
 
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("DGDiffusionIntegrator", pa_data); }
+
    const IntegrationRule &GetRule(int order, FaceElementTransformations &T);
 
    const IntegrationRule &GetRule(int order, Geometry::Type geom);
@@ -3725,16 +4071,18 @@ public:
 
     This is a '%Vector' integrator, i.e. defined for FE spaces using multiple
     copies of a scalar FE space.
+
+    Partial assembly is supported for tensor product elements with a
+    Gauss-Lobatto basis; the face quadrature points are then the Gauss-Lobatto
+    points, see DGDiffusionIntegrator.
  */
 class DGElasticityIntegrator : public BilinearFormIntegrator
 {
 public:
-   DGElasticityIntegrator(real_t alpha_, real_t kappa_)
-      : lambda(NULL), mu(NULL), alpha(alpha_), kappa(kappa_) { }
+   DGElasticityIntegrator(real_t alpha_, real_t kappa_);
 
    DGElasticityIntegrator(Coefficient &lambda_, Coefficient &mu_,
-                          real_t alpha_, real_t kappa_)
-      : lambda(&lambda_), mu(&mu_), alpha(alpha_), kappa(kappa_) { }
+                          real_t alpha_, real_t kappa_);
 
    using BilinearFormIntegrator::AssembleFaceMatrix;
    void AssembleFaceMatrix(const FiniteElement &el1,
@@ -3742,10 +4090,49 @@ public:
                            FaceElementTransformations &Trans,
                            DenseMatrix &elmat) override;
 
+   bool RequiresFaceNormalDerivatives() const override { return true; }
+
+   using BilinearFormIntegrator::AssemblePA;
+
+   void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
+
+   void AssemblePABoundaryFaces(const FiniteElementSpace &fes) override;
+
+   void AddMultPAFaceNormalDerivatives(const Vector &x, const Vector &dxdn,
+                                       Vector &y, Vector &dydn) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("DGElasticityIntegrator", pa_data); }
+
+   /// arguments: nf, B, G, alpha, pa_data, x, dxdn, y, dydn, dofs1D, quad1D
+   using ApplyKernelType = void (*)(const int, const Array<real_t> &,
+                                    const Array<real_t> &, const real_t,
+                                    const Vector &, const Vector &,
+                                    const Vector &, Vector &, Vector &,
+                                    const int, const int);
+
+   /// arguments: DIM, d1d, q1d
+   MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
+
+   template <int DIM, int D1D, int Q1D> static void AddSpecialization()
+   {
+      ApplyPAKernels::Specialization<DIM, D1D, Q1D>::Add();
+   }
+
+   struct Kernels { Kernels(); };
+
 protected:
    Coefficient *lambda, *mu;
    real_t alpha, kappa;
 
+   // PA extension
+   Vector pa_data; // (n, h^{-1} penalty, lambda, mu, J^{-1}|el0, J^{-1}|el1)
+   const DofToQuad *maps; ///< Not owned
+   int dim, nf, dofs1D, quad1D;
+   IntegrationRules irs{0, Quadrature1D::GaussLobatto};
+
+   void SetupPA(const FiniteElementSpace &fes, FaceType type);
+
 #ifndef MFEM_THREAD_SAFE
    // values of all scalar basis functions for one component of u (which is a
    // vector) at the integration point in the reference space
@@ -3792,6 +4179,23 @@ public:
                            const FiniteElement &test_fe2,
                            FaceElementTransformations &Trans,
                            DenseMatrix &elmat) override;
+
+   /** @brief Element assembly of the interior face matrices, see
+       NormalTraceJumpIntegrator::AssembleEAInteriorFaces().
+
+       The test space must consist of tensor product elements with a closed
+       nodal basis (e.g. H1, or L2 with Gauss-Lobatto nodes), so that the
+       traces of the test functions are given by the face DOFs.
+
+       There is no partial assembly: the integrator is added with
+       MixedBilinearForm::AddTraceFaceIntegrator(), which the mixed PA
+       extension does not support, and a face PA action would also need a
+       face restriction of the trace (interface) space. */
+   using BilinearFormIntegrator::AssembleEAInteriorFaces;
+   void AssembleEAInteriorFaces(const FiniteElementSpace &trial_fes,
+                                const FiniteElementSpace &test_fes,
+                                Vector &emat,
+                                const bool add = true) override;
 };
 
 /** Integrator for the form:$ \langle v, [w \cdot n] \rangle $ over all faces (the interface) where
@@ -3986,6 +4390,9 @@ public:
                    const FiniteElementSpace &test_fes) override;
 
    void AddMultPA(const Vector &x, Vector &y) const override;
+
+   MemoryReport GetMemoryReport() const override
+   { return PADataMemoryReport("IdentityInterpolator", pa_data); }
    void AddMultTransposePA(const Vector &x, Vector &y) const override;
 
 private:
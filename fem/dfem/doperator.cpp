@@ -11,6 +11,8 @@
 
 #include "doperator.hpp"
 
+#include <algorithm>
+
 #ifdef MFEM_USE_MPI
 
 using namespace mfem;
@@ -51,4 +53,177 @@ DifferentiableOperator::DifferentiableOperator(
    }
 }
 
+namespace
+{
+
+const ParFiniteElementSpace &GetParFESpace(const FieldDescriptor &f)
+{
+   auto fes = std::get_if<const ParFiniteElementSpace *>(&f.data);
+   MFEM_VERIFY(fes && *fes,
+               "colored assembly requires fields on a ParFiniteElementSpace");
+   return **fes;
+}
+
+// Element to L-dof connectivity of a finite element space, including the
+// vector components.
+void GetElementToVDofTable(const ParFiniteElementSpace &fes, Table &el_vdof)
+{
+   const int ne = fes.GetNE();
+   Array<int> vdofs;
+   el_vdof.MakeI(ne);
+   for (int e = 0; e < ne; e++)
+   {
+      fes.GetElementVDofs(e, vdofs);
+      el_vdof.AddColumnsInRow(e, vdofs.Size());
+   }
+   el_vdof.MakeJ();
+   for (int e = 0; e < ne; e++)
+   {
+      fes.GetElementVDofs(e, vdofs);
+      for (int &v : vdofs) { v = FiniteElementSpace::DecodeDof(v); }
+      el_vdof.AddConnections(e, vdofs.GetData(), vdofs.Size());
+   }
+   el_vdof.ShiftUpI();
+}
+
+} // anonymous namespace
+
+void DerivativeOperator::ComputeColoring() const
+{
+   const ParFiniteElementSpace &trial_fes = GetParFESpace(direction);
+   const ParFiniteElementSpace &test_fes = GetParFESpace(transpose_direction);
+   const int n_trial = trial_fes.GetVSize(), n_test = test_fes.GetVSize();
+
+   Table el_trial, el_test, trial_el, test_el, trial_test;
+   GetElementToVDofTable(trial_fes, el_trial);
+   GetElementToVDofTable(test_fes, el_test);
+   Transpose(el_trial, trial_el, n_trial);
+   Transpose(el_test, test_el, n_test);
+
+   // test_trial(i) = trial L-dofs coupled to the test L-dof i, i.e. the
+   // sparsity of row i. trial_test(j) = test L-dofs coupled to the trial L-dof
+   // j, i.e. the sparsity of column j.
+   Mult(test_el, el_trial, test_trial);
+   Mult(trial_el, el_test, trial_test);
+   test_trial.SortRows();
+
+   // Greedy distance-2 coloring: the columns j and k conflict if they have a
+   // nonzero in the same row. marker[c] == j marks the color c as used by a
+   // column conflicting with j.
+   colors.SetSize(n_trial);
+   colors = -1;
+   Array<int> marker;
+   for (int j = 0; j < n_trial; j++)
+   {
+      const int *rows = trial_test.GetRow(j);
+      for (int r = 0; r < trial_test.RowSize(j); r++)
+      {
+         const int i = rows[r];
+         const int *cols = test_trial.GetRow(i);
+         for (int k = 0; k < test_trial.RowSize(i); k++)
+         {
+            const int c = colors[cols[k]];
+            if (c >= 0) { marker[c] = j; }
+         }
+      }
+      int c = 0;
+      while (c < marker.Size() && marker[c] == j) { c++; }
+      if (c == marker.Size()) { marker.Append(-1); }
+      colors[j] = c;
+   }
+   num_colors = marker.Size();
+}
+
+void DerivativeOperator::AssembleColored(SparseMatrix *&A) const
+{
+   MFEM_VERIFY(!derivative_actions.empty(),
+               "derivative can't be assembled with colored probing");
+
+   if (num_colors == 0) { ComputeColoring(); }
+
+   const int n_test = test_trial.Size();
+   const int n_trial = colors.Size();
+   MFEM_VERIFY(n_test == daction_l_size, "internal error: test space size");
+
+   // Copy the sparsity, test_trial is kept for the next assembly
+   const int nnz = test_trial.Size_of_connections();
+   int *I = Memory<int>(n_test + 1);
+   int *J = Memory<int>(nnz);
+   real_t *data = Memory<real_t>(nnz);
+   std::copy(test_trial.GetI(), test_trial.GetI() + n_test + 1, I);
+   std::copy(test_trial.GetJ(), test_trial.GetJ() + nnz, J);
+
+   // color_nnz(c) = positions of the nonzeros of the columns of color c, with
+   // their rows in nnz_row
+   Table color_nnz;
+   Array<int> nnz_row(nnz);
+   color_nnz.MakeI(num_colors);
+   for (int k = 0; k < nnz; k++) { color_nnz.AddAColumnInRow(colors[J[k]]); }
+   color_nnz.MakeJ();
+   for (int i = 0; i < n_test; i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         color_nnz.AddConnection(colors[J[k]], k);
+         nnz_row[k] = i;
+      }
+   }
+   color_nnz.ShiftUpI();
+
+   direction_l.SetSize(n_trial);
+   daction_l.SetSize(daction_l_size);
+   for (int c = 0; c < num_colors; c++)
+   {
+      // The direction is the sum of the unit vectors of the columns of color c
+      real_t *d = direction_l.HostWrite();
+      for (int j = 0; j < n_trial; j++) { d[j] = (colors[j] == c) ? 1.0 : 0.0; }
+
+      daction_l = 0.0;
+      for (const auto &f : derivative_actions)
+      {
+         f(fields_e, direction_l, daction_l);
+      }
+
+      // Each row has at most one nonzero in the columns of color c
+      const real_t *y = daction_l.HostRead();
+      const int *pos = color_nnz.GetRow(c);
+      for (int k = 0; k < color_nnz.RowSize(c); k++)
+      {
+         data[pos[k]] = y[nnz_row[pos[k]]];
+      }
+   }
+
+   A = new SparseMatrix(I, J, data, n_test, n_trial, true, true, true);
+}
+
+void DerivativeOperator::AssembleColored(HypreParMatrix *&A) const
+{
+   SparseMatrix *spmat = nullptr;
+   AssembleColored(spmat);
+
+   const ParFiniteElementSpace &trial_fes = GetParFESpace(direction);
+   const ParFiniteElementSpace &test_fes = GetParFESpace(transpose_direction);
+
+   if (&trial_fes == &test_fes)
+   {
+      HypreParMatrix tmp(test_fes.GetComm(),
+                         test_fes.GlobalVSize(),
+                         test_fes.GetDofOffsets(),
+                         spmat);
+      A = RAP(&tmp, test_fes.Dof_TrueDof_Matrix());
+   }
+   else
+   {
+      HypreParMatrix tmp(test_fes.GetComm(),
+                         test_fes.GlobalVSize(),
+                         trial_fes.GlobalVSize(),
+                         test_fes.GetDofOffsets(),
+                         trial_fes.GetDofOffsets(),
+                         spmat);
+      A = RAP(test_fes.Dof_TrueDof_Matrix(), &tmp,
+              trial_fes.Dof_TrueDof_Matrix());
+   }
+   delete spmat;
+}
+
 #endif // MFEM_USE_MPI
@@ -64,10 +64,11 @@ using restriction_callback_t =
 /// both forward and transpose operations, as well as assembly into sparse
 /// matrices.
 ///
-/// @note The derivative operator uses only forward mode differentiation in Mult
-/// and MultTranspose. It does not support reverse mode differentiation. The
-/// MultTranspose operation is achieved by using the transpose of the derivative
-/// actions on each quadrature point.
+/// @note The derivative operator uses forward mode differentiation in Mult,
+/// which applies the Jacobians cached on each quadrature point. MultTranspose
+/// computes vector-Jacobian products of the quadrature functions directly
+/// (reverse mode with Enzyme, see call_qfunction_vjp()) and does not use the
+/// cache.
 ///
 /// @see DifferentiableOperator
 class DerivativeOperator : public Operator
@@ -87,6 +88,8 @@ public:
       const std::vector<derivative_action_t> &derivative_actions_transpose,
       const FieldDescriptor &transpose_direction,
       const int &daction_transpose_l_size,
+      const std::function<void(const Vector &, Vector &)>
+      &transpose_prolongation,
       const std::vector<Vector *> &solutions_l,
       const std::vector<Vector *> &parameters_l,
       const restriction_callback_t &restriction_callback,
@@ -102,6 +105,8 @@ public:
       daction_l_size(daction_l_size),
       derivative_actions_transpose(derivative_actions_transpose),
       transpose_direction(transpose_direction),
+      daction_transpose_l_size(daction_transpose_l_size),
+      transpose_prolongation(transpose_prolongation),
       prolongation_transpose(prolongation_transpose),
       assemble_derivative_sparsematrix_callbacks(
          assemble_derivative_sparsematrix_callbacks),
@@ -146,12 +151,16 @@ public:
    /// @brief Compute the transpose of the derivative operator on a given
    /// vector.
    ///
-   /// This function computes the transpose of the derivative operator on a
-   /// given vector by transposing the quadrature point local forward derivative
-   /// action. It does not use reverse mode automatic differentiation.
+   /// This function computes the vector-Jacobian product of the derivative
+   /// operator with a given cotangent vector. With Enzyme, the quadrature
+   /// functions are differentiated in reverse mode and the cost is roughly the
+   /// cost of one application of the forward operator. Without Enzyme, the
+   /// quadrature function is called once per component of the dependent inputs
+   /// on each quadrature point (e.g. dim times for a gradient input), see
+   /// call_qfunction_vjp().
    ///
-   /// @param direction_t The direction vector in which to compute the
-   /// derivative. This has to be a T-dof vector.
+   /// @param direction_t The cotangent vector in the test space. This has to
+   /// be a T-dof vector.
    /// @param result_t Result vector of the transpose action of the derivative on
    /// direction_t on T-dofs.
    void MultTranspose(const Vector &direction_t, Vector &result_t) const override
@@ -159,15 +168,15 @@ public:
       MFEM_ASSERT(!derivative_actions_transpose.empty(),
                   "derivative can't be used to be multiplied in transpose mode");
 
-      daction_l.SetSize(width);
+      daction_l.SetSize(daction_transpose_l_size);
       daction_l = 0.0;
 
-      prolongation(transpose_direction, direction_t, direction_l);
+      transpose_prolongation(direction_t, direction_l);
       for (const auto &f : derivative_actions_transpose)
       {
          f(fields_e, direction_l, daction_l);
       }
-      prolongation_transpose(daction_l, result_t);
+      get_prolongation(direction)->MultTranspose(daction_l, result_t);
    };
 
    /// @brief Assemble the derivative operator into a SparseMatrix.
@@ -200,7 +209,44 @@ public:
       }
    }
 
+   /// @brief Assemble the derivative operator into a SparseMatrix using a
+   /// colored probing of the derivative action.
+   ///
+   /// The trial space L-dofs are colored such that two L-dofs of the same
+   /// color never couple to the same test space L-dof through an element
+   /// (distance-2 coloring of the element connectivity). A single derivative
+   /// action then recovers all the columns of one color, so the number of
+   /// actions is the number of colors instead of the number of L-dofs. The
+   /// colors are processed one after another, with one full derivative action
+   /// (over all the elements) per color; the cost is GetNumColors() times the
+   /// cost of Mult().
+   ///
+   /// Unlike Assemble(), this only uses the matrix-free derivative actions and
+   /// does not require the element matrices of the integrators. The solution
+   /// and test fields have to be defined on ParFiniteElementSpaces.
+   ///
+   /// @param A The SparseMatrix to assemble the derivative operator on L-dofs
+   /// into. Can be an uninitialized object.
+   void AssembleColored(SparseMatrix *&A) const;
+
+   /// @brief Assemble the derivative operator into a HypreParMatrix using a
+   /// colored probing of the derivative action.
+   ///
+   /// @param A The HypreParMatrix to assemble the derivative operator into.
+   /// Can be an uninitialized object.
+   ///
+   /// @see AssembleColored(SparseMatrix *&)
+   void AssembleColored(HypreParMatrix *&A) const;
+
+   /// @brief Get the number of colors, i.e. the number of derivative actions
+   /// used by AssembleColored(). Returns 0 before the first assembly.
+   int GetNumColors() const { return num_colors; }
+
 private:
+   /// Compute the L-dof sparsity pattern and the trial L-dof coloring used by
+   /// AssembleColored().
+   void ComputeColoring() const;
+
    /// Derivative action callbacks. Depending on the requested derivatives in
    /// DifferentiableOperator the callbacks represent certain combinations of
    /// actions of derivatives of the forward operator.
@@ -219,6 +265,12 @@ private:
 
    FieldDescriptor transpose_direction;
 
+   const int daction_transpose_l_size;
+
+   /// Prolongation of the cotangent in the test space, see
+   /// get_output_prolongation().
+   std::function<void(const Vector &, Vector &)> transpose_prolongation;
+
    mutable std::vector<Vector> fields_e;
 
    mutable Vector direction_l;
@@ -232,6 +284,15 @@ private:
    /// Callbacks that assemble derivatives into a HypreParMatrix.
    std::vector<assemble_derivative_hypreparmatrix_callback_t>
    assemble_derivative_hypreparmatrix_callbacks;
+
+   /// Test L-dof to trial L-dof connectivity, sparsity of the derivative.
+   mutable Table test_trial;
+
+   /// Color of each trial L-dof, see AssembleColored().
+   mutable Array<int> colors;
+
+   /// Number of colors in #colors.
+   mutable int num_colors = 0;
 };
 
 /// Class representing a differentiable operator which acts on solution and
@@ -467,7 +528,8 @@ public:
                 residual_l.Size(),
                 daction_transpose_callbacks[derivative_id],
                 fields[test_space_field_idx],
-                GetVSize(fields[test_space_field_idx]),
+                GetVSize(fields[derivative_idx]),
+                output_prolongation,
                 sol_l,
                 par_l,
                 restriction_callback,
@@ -476,6 +538,69 @@ public:
                 assemble_derivative_hypreparmatrix_callbacks[derivative_id]);
    }
 
+   /// @brief Compute the vector-Jacobian product with the derivative for a
+   /// given derivative ID.
+   ///
+   /// This computes result_t = (dF/du)^T cotangent_t where u is the field
+   /// identified by the derivative ID. The vector-Jacobian products of the
+   /// quadrature functions are computed directly (reverse mode with Enzyme)
+   /// and, unlike GetDerivative(), no Jacobians are computed and cached on the
+   /// quadrature points. Without Enzyme, this costs one quadrature function
+   /// call per component of the dependent inputs on each quadrature point. For
+   /// a one field operator (e.g. a scalar quantity of interest) and a cotangent
+   /// of 1, this is the gradient with respect to u.
+   ///
+   /// @param derivative_id The ID of the derivative to be computed.
+   /// @param sol_l The solution vectors. The vectors have to be L-vectors
+   /// (e.g. GridFunctions).
+   /// @param par_l The parameter vectors. The vectors have to be L-vectors
+   /// (e.g. GridFunctions).
+   /// @param cotangent_t The cotangent vector in the test space on T-dofs.
+   /// @param result_t The vector-Jacobian product on T-dofs of the field
+   /// identified by the derivative ID.
+   void MultTransposeDerivative(
+      size_t derivative_id, std::vector<Vector *> sol_l,
+      std::vector<Vector *> par_l, const Vector &cotangent_t, Vector &result_t)
+   {
+      MFEM_ASSERT(daction_transpose_callbacks.find(derivative_id) !=
+                  daction_transpose_callbacks.end(),
+                  "no derivative action has been found for ID " << derivative_id);
+
+      MFEM_ASSERT(sol_l.size() == solutions.size(),
+                  "wrong number of solutions");
+
+      MFEM_ASSERT(par_l.size() == parameters.size(),
+                  "wrong number of parameters");
+
+      const size_t derivative_idx = FindIdx(derivative_id, fields);
+
+      std::vector<Vector> s_l(solutions_l.size());
+      for (size_t i = 0; i < s_l.size(); i++)
+      {
+         s_l[i] = *sol_l[i];
+      }
+
+      std::vector<Vector> p_l(parameters_l.size());
+      for (size_t i = 0; i < p_l.size(); i++)
+      {
+         p_l[i] = *par_l[i];
+      }
+
+      fields_e.resize(solutions_l.size() + parameters_l.size());
+      restriction_callback(s_l, p_l, fields_e);
+
+      Vector cotangent_l, result_l(GetVSize(fields[derivative_idx]));
+      output_prolongation(cotangent_t, cotangent_l);
+      result_l = 0.0;
+      for (const auto &f : daction_transpose_callbacks[derivative_id])
+      {
+         f(fields_e, cotangent_l, result_l);
+      }
+      result_t.SetSize(GetTrueVSize(fields[derivative_idx]));
+      get_prolongation(fields[derivative_idx])->MultTranspose(result_l,
+                                                              result_t);
+   }
+
 private:
    const ParMesh &mesh;
 
@@ -507,6 +632,7 @@ private:
    mutable Vector residual_e;
 
    std::function<void(Vector &, Vector &)> prolongation_transpose;
+   std::function<void(const Vector &, Vector &)> output_prolongation;
    std::function<void(Vector &, Vector &)> output_restriction_transpose;
    restriction_callback_t restriction_callback;
 
@@ -713,6 +839,9 @@ void DifferentiableOperator::AddIntegrator(
    prolongation_transpose = get_prolongation_transpose(
                                fields[test_space_field_idx], output_fop, mesh.GetComm());
 
+   output_prolongation = get_output_prolongation(fields[test_space_field_idx],
+                                                 output_fop);
+
    int dimension;
    if constexpr (std::is_same_v<entity_t, Entity::Element>)
    {
@@ -1157,6 +1286,139 @@ void DifferentiableOperator::AddIntegrator(
             or_transpose(derivative_action_e, der_action_l);
          });
 
+         // The transpose derivative action computes vector-Jacobian products.
+         // The cotangent is mapped from the test space to the quadrature
+         // points, the quadrature functions are differentiated in reverse mode
+         // and the result is integrated with the trial operators of the
+         // dependent inputs. It doesn't use the quadrature point caches.
+         const Operator *trial_restriction =
+            get_restriction<entity_t>(direction, element_dof_ordering);
+         const auto test_field = fields[test_space_field_idx];
+         Vector cotangent_e(output_e_size);
+         Vector transpose_action_e(trial_restriction->Height());
+
+         daction_transpose_callbacks[derivative_id].push_back(
+            [
+               // capture by copy:
+               dimension,             // int
+               num_entities,          // int
+               num_test_dof,          // int
+               num_qp,                // int
+               q1d,                   // int
+               test_vdim,             // int (= output_fop.vdim)
+               inputs,                // mfem::future::tuple
+               attributes,            // Array<int>
+               ir_weights,            // DeviceTensor
+               use_sum_factorization, // bool
+               input_dtq_maps,        // std::array<DofToQuadMap, num_fields>
+               output_dtq_maps,       // std::array<DofToQuadMap, num_fields>
+               input_to_field,        // std::array<int, s>
+               output_fop,            // class derived from FieldOperator
+               qfunc,                 // qfunc_t
+               thread_blocks,         // ThreadBlocks
+               shmem_cache,           // Vector (local)
+               shmem_info,            // SharedMemoryInfo
+               elem_attributes,       // Array<int>
+
+               input_is_dependent,    // std::array<bool, num_inputs>
+               test_field,            // FieldDescriptor
+               direction_e,           // Vector
+               cotangent_e,           // Vector
+               transpose_action_e,    // Vector
+               trial_restriction,     // const Operator *
+               element_dof_ordering,  // ElementDofOrdering
+               da_size_on_qp,         // int
+               inputs_trial_op_dim,
+               trial_vdim,
+               num_trial_dof
+            ](
+               std::vector<Vector> &f_e, const Vector &cotangent_l,
+               Vector &der_action_l) mutable
+         {
+            if constexpr (is_sum_fop<decltype(output_fop)>::value)
+            {
+               cotangent_e = cotangent_l;
+            }
+            else
+            {
+               restriction<entity_t>(test_field, cotangent_l, cotangent_e,
+                                     element_dof_ordering);
+            }
+            auto ybar_e = Reshape(cotangent_e.ReadWrite(),
+                                  num_test_dof * test_vdim, num_entities);
+            auto xe = Reshape(transpose_action_e.ReadWrite(), num_trial_dof,
+                              trial_vdim, num_entities);
+            auto wrapped_fields_e = wrap_fields(f_e, shmem_info.field_sizes,
+                                                num_entities);
+            auto wrapped_direction_e = Reshape(direction_e.ReadWrite(),
+                                               shmem_info.direction_size,
+                                               num_entities);
+
+            auto itod = Reshape(inputs_trial_op_dim.Read(), num_inputs);
+
+            const bool has_attr = attributes.Size() > 0;
+            const auto d_attr = attributes.Read();
+            const auto d_elem_attr = elem_attributes->Read();
+
+            transpose_action_e = 0.0;
+            forall([=] MFEM_HOST_DEVICE (int e, real_t *shmem)
+            {
+               if (has_attr && !d_attr[d_elem_attr[e] - 1]) { return; }
+
+               auto [input_dtq_shmem_, output_dtq_shmem, fields_shmem,
+                                       direction_shmem, input_shmem,
+                                       shadow_shmem_, residual_shmem,
+                                       scratch_shmem_] =
+                        unpack_shmem(shmem, shmem_info, input_dtq_maps, output_dtq_maps,
+                                     wrapped_fields_e, wrapped_direction_e, num_qp, e);
+               auto &input_dtq_shmem = input_dtq_shmem_;
+               auto &shadow_shmem = shadow_shmem_;
+               auto &scratch_shmem = scratch_shmem_;
+
+               map_fields_to_quadrature_data(
+                  input_shmem, fields_shmem, input_dtq_shmem, input_to_field,
+                  inputs, ir_weights, scratch_shmem, dimension,
+                  use_sum_factorization);
+
+               // Transpose of the integration with the test operator
+               if constexpr (is_sum_fop<decltype(output_fop)>::value)
+               {
+                  for (int q = 0; q < num_qp; q++)
+                  {
+                     residual_shmem(0, q) = ybar_e(0, 0);
+                  }
+                  MFEM_SYNC_THREAD;
+               }
+               else
+               {
+                  auto ybar = Reshape(&ybar_e(0, e), num_test_dof * test_vdim);
+                  map_field_to_quadrature_data_conditional(
+                     residual_shmem, ybar, output_dtq_shmem[0], output_fop,
+                     ir_weights, scratch_shmem, true, dimension,
+                     use_sum_factorization);
+               }
+
+               call_qfunction_vjp<qf_param_ts>(
+                  qfunc, input_shmem, shadow_shmem, residual_shmem, itod,
+                  da_size_on_qp, num_qp, q1d, dimension, use_sum_factorization);
+
+               auto y = Reshape(&xe(0, 0, e), num_trial_dof, trial_vdim);
+               for_constexpr<num_inputs>([&](auto s)
+               {
+                  if (!input_is_dependent[s]) { return; }
+                  const int vdim = get<s>(inputs).vdim;
+                  auto fbar = Reshape(&shadow_shmem[s](0, 0), vdim,
+                                      static_cast<int>(itod(s)), num_qp);
+                  map_quadrature_data_to_fields(
+                     y, fbar, get<s>(inputs), input_dtq_shmem[s],
+                     scratch_shmem, dimension, use_sum_factorization);
+               });
+            }, num_entities, thread_blocks, shmem_info.total_size,
+            shmem_cache.ReadWrite());
+            trial_restriction->AddMultTranspose(transpose_action_e,
+                                                der_action_l);
+         });
+
          assemble_derivative_sparsematrix_callbacks[derivative_id].push_back(
             [
                // capture by copy:
@@ -533,6 +533,38 @@ void apply_kernel_native_dual(
    process_derivative_from_native_dual(f_qp, r);
 }
 
+/// @brief Compute the vector-Jacobian product of a qfunction with native dual
+/// numbers on quadrature point @a qp_idx.
+///
+/// Dual numbers only carry forward mode derivatives. The product is therefore
+/// computed by seeding each component of the dependent inputs one after
+/// another and contracting the derivative of the result with the cotangent
+/// @a ybar.
+template <typename qfunc_t, typename arg_ts, size_t num_args>
+MFEM_HOST_DEVICE inline
+void apply_kernel_vjp_native_dual(
+   std::array<DeviceTensor<2>, num_args> &v,
+   const qfunc_t &qfunc,
+   arg_ts &args,
+   const std::array<DeviceTensor<2>, num_args> &u,
+   const DeviceTensor<1, real_t> &ybar,
+   const DeviceTensor<1, const real_t> &itod,
+   const int &qp_idx)
+{
+   process_qf_args(u, args, qp_idx);
+   for_constexpr<num_args>([&](auto s)
+   {
+      if (itod(s) == 0) { return; }
+      for (int k = 0; k < v[s].GetShape()[0]; k++)
+      {
+         process_qf_arg_seed(get<s>(args), k, 1.0);
+         auto r = get<0>(apply(qfunc, args));
+         process_qf_arg_seed(get<s>(args), k, 0.0);
+         v[s](k, qp_idx) = contract_derivative_from_native_dual(ybar, r);
+      }
+   });
+}
+
 #ifdef MFEM_USE_ENZYME
 
 template <typename func_t, typename... arg_ts>
@@ -614,6 +646,180 @@ void apply_kernel_fwddiff_enzyme(
    process_qf_result(f_qp,
                      get<0>(fwddiff_apply_enzyme(qfunc, args, shadow_args, tuple<> {})));
 }
+
+template <typename func_t, typename... arg_ts>
+MFEM_HOST_DEVICE inline
+real_t qfunction_vjp_wrapper(const func_t &f, const DeviceTensor<1> &ybar,
+                             arg_ts &&...args)
+{
+   return contract_qf_result(ybar, get<0>(f(args...)));
+}
+
+template <typename qfunc_t, typename arg_ts, std::size_t... Is>
+MFEM_HOST_DEVICE inline
+void revdiff_apply_enzyme_indexed(qfunc_t &qfunc, const DeviceTensor<1> &ybar,
+                                  arg_ts &&args, arg_ts &&shadow_args,
+                                  std::index_sequence<Is...>)
+{
+   __enzyme_autodiff<void>(
+      qfunction_vjp_wrapper<qfunc_t, decltype(get<Is>(args))...>,
+      enzyme_const, (void *)&qfunc, enzyme_const, (void *)&ybar,
+      enzyme_dup, &get<Is>(args)..., enzyme_interleave,
+      &get<Is>(shadow_args)...);
+}
+
+/// @brief Reverse mode differentiation of a qfunction. The adjoints of the
+/// arguments with respect to the contraction of the result with the cotangent
+/// @a ybar are accumulated in @a shadow_args.
+template <typename qfunc_t, typename arg_ts>
+MFEM_HOST_DEVICE inline
+void revdiff_apply_enzyme(qfunc_t &qfunc, const DeviceTensor<1> &ybar,
+                          arg_ts &&args, arg_ts &&shadow_args)
+{
+   auto arg_indices = std::make_index_sequence<
+                      tuple_size<std::remove_reference_t<arg_ts>>::value> {};
+
+   revdiff_apply_enzyme_indexed(qfunc, ybar, args, shadow_args, arg_indices);
+}
+
+template <typename qfunc_t, typename arg_ts, size_t num_args>
+MFEM_HOST_DEVICE inline
+void apply_kernel_revdiff_enzyme(
+   std::array<DeviceTensor<2>, num_args> &v,
+   qfunc_t &qfunc,
+   arg_ts &args,
+   arg_ts &shadow_args,
+   const std::array<DeviceTensor<2>, num_args> &u,
+   const DeviceTensor<1, real_t> &ybar,
+   int qp_idx)
+{
+   process_qf_args(u, args, qp_idx);
+   revdiff_apply_enzyme(qfunc, ybar, args, shadow_args);
+   process_qf_args_adjoint(v, shadow_args, qp_idx);
+}
 #endif // MFEM_USE_ENZYME
 
+namespace detail
+{
+template <
+   typename qf_param_ts,
+   typename qfunc_t,
+   std::size_t num_fields>
+MFEM_HOST_DEVICE inline
+void call_qfunction_vjp(
+   qfunc_t &qfunc,
+   const std::array<DeviceTensor<2>, num_fields> &input_shmem,
+   std::array<DeviceTensor<2>, num_fields> &shadow_shmem,
+   DeviceTensor<2> &residual_shmem,
+   const DeviceTensor<1, const real_t> &itod,
+   const int &das_qp,
+   const int &q)
+{
+   auto ybar = Reshape(&residual_shmem(0, q), das_qp);
+   auto qf_args = decay_tuple<qf_param_ts> {};
+#ifdef MFEM_USE_ENZYME
+   auto qf_shadow_args = decay_tuple<qf_param_ts> {};
+   apply_kernel_revdiff_enzyme(shadow_shmem, qfunc, qf_args, qf_shadow_args,
+                               input_shmem, ybar, q);
+#else
+   apply_kernel_vjp_native_dual(shadow_shmem, qfunc, qf_args, input_shmem,
+                                ybar, itod, q);
+#endif
+}
+}
+
+/// @brief Call a qfunction with the given parameters and compute the
+/// vector-Jacobian product (VJP) with the cotangent given on each quadrature
+/// point.
+///
+/// With Enzyme the VJP is computed with reverse mode differentiation in a
+/// single pass. Otherwise, each component of the dependent inputs is seeded
+/// with native dual numbers, one after another: this costs one qfunction call
+/// per dependent input component on each quadrature point (as many as building
+/// the Jacobians for GetDerivative()), but the Jacobians are not stored.
+///
+/// @param qfunc the qfunction to call.
+/// @param input_shmem the input shared memory.
+/// @param shadow_shmem the shadow shared memory. On exit, holds the VJP for
+/// each dependent input.
+/// @param residual_shmem the residual shared memory holding the cotangent.
+/// @param itod inputs trial operator dimension.
+/// If input is dependent the value corresponds to the spatial dimension, otherwise
+/// a zero indicates non-dependence on the variable.
+/// @param das_qp the size of the derivative action.
+/// @param num_qp the number of quadrature points.
+/// @param q1d the number of quadrature points in 1D.
+/// @param dimension the spatial dimension.
+/// @param use_sum_factorization whether to use sum factorization.
+/// @tparam qf_param_ts the tuple type of the qfunction parameters.
+template <
+   typename qf_param_ts,
+   typename qfunc_t,
+   std::size_t num_fields>
+MFEM_HOST_DEVICE inline
+void call_qfunction_vjp(
+   qfunc_t &qfunc,
+   const std::array<DeviceTensor<2>, num_fields> &input_shmem,
+   std::array<DeviceTensor<2>, num_fields> &shadow_shmem,
+   DeviceTensor<2> &residual_shmem,
+   const DeviceTensor<1, const real_t> &itod,
+   const int &das_qp,
+   const int &num_qp,
+   const int &q1d,
+   const int &dimension,
+   const bool &use_sum_factorization)
+{
+   if (use_sum_factorization)
+   {
+      if (dimension == 1)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(q, x, q1d)
+         {
+            detail::call_qfunction_vjp<qf_param_ts>(
+               qfunc, input_shmem, shadow_shmem, residual_shmem, itod, das_qp, q);
+         }
+      }
+      else if (dimension == 2)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, q1d)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qy, y, q1d)
+            {
+               const int q = qx + q1d * qy;
+               detail::call_qfunction_vjp<qf_param_ts>(
+                  qfunc, input_shmem, shadow_shmem, residual_shmem, itod, das_qp, q);
+            }
+         }
+      }
+      else if (dimension == 3)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, q1d)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qy, y, q1d)
+            {
+               MFEM_FOREACH_THREAD_DIRECT(qz, z, q1d)
+               {
+                  const int q = qx + q1d * (qy + q1d * qz);
+                  detail::call_qfunction_vjp<qf_param_ts>(
+                     qfunc, input_shmem, shadow_shmem, residual_shmem, itod, das_qp, q);
+               }
+            }
+         }
+      }
+      else
+      {
+         MFEM_ABORT_KERNEL("unsupported dimension");
+      }
+   }
+   else
+   {
+      MFEM_FOREACH_THREAD_DIRECT(q, x, num_qp)
+      {
+         detail::call_qfunction_vjp<qf_param_ts>(
+            qfunc, input_shmem, shadow_shmem, residual_shmem, itod, das_qp, q);
+      }
+   }
+   MFEM_SYNC_THREAD;
+}
+
 } // namespace mfem::future
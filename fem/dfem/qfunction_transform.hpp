@@ -343,4 +343,145 @@ void process_qf_arg(
    }
 }
 
+/// @brief Set the derivative seed of the component @a idx of a dual qfunction
+/// argument.
+///
+/// The component ordering matches the one used in process_qf_arg(). Arguments
+/// that are not dual numbers are inactive and ignored.
+template <typename T>
+MFEM_HOST_DEVICE inline
+void process_qf_arg_seed(T &, const int &, const real_t &) {}
+
+template <typename T>
+MFEM_HOST_DEVICE inline
+void process_qf_arg_seed(dual<T, T> &arg, const int &, const real_t &seed)
+{
+   arg.gradient = seed;
+}
+
+template <typename T, int n>
+MFEM_HOST_DEVICE inline
+void process_qf_arg_seed(
+   tensor<dual<T, T>, n> &arg,
+   const int &idx,
+   const real_t &seed)
+{
+   arg(idx).gradient = seed;
+}
+
+template <typename T, int n, int m>
+MFEM_HOST_DEVICE inline
+void process_qf_arg_seed(
+   tensor<dual<T, T>, n, m> &arg,
+   const int &idx,
+   const real_t &seed)
+{
+   arg(idx % n, idx / n).gradient = seed;
+}
+
+/// @brief Contract the derivative of a dual qfunction result with the
+/// cotangent @a ybar, i.e. compute ybar^T dr for the seeded direction.
+template <typename T>
+MFEM_HOST_DEVICE inline
+T contract_derivative_from_native_dual(
+   const DeviceTensor<1, T> &ybar,
+   const dual<T, T> &x)
+{
+   return ybar(0) * x.gradient;
+}
+
+template <typename T, int n>
+MFEM_HOST_DEVICE inline
+T contract_derivative_from_native_dual(
+   const DeviceTensor<1, T> &ybar,
+   const tensor<dual<T, T>, n> &x)
+{
+   T r = 0.0;
+   for (int i = 0; i < n; i++)
+   {
+      r += ybar(i) * x(i).gradient;
+   }
+   return r;
+}
+
+template <typename T, int n, int m>
+MFEM_HOST_DEVICE inline
+T contract_derivative_from_native_dual(
+   const DeviceTensor<1, T> &ybar,
+   const tensor<dual<T, T>, n, m> &x)
+{
+   T r = 0.0;
+   for (int i = 0; i < n; i++)
+   {
+      for (int j = 0; j < m; j++)
+      {
+         r += ybar(i + n * j) * x(i, j).gradient;
+      }
+   }
+   return r;
+}
+
+/// @brief Contract a qfunction result with the cotangent @a ybar, i.e.
+/// compute ybar^T r.
+///
+/// This turns a qfunction into a scalar valued function whose gradient with
+/// respect to the qfunction arguments is the vector-Jacobian product, which
+/// is what reverse mode differentiation computes in a single pass.
+template <typename T>
+MFEM_HOST_DEVICE inline
+T contract_qf_result(const DeviceTensor<1, T> &ybar, const T &x)
+{
+   return ybar(0) * x;
+}
+
+template <typename T>
+MFEM_HOST_DEVICE inline
+T contract_qf_result(const DeviceTensor<1, T> &ybar, const tensor<T> &x)
+{
+   return ybar(0) * x(0);
+}
+
+template <typename T, int n>
+MFEM_HOST_DEVICE inline
+T contract_qf_result(const DeviceTensor<1, T> &ybar, const tensor<T, n> &x)
+{
+   T r = 0.0;
+   for (int i = 0; i < n; i++)
+   {
+      r += ybar(i) * x(i);
+   }
+   return r;
+}
+
+template <typename T, int n, int m>
+MFEM_HOST_DEVICE inline
+T contract_qf_result(const DeviceTensor<1, T> &ybar, const tensor<T, n, m> &x)
+{
+   T r = 0.0;
+   for (int i = 0; i < n; i++)
+   {
+      for (int j = 0; j < m; j++)
+      {
+         r += ybar(i + n * j) * x(i, j);
+      }
+   }
+   return r;
+}
+
+/// @brief Write the adjoints accumulated in the shadow qfunction arguments to
+/// the quadrature point data @a v on quadrature point @a qp.
+template <size_t num_fields, typename qf_args>
+MFEM_HOST_DEVICE inline
+void process_qf_args_adjoint(
+   std::array<DeviceTensor<2>, num_fields> &v,
+   const qf_args &shadow_args,
+   const int &qp)
+{
+   for_constexpr<tuple_size<qf_args>::value>([&](auto i)
+   {
+      auto v_qp = Reshape(&v[i](0, qp), v[i].GetShape()[0]);
+      process_qf_result(v_qp, get<i>(shadow_args));
+   });
+}
+
 } // namespace mfem::future
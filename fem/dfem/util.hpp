@@ -1207,6 +1207,38 @@ std::function<void(const Vector&, Vector&)> get_prolongation_transpose(
    return PT;
 }
 
+/// @brief Get a prolongation callback for the output field descriptor of a
+/// field operator.
+///
+/// This is the counterpart of get_prolongation_transpose() and maps tdofs of
+/// the output space, e.g. a cotangent, to vdofs. In the special case of a one
+/// field operator, the value is the same on all ranks and is simply copied.
+///
+/// @param f the field descriptor.
+/// @param fop the field operator.
+/// @tparam fop_t the field operator type.
+template <typename fop_t>
+inline
+std::function<void(const Vector&, Vector&)> get_output_prolongation(
+   const FieldDescriptor &f,
+   const fop_t &fop)
+{
+   if constexpr (is_sum_fop<fop_t>::value ||
+                 is_identity_fop<fop_t>::value)
+   {
+      auto P = [=](const Vector &x, Vector &y_local)
+      {
+         y_local = x;
+      };
+      return P;
+   }
+   auto P = [=](const Vector &x, Vector &y_local)
+   {
+      prolongation(f, x, y_local);
+   };
+   return P;
+}
+
 /// @brief Apply the restriction operator to a field.
 ///
 /// @param u the field descriptor.
@@ -110,6 +110,74 @@ void GetTensorFaceMap(const int dim, const int order, const int face_id,
    FillFaceMap(n_face_dofs, offsets, strides, n_dofs, face_map);
 }
 
+void FaceNormalPermutation(int perm[3], const int face_id)
+{
+   const bool xy_plane = (face_id == 0 || face_id == 5);
+   const bool xz_plane = (face_id == 1 || face_id == 3);
+   // const bool yz_plane = (face_id == 2 || face_id == 4);
+
+   perm[0] = (xy_plane) ? 3 : (xz_plane) ? 2 : 1;
+   perm[1] = (xy_plane || xz_plane) ? 1 : 2;
+   perm[2] = (xy_plane) ? 2 : 3;
+}
+
+void SignedFaceNormalPermutation(int perm[3], const int face_id1,
+                                 const int face_id2, const int orientation)
+{
+   FaceNormalPermutation(perm, face_id2);
+
+   // Sets perm according to the inverse of PermuteFace3D
+   if (face_id2 == 3 || face_id2 == 4)
+   {
+      perm[1] *= -1;
+   }
+   else if (face_id2 == 0)
+   {
+      perm[2] *= -1;
+   }
+
+   switch (orientation)
+   {
+      case 1:
+         std::swap(perm[1], perm[2]);
+         break;
+      case 2:
+         std::swap(perm[1], perm[2]);
+         perm[1] *= -1;
+         break;
+      case 3:
+         perm[1] *= -1;
+         break;
+      case 4:
+         perm[1] *= -1;
+         perm[2] *= -1;
+         break;
+      case 5:
+         std::swap(perm[1], perm[2]);
+         perm[1] *= -1;
+         perm[2] *= -1;
+         break;
+      case 6:
+         std::swap(perm[1], perm[2]);
+         perm[2] *= -1;
+         break;
+      case 7:
+         perm[2] *= -1;
+         break;
+      default:
+         break;
+   }
+
+   if (face_id1 == 3 || face_id1 == 4)
+   {
+      perm[1] *= -1;
+   }
+   else if (face_id1 == 0)
+   {
+      perm[2] *= -1;
+   }
+}
+
 } // namespace internal
 
 } // namespace mfem
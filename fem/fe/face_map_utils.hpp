@@ -52,6 +52,22 @@ void FillFaceMap(const int n_face_dofs_per_component,
 void GetTensorFaceMap(const int dim, const int order, const int face_id,
                       Array<int> &face_map);
 
+/// @brief Assigns to @a perm the (one-based) reference directions of the
+/// hexahedron face @a face_id:
+///    perm[0] <- normal component
+///    perm[1] <- first tangential component
+///    perm[2] <- second tangential component
+///
+/// (Tangential components are ordered lexicographically).
+void FaceNormalPermutation(int perm[3], const int face_id);
+
+/// @brief Assigns to @a perm the permutation as in FaceNormalPermutation() for
+/// the second element on the face, but signed to indicate the sign of the
+/// tangential derivatives relative to the lexicographic ordering of the face
+/// with respect to the first element.
+void SignedFaceNormalPermutation(int perm[3], const int face_id1,
+                                 const int face_id2, const int orientation);
+
 /// @brief Given a face DOF index in native (counter-clockwise) ordering, return
 /// the corresponding DOF index in lexicographic ordering (for a quadrilateral
 /// element).
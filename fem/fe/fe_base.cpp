@@ -675,6 +675,9 @@ const
          const int nqpt = ir.GetNPoints();
 
          const int b_dim = (range_type == VECTOR) ? dim : 1;
+         // An empty lex_ordering (e.g. L2 tensor elements) is the identity
+         const bool lex_id = lex_ordering.Size() == 0;
+         auto lex = [&](int j) { return lex_id ? j : lex_ordering[j]; };
 
          for (int i = 0; i < nqpt; i++)
          {
@@ -682,7 +685,7 @@ const
             {
                for (int j = 0; j < dof; j++)
                {
-                  const double val = d2q.B[i + nqpt*(d+b_dim*lex_ordering[j])];
+                  const double val = d2q.B[i + nqpt*(d+b_dim*lex(j))];
                   d2q_new->B[i+nqpt*(d+b_dim*j)] = val;
                   d2q_new->Bt[j+dof*(i+nqpt*d)] = val;
                }
@@ -706,7 +709,7 @@ const
             {
                for (int j = 0; j < dof; j++)
                {
-                  const double val = d2q.G[i + nqpt*(d+g_dim*lex_ordering[j])];
+                  const double val = d2q.G[i + nqpt*(d+g_dim*lex(j))];
                   d2q_new->G[i+nqpt*(d+g_dim*j)] = val;
                   d2q_new->Gt[j+dof*(i+nqpt*d)] = val;
                }
@@ -51,6 +51,7 @@
 #include "hyperbolic.hpp"
 #include "bounds.hpp"
 #include "particleset.hpp"
+#include "kernel_autotuner.hpp"
 
 #include "dfem/doperator.hpp"
 
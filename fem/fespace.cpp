@@ -463,11 +463,16 @@ void FiniteElementSpace::RebuildElementToDofTable()
    delete elem_fos;
    elem_dof = NULL;
    elem_fos = NULL;
+   elem_coloring.reset();
    BuildElementToDofTable();
 }
 
 void FiniteElementSpace::ReorderElementToDofTable()
 {
+   // The boundary element DOFs are otherwise computed from the mesh entities,
+   // so build their table now and renumber it below, together with elem_dof.
+   BuildBdrElementToDofTable();
+
    Array<int> dof_marker(ndofs);
 
    dof_marker = -1;
@@ -485,6 +490,28 @@ void FiniteElementSpace::ReorderElementToDofTable()
       // Preserve the sign of sdof
       J[k] = (sdof < 0) ? FlipIndexSign(new_dof) : new_dof;
    }
+
+   for (Table *table : {bdr_elem_dof, face_dof})
+   {
+      if (!table) { continue; }
+      int *TJ = table->GetJ();
+      for (int k = 0; k < table->Size_of_connections(); k++)
+      {
+         const int sdof = TJ[k];
+         const int new_dof = dof_marker[UnsignIndex(sdof)];
+         TJ[k] = (sdof < 0) ? FlipIndexSign(new_dof) : new_dof;
+      }
+   }
+
+   // Discard the data computed with the previous numbering
+   dof_elem_array.DeleteAll();
+   dof_ldof_array.DeleteAll();
+   dof_bdr_elem_array.DeleteAll();
+   dof_bdr_ldof_array.DeleteAll();
+   L2E_nat.Clear();
+   L2E_lex.Clear();
+   L2F.clear();
+   interpolations.clear();
 }
 
 void FiniteElementSpace::BuildDofToArrays_() const
@@ -537,6 +564,125 @@ void FiniteElementSpace::BuildDofToBdrArrays() const
    }
 }
 
+void FiniteElementSpace::BuildElementColoring() const
+{
+   const int NE = GetNE();
+   const Table &e2d = GetElementToDofTable();
+
+   // The dof-to-element connectivity, ignoring the dof signs
+   Table d2e;
+   d2e.MakeI(ndofs);
+   for (int e = 0; e < NE; e++)
+   {
+      const int *dofs = e2d.GetRow(e);
+      for (int j = 0; j < e2d.RowSize(e); j++)
+      {
+         d2e.AddAColumnInRow(DecodeDof(dofs[j]));
+      }
+   }
+   d2e.MakeJ();
+   for (int e = 0; e < NE; e++)
+   {
+      const int *dofs = e2d.GetRow(e);
+      for (int j = 0; j < e2d.RowSize(e); j++)
+      {
+         d2e.AddConnection(DecodeDof(dofs[j]), e);
+      }
+   }
+   d2e.ShiftUpI();
+
+   // Speculative greedy coloring with conflict resolution: in each round, the
+   // elements in the work list are colored concurrently with the smallest
+   // color not used by their dof-neighbors; then, for each pair of neighbors
+   // that received the same color, the element with the larger index is put
+   // back in the work list for the next round. When running on one thread,
+   // this is the standard (sequential) greedy coloring.
+   Array<int> color(NE), work(NE), conflict(NE);
+   color = -1;
+   // The colors of the neighbors may be written concurrently while they are
+   // read, so these accesses are atomic
+   int *col = color.GetData();
+   for (int e = 0; e < NE; e++) { work[e] = e; }
+   while (work.Size() > 0)
+   {
+      const int nw = work.Size();
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel
+#endif
+      {
+         Array<int> forbidden; // forbidden[c] == e: color c is used by e's nbrs
+#ifdef MFEM_USE_OPENMP
+         #pragma omp for schedule(static)
+#endif
+         for (int k = 0; k < nw; k++)
+         {
+            const int e = work[k];
+            const int *dofs = e2d.GetRow(e);
+            for (int j = 0; j < e2d.RowSize(e); j++)
+            {
+               const int d = DecodeDof(dofs[j]);
+               const int *nbrs = d2e.GetRow(d);
+               for (int i = 0; i < d2e.RowSize(d); i++)
+               {
+                  int c;
+#ifdef MFEM_USE_OPENMP
+                  #pragma omp atomic read
+#endif
+                  c = col[nbrs[i]];
+                  if (nbrs[i] == e || c < 0) { continue; }
+                  while (forbidden.Size() <= c) { forbidden.Append(-1); }
+                  forbidden[c] = e;
+               }
+            }
+            int c = 0;
+            while (c < forbidden.Size() && forbidden[c] == e) { c++; }
+#ifdef MFEM_USE_OPENMP
+            #pragma omp atomic write
+#endif
+            col[e] = c;
+         }
+      }
+
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (int k = 0; k < nw; k++)
+      {
+         const int e = work[k];
+         const int *dofs = e2d.GetRow(e);
+         conflict[k] = 0;
+         for (int j = 0; j < e2d.RowSize(e) && !conflict[k]; j++)
+         {
+            const int d = DecodeDof(dofs[j]);
+            const int *nbrs = d2e.GetRow(d);
+            for (int i = 0; i < d2e.RowSize(d); i++)
+            {
+               if (nbrs[i] < e && color[nbrs[i]] == color[e])
+               {
+                  conflict[k] = 1;
+                  break;
+               }
+            }
+         }
+      }
+
+      int nc = 0;
+      for (int k = 0; k < nw; k++)
+      {
+         if (conflict[k]) { work[nc++] = work[k]; }
+      }
+      work.SetSize(nc);
+   }
+
+   const int num_colors = (NE > 0) ? color.Max() + 1 : 0;
+   elem_coloring.reset(new Table);
+   elem_coloring->MakeI(num_colors);
+   for (int e = 0; e < NE; e++) { elem_coloring->AddAColumnInRow(color[e]); }
+   elem_coloring->MakeJ();
+   for (int e = 0; e < NE; e++) { elem_coloring->AddConnection(color[e], e); }
+   elem_coloring->ShiftUpI();
+}
+
 void MarkDofs(const Array<int> &dofs, Array<int> &mark_array)
 {
    for (auto d : dofs)
@@ -4037,6 +4183,7 @@ void FiniteElementSpace::Destroy()
    dof_ldof_array.DeleteAll();
    dof_bdr_elem_array.DeleteAll();
    dof_bdr_ldof_array.DeleteAll();
+   elem_coloring.reset();
 
    for (int i = 0; i < VNURBSext.Size(); i++)
    {
@@ -4406,6 +4553,45 @@ void FiniteElementSpace::GetNodePositions(const Vector &mesh_nodes,
    }
 }
 
+MemoryReport FiniteElementSpace::GetMemoryReport() const
+{
+   MemoryReport report("FiniteElementSpace");
+
+   MemoryReport dofs("dof tables");
+   if (elem_dof) { dofs.Add("elem_dof", *elem_dof); }
+   if (elem_fos) { dofs.Add("elem_fos", *elem_fos); }
+   if (bdr_elem_dof) { dofs.Add("bdr_elem_dof", *bdr_elem_dof); }
+   if (bdr_elem_fos) { dofs.Add("bdr_elem_fos", *bdr_elem_fos); }
+   if (face_dof) { dofs.Add("face_dof", *face_dof); }
+   dofs.Add("var_edge_dofs", var_edge_dofs).Add("var_face_dofs", var_face_dofs);
+   dofs.Add("loc_var_edge_dofs", loc_var_edge_dofs)
+   .Add("loc_var_face_dofs", loc_var_face_dofs);
+   dofs.Add(all2local.GetMemory());
+   dofs.Add(dof_elem_array.GetMemory()).Add(dof_ldof_array.GetMemory());
+   dofs.Add(dof_bdr_elem_array.GetMemory()).Add(dof_bdr_ldof_array.GetMemory());
+   if (elem_coloring) { dofs.Add("elem_coloring", *elem_coloring); }
+   report.AddChild(dofs);
+
+   if (cP) { report.AddChild(cP->GetMemoryReport("cP")); }
+   if (cR) { report.AddChild(cR->GetMemoryReport("cR")); }
+   if (cR_hp) { report.AddChild(cR_hp->GetMemoryReport("cR_hp")); }
+
+   for (const OperatorHandle *L2E : {&L2E_nat, &L2E_lex})
+   {
+      const auto *er = dynamic_cast<const ElementRestriction*>(L2E->Ptr());
+      if (!er) { continue; }
+      report.AddChild(MemoryReport("ElementRestriction")
+                      .Add(er->Offsets().GetMemory())
+                      .Add(er->Indices().GetMemory())
+                      .Add(er->GatherMap().GetMemory()));
+   }
+   for (const QuadratureInterpolator *qi : E2Q_array)
+   {
+      report.AddChild(qi->GetMemoryReport());
+   }
+   return report;
+}
+
 void FiniteElementSpace::Save(std::ostream &os) const
 {
    int fes_format = 90; // the original format, v0.9
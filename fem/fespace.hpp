@@ -282,6 +282,9 @@ protected:
    mutable Array<int> dof_bdr_elem_array;
    mutable Array<int> dof_bdr_ldof_array;
 
+   /// Element coloring (color-to-elements Table), see GetElementColoring().
+   mutable std::unique_ptr<Table> elem_coloring;
+
    NURBSExtension *NURBSext;
    /** array of NURBS extension for H(div) and H(curl) vector elements.
        For each direction an extension is created from the base NURBSext,
@@ -373,6 +376,9 @@ protected:
       GetBdrElementForDof() and GetBdrLocalDofForDof(). */
    void BuildDofToBdrArrays() const;
 
+   /// Compute the element coloring returned by GetElementColoring().
+   void BuildElementColoring() const;
+
    /** @brief  Generates partial face_dof table for a NURBS space.
 
        The table is only defined for exterior faces that coincide with a
@@ -1267,7 +1273,17 @@ public:
        ordered in the Mesh; 2) for each element, assign new indices to all of
        its current DOFs that are still unassigned; the new indices we assign are
        simply the sequence `0,1,2,...`; if there are any signed DOFs their sign
-       is preserved. */
+       is preserved.
+
+       Combined with an element ordering along a space-filling curve (see
+       Mesh::GetHilbertElementOrdering and Mesh::ReorderElements), this
+       improves the memory locality of the element restriction used by
+       partial assembly. The element, boundary element and face DOF tables
+       are renumbered consistently, but the methods returning the DOFs of
+       vertices, edges and element interiors (e.g. GetVertexDofs) and the
+       conforming prolongation of nonconforming meshes still use the original
+       numbering. The method should be called right after the construction of
+       the space. */
    void ReorderElementToDofTable();
 
    const Table *GetElementToFaceOrientationTable() const { return elem_fos; }
@@ -1305,6 +1321,18 @@ public:
    /// Return the dof index within the boundary element from GetBdrElementForDof() for ldof index @a i.
    int GetBdrLocalDofForDof(int i) const { BuildDofToBdrArrays(); return dof_bdr_ldof_array[i]; }
 
+   /** @brief Return a coloring of the elements such that no two elements that
+       share a degree of freedom have the same color.
+
+       Row @a c of the returned Table lists, in increasing order, the elements
+       with color @a c. The coloring is computed (using OpenMP threads, when
+       available) on the first call and cached until the space is updated.
+       Scatter-add operations over the elements of one color are free of write
+       conflicts and can be performed concurrently, see
+       ElementRestriction::MultTranspose(). */
+   const Table &GetElementColoring() const
+   { if (!elem_coloring) { BuildElementColoring(); } return *elem_coloring; }
+
 
    /** @brief Returns pointer to the FiniteElement in the FiniteElementCollection
         associated with i'th element in the mesh object.
@@ -1460,7 +1488,12 @@ public:
    /** @brief Reflect changes in the mesh: update number of DOFs, etc. Also,
        calculate GridFunction transformation operator (unless want_transform is
        false). Safe to call multiple times, does nothing if space already up to
-       date. */
+       date.
+
+       The dof tables, the element and face restrictions and the conforming
+       prolongation are rebuilt for the whole mesh, even after a local
+       refinement; only the geometric factors cached in the mesh are updated
+       incrementally, see GeometricFactors::Update(). */
    virtual void Update(bool want_transform = true);
 
    /** P-refine and update the space. If @a want_transfer, also maintain the old
@@ -1561,6 +1594,11 @@ public:
        FiniteElementCollection is owned by the caller. */
    FiniteElementCollection *Load(Mesh *m, std::istream &input);
 
+   /** @brief Return a report of the memory held by the space: dof tables,
+       conforming prolongation and restriction matrices, element restrictions
+       and quadrature interpolators. */
+   virtual MemoryReport GetMemoryReport() const;
+
    virtual ~FiniteElementSpace();
 };
 
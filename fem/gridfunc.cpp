@@ -18,6 +18,7 @@
 #include "transfer.hpp"
 #include "../mesh/nurbs.hpp"
 #include "../mesh/vtkhdf.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/text.hpp"
 
 #ifdef MFEM_USE_MPI
@@ -78,6 +79,29 @@ GridFunction::GridFunction(Mesh *m, std::istream &input)
    fes_sequence = fes->GetSequence();
 }
 
+GridFunction::GridFunction(Mesh *m, const BinarySectionReader &input)
+   : Vector()
+{
+   MFEM_VERIFY(input.GetType() == "MFEM binary grid function v1.0",
+               "invalid binary grid function: " << input.GetType());
+
+   // Grid functions are stored on the device
+   UseDevice(true);
+
+   fec_owned = FiniteElementCollection::New(input.GetString("fec").c_str());
+   const int vdim = input.GetValue<int>("vdim");
+   const auto ordering =
+      static_cast<Ordering::Type>(input.GetValue<int>("ordering"));
+   fes = new FiniteElementSpace(m, fec_owned, vdim, ordering);
+
+   std::size_t size;
+   real_t *gf_data = input.GetData<real_t>("data", size);
+   MFEM_VERIFY(size == std::size_t(fes->GetVSize()),
+               "invalid binary grid function: wrong data size");
+   SetDataAndSize(gf_data, int(size));
+   fes_sequence = fes->GetSequence();
+}
+
 GridFunction::GridFunction(Mesh *m, GridFunction *gf_array[], int num_pieces)
 {
    UseDevice(true);
@@ -4332,6 +4356,25 @@ void GridFunction::Save(const char *fname, int precision) const
    Save(ofs);
 }
 
+void GridFunction::SaveBinary(std::ostream &os) const
+{
+   MFEM_VERIFY(!fes->GetNURBSext(),
+               "NURBS spaces are not supported by the binary format");
+   BinarySectionWriter out;
+   out.AddString("fec", fes->FEColl()->Name());
+   out.AddValue("vdim", fes->GetVDim());
+   out.AddValue("ordering", int(fes->GetOrdering()));
+   out.Add("data", HostRead(), std::size_t(Size()));
+   out.Write(os, "MFEM binary grid function v1.0");
+}
+
+void GridFunction::SaveBinary(const std::string &fname) const
+{
+   ofstream ofs(fname, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << fname);
+   SaveBinary(ofs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void GridFunction::Save(adios2stream &os,
                         const std::string& variable_name,
@@ -141,6 +141,16 @@ public:
        are owned by the GridFunction. */
    GridFunction(Mesh *m, std::istream &input);
 
+   /** @brief Construct a GridFunction on the given Mesh, using the data of a
+       file written by SaveBinary().
+
+       The data is not copied: the GridFunction references the section "data"
+       of @a input, which must outlive it (or until the data is reallocated,
+       e.g. by SetSize()). When @a input is memory mapped, this avoids reading
+       the file. The reconstructed FiniteElementSpace and
+       FiniteElementCollection are owned by the GridFunction. */
+   GridFunction(Mesh *m, const BinarySectionReader &input);
+
    GridFunction(Mesh *m, GridFunction *gf_array[], int num_pieces);
 
    /// Copy assignment. Only the data of the base class Vector is copied.
@@ -1746,6 +1756,14 @@ public:
    /// ASCII output.
    virtual void Save(const char *fname, int precision=16) const;
 
+   /** @brief Save the GridFunction to a stream using the "MFEM binary grid
+       function v1.0" format, see BinarySectionWriter. The stream must be opened
+       in binary mode. NURBS spaces are not supported. */
+   void SaveBinary(std::ostream &out) const;
+
+   /// Save the GridFunction to a file using SaveBinary().
+   void SaveBinary(const std::string &fname) const;
+
 #ifdef MFEM_USE_ADIOS2
    /// Save the GridFunction to a binary output stream using adios2 bp format.
    virtual void Save(adios2stream &out, const std::string& variable_name,
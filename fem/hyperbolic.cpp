@@ -27,8 +27,11 @@ HyperbolicFormIntegrator::HyperbolicFormIntegrator(
      fluxFunction(numFlux.GetFluxFunction()),
      IntOrderOffset(IntOrderOffset),
      sign(sign),
+     maps(nullptr), face_maps(nullptr),
+     dim(0), ne(0), nq(0), nf(0), nfq(0),
      num_equations(fluxFunction.num_equations)
 {
+   q_speed.UseDevice(true);
 #ifndef MFEM_THREAD_SAFE
    state.SetSize(num_equations);
    flux.SetSize(num_equations, fluxFunction.dim);
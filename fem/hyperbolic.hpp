@@ -177,6 +177,51 @@ public:
                                         ElementTransformation &Tr,
                                         DenseMatrix &JDotN) const;
 
+   /**
+    * @brief Returns true if the batched evaluation methods ComputeFluxBatch()
+    * and ComputeFluxDotNBatch() are implemented by the derived class.
+    *
+    * Batched evaluation is required by the partial assembly (PA) path of
+    * HyperbolicFormIntegrator.
+    */
+   virtual bool SupportsBatchedEval() const { return false; }
+
+   /**
+    * @brief Compute flux F(u) at a batch of points. Optionally overloaded in a
+    * derived class to enable partial assembly.
+    *
+    * Used in HyperbolicFormIntegrator::AddMultPA() for evaluation of (F(u),
+    * ∇v) at all quadrature points of all elements at once. The evaluation is
+    * performed on the device, see mfem::forall().
+    * @param[in] states states at the points (num_equations, NP)
+    * @param[out] fluxes fluxes at the points (num_equations, dim, NP)
+    * @param[out] speeds maximum characteristic speed |dF(u,x)/du| at the
+    * points (NP)
+    */
+   virtual void ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                                 Vector &speeds) const
+   { MFEM_ABORT("Not Implemented."); }
+
+   /**
+    * @brief Compute normal flux F(u)⋅n at a batch of points. Optionally
+    * overloaded in a derived class to enable partial assembly.
+    *
+    * Used in the batched evaluation of NumericalFlux, see
+    * NumericalFlux::EvalBatch(). The evaluation is performed on the device,
+    * see mfem::forall().
+    * @param[in] states states at the points (num_equations, NP)
+    * @param[in] normals normal vectors at the points, usually not unit
+    * vectors (dim, NP)
+    * @param[out] fluxesDotN normal fluxes at the points (num_equations, NP)
+    * @param[out] speeds maximum (normal) characteristic speed |dF(u,x)/du⋅n|
+    * at the points (NP)
+    */
+   virtual void ComputeFluxDotNBatch(const Vector &states,
+                                     const Vector &normals,
+                                     Vector &fluxesDotN,
+                                     Vector &speeds) const
+   { MFEM_ABORT("Not Implemented."); }
+
 private:
 #ifndef MFEM_THREAD_SAFE
    mutable DenseMatrix flux;
@@ -282,6 +327,32 @@ public:
                             DenseMatrix &grad) const
    { MFEM_ABORT("Not implemented."); }
 
+   /**
+    * @brief Returns true if the batched evaluation EvalBatch() is implemented
+    * by the derived class and supported by the flux function.
+    */
+   virtual bool SupportsBatchedEval() const { return false; }
+
+   /**
+    * @brief Evaluates normal numerical flux at a batch of points. Optionally
+    * overloaded in a derived class to enable partial assembly.
+    *
+    * Used in HyperbolicFormIntegrator::AddMultPAInteriorFaces() for
+    * evaluation of <F̂(u⁻,u⁺,x) n, [v]> at all quadrature points of all
+    * interior faces at once.
+    * @param[in] states1 state values at the points from the first element
+    * (num_equations, NP)
+    * @param[in] states2 state values at the points from the second element
+    * (num_equations, NP)
+    * @param[in] nors scaled normal vectors, see mfem::CalcOrtho() (dim, NP)
+    * @param[out] fluxes numerical fluxes (num_equations, NP)
+    * @param[out] speeds maximum characteristic speeds |dF(u,x)/du⋅n| (NP)
+    */
+   virtual void EvalBatch(const Vector &states1, const Vector &states2,
+                          const Vector &nors, Vector &fluxes,
+                          Vector &speeds) const
+   { MFEM_ABORT("Not implemented."); }
+
    virtual ~NumericalFlux() = default;
 
    /// @brief Get flux function F
@@ -311,8 +382,19 @@ private:
    const int IntOrderOffset; // integration order offset, 2*p + IntOrderOffset.
    const real_t sign;
 
-   // The maximum characteristic speed, updated during element/face vector assembly
-   real_t max_char_speed;
+   // The maximum characteristic speed, updated during element/face vector
+   // assembly and during the partially assembled action
+   mutable real_t max_char_speed;
+
+   // PA extension
+   const DofToQuad *maps;       // element maps, TENSOR
+   const DofToQuad *face_maps;  // face maps, TENSOR
+   int dim, ne, nq, nf, nfq;
+   Vector pa_data;              // w*sign*adj(J) (nq, dim, dim, ne)
+   Vector pa_face_nor;          // scaled normals (dim, nfq, nf)
+   Vector pa_face_w;            // quadrature weights times sign (nfq)
+   // Work vectors at the quadrature points
+   mutable Vector q_state, q_state2, q_flux, q_speed;
 
 #ifndef MFEM_THREAD_SAFE
    // Local storage for element integration
@@ -410,6 +492,44 @@ public:
                          const FiniteElement &el2,
                          FaceElementTransformations &Tr,
                          const Vector &elfun, DenseMatrix &elmat) override;
+
+   using NonlinearFormIntegrator::AssemblePA;
+
+   /**
+    * @brief Partial assembly of the element term (F(u), ∇v).
+    *
+    * Requires batched evaluation of the flux function, see
+    * FluxFunction::SupportsBatchedEval().
+    * @param[in] fes finite element space of the state (vdim = num_equations)
+    */
+   void AssemblePA(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partially assembled action of the element term (F(u), ∇v).
+    *
+    * Both @a x and @a y are E-vectors in lexicographic ordering. The maximum
+    * characteristic speed is updated.
+    */
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   /**
+    * @brief Partial assembly of the interior face term <-F̂(u⁻,u⁺,x) n, [v]>.
+    *
+    * Requires batched evaluation of the numerical flux, see
+    * NumericalFlux::SupportsBatchedEval(), and tensor-product elements.
+    * @param[in] fes finite element space of the state (vdim = num_equations)
+    */
+   void AssemblePAInteriorFaces(const FiniteElementSpace &fes) override;
+
+   /**
+    * @brief Partially assembled action of the interior face term
+    * <-F̂(u⁻,u⁺,x) n, [v]>.
+    *
+    * Both @a x and @a y are double-valued face E-vectors in lexicographic
+    * ordering, see L2FaceRestriction. The maximum characteristic speed is
+    * updated.
+    */
+   void AddMultPAInteriorFaces(const Vector &x, Vector &y) const override;
 };
 
 /**
@@ -691,11 +811,33 @@ public:
                     const Vector &nor, FaceElementTransformations &Tr,
                     DenseMatrix &grad) const override;
 
+   bool SupportsBatchedEval() const override
+   { return fluxFunction.SupportsBatchedEval(); }
+
+   /**
+    * @brief  Normal numerical flux F̂(u⁻,u⁺,x) n at a batch of points
+    * @note Systems of equations are treated component-wise
+    *
+    * @param[in] states1 state values (u⁻) from the first element
+    * (num_equations, NP)
+    * @param[in] states2 state values (u⁺) from the second element
+    * (num_equations, NP)
+    * @param[in] nors normal vectors (not unit vectors) (dim, NP)
+    * @param[out] fluxes F̂ n = ½(F(u⁺,x)n + F(u⁻,x)n) - ½λ(u⁺ - u⁻)
+    * (num_equations, NP)
+    * @param[out] speeds max(|dF(u⁺,x)/du⁺⋅n|, |dF(u⁻,x)/du⁻⋅n|) (NP)
+    */
+   void EvalBatch(const Vector &states1, const Vector &states2,
+                  const Vector &nors, Vector &fluxes,
+                  Vector &speeds) const override;
+
 protected:
 #ifndef MFEM_THREAD_SAFE
    mutable Vector fluxN1, fluxN2;
    mutable DenseMatrix JDotN;
 #endif
+   // Work vectors for EvalBatch()
+   mutable Vector fluxesN2, speeds2;
 };
 
 /**
@@ -801,11 +943,33 @@ public:
                     const Vector &nor, FaceElementTransformations &Tr,
                     DenseMatrix &grad) const override;
 
+   bool SupportsBatchedEval() const override
+   { return fluxFunction.SupportsBatchedEval(); }
+
+   /**
+    * @brief  Normal numerical flux F̂(u⁻,u⁺,x) n at a batch of points
+    * @note Systems of equations are treated component-wise
+    *
+    * @param[in] states1 state values (u⁻) from the first element
+    * (num_equations, NP)
+    * @param[in] states2 state values (u⁺) from the second element
+    * (num_equations, NP)
+    * @param[in] nors normal vectors (not unit vectors) (dim, NP)
+    * @param[out] fluxes F̂ n = min(F(u⁻,x)n, F(u⁺,x)n) for u⁻ ≤ u⁺,
+    * or F̂ n = max(F(u⁻,x)n, F(u⁺,x)n) for u⁻ > u⁺ (num_equations, NP)
+    * @param[out] speeds max(|dF(u⁺,x)/du⁺⋅n|, |dF(u⁻,x)/du⁻⋅n|) (NP)
+    */
+   void EvalBatch(const Vector &states1, const Vector &states2,
+                  const Vector &nors, Vector &fluxes,
+                  Vector &speeds) const override;
+
 protected:
 #ifndef MFEM_THREAD_SAFE
    mutable Vector fluxN1, fluxN2;
    mutable DenseMatrix JDotN;
 #endif
+   // Work vectors for EvalBatch()
+   mutable Vector fluxesN2, speeds2;
 };
 
 /// Advection flux
@@ -905,6 +1069,22 @@ public:
                                 const Vector &normal,
                                 ElementTransformation &Tr,
                                 DenseMatrix &JDotN) const override;
+
+   /**
+    * @brief Batched evaluation is supported only for constant velocity, i.e.
+    * when the velocity coefficient is a VectorConstantCoefficient.
+    */
+   bool SupportsBatchedEval() const override;
+
+   /// Compute F(u) at a batch of points, see FluxFunction::ComputeFluxBatch().
+   void ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                         Vector &speeds) const override;
+
+   /// Compute F(u) n at a batch of points, see
+   /// FluxFunction::ComputeFluxDotNBatch().
+   void ComputeFluxDotNBatch(const Vector &states, const Vector &normals,
+                             Vector &fluxesDotN,
+                             Vector &speeds) const override;
 };
 
 /// Burgers flux
@@ -997,6 +1177,20 @@ public:
                                 const Vector &normal,
                                 ElementTransformation &Tr,
                                 DenseMatrix &JDotN) const override;
+
+   /// Batched evaluation is supported, see FluxFunction::ComputeFluxBatch().
+   bool SupportsBatchedEval() const override
+   { return true; }
+
+   /// Compute F(u) at a batch of points, see FluxFunction::ComputeFluxBatch().
+   void ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                         Vector &speeds) const override;
+
+   /// Compute F(u) n at a batch of points, see
+   /// FluxFunction::ComputeFluxDotNBatch().
+   void ComputeFluxDotNBatch(const Vector &states, const Vector &normals,
+                             Vector &fluxesDotN,
+                             Vector &speeds) const override;
 };
 
 /// Shallow water flux
@@ -1039,6 +1233,20 @@ public:
    real_t ComputeFluxDotN(const Vector &state, const Vector &normal,
                           FaceElementTransformations &Tr,
                           Vector &fluxN) const override;
+
+   /// Batched evaluation is supported, see FluxFunction::ComputeFluxBatch().
+   bool SupportsBatchedEval() const override
+   { return true; }
+
+   /// Compute F(u) at a batch of points, see FluxFunction::ComputeFluxBatch().
+   void ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                         Vector &speeds) const override;
+
+   /// Compute F(u) n at a batch of points, see
+   /// FluxFunction::ComputeFluxDotNBatch().
+   void ComputeFluxDotNBatch(const Vector &states, const Vector &normals,
+                             Vector &fluxesDotN,
+                             Vector &speeds) const override;
 };
 
 /// Euler flux
@@ -1083,6 +1291,20 @@ public:
    real_t ComputeFluxDotN(const Vector &x, const Vector &normal,
                           FaceElementTransformations &Tr,
                           Vector &fluxN) const override;
+
+   /// Batched evaluation is supported, see FluxFunction::ComputeFluxBatch().
+   bool SupportsBatchedEval() const override
+   { return true; }
+
+   /// Compute F(u) at a batch of points, see FluxFunction::ComputeFluxBatch().
+   void ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                         Vector &speeds) const override;
+
+   /// Compute F(u) n at a batch of points, see
+   /// FluxFunction::ComputeFluxDotNBatch().
+   void ComputeFluxDotNBatch(const Vector &states, const Vector &normals,
+                             Vector &fluxesDotN,
+                             Vector &speeds) const override;
 };
 
 } // namespace mfem
@@ -221,8 +221,7 @@ void ConvectionIntegrator::AssembleDiagonalPA(Vector &diag)
    }
    else
    {
-      MFEM_ABORT("AssembleDiagonalPA not yet implemented for"
-                 " ConvectionIntegrator.");
+      ProbeDiagonalPA(ne, diag);
    }
 }
 
@@ -356,83 +356,6 @@ static void PADGDiffusionSetupFaceInfo2D(const int nf, const Mesh &mesh,
    }
 }
 
-// Assigns to perm the permutation:
-//    perm[0] <- normal component
-//    perm[1] <- first tangential component
-//    perm[2] <- second tangential component
-//
-// (Tangential components are ordering lexicographically).
-inline void FaceNormalPermutation(int perm[3], const int face_id)
-{
-   const bool xy_plane = (face_id == 0 || face_id == 5);
-   const bool xz_plane = (face_id == 1 || face_id == 3);
-   // const bool yz_plane = (face_id == 2 || face_id == 4);
-
-   perm[0] = (xy_plane) ? 3 : (xz_plane) ? 2 : 1;
-   perm[1] = (xy_plane || xz_plane) ? 1 : 2;
-   perm[2] = (xy_plane) ? 2 : 3;
-}
-
-// Assigns to perm the permutation as in FaceNormalPermutation for the second
-// element on the face but signed to indicate the sign of the normal derivative.
-inline void SignedFaceNormalPermutation(int perm[3], const int face_id1,
-                                        const int face_id2,
-                                        const int orientation)
-{
-   FaceNormalPermutation(perm, face_id2);
-
-   // Sets perm according to the inverse of PermuteFace3D
-   if (face_id2 == 3 || face_id2 == 4)
-   {
-      perm[1] *= -1;
-   }
-   else if (face_id2 == 0)
-   {
-      perm[2] *= -1;
-   }
-
-   switch (orientation)
-   {
-      case 1:
-         std::swap(perm[1], perm[2]);
-         break;
-      case 2:
-         std::swap(perm[1], perm[2]);
-         perm[1] *= -1;
-         break;
-      case 3:
-         perm[1] *= -1;
-         break;
-      case 4:
-         perm[1] *= -1;
-         perm[2] *= -1;
-         break;
-      case 5:
-         std::swap(perm[1], perm[2]);
-         perm[1] *= -1;
-         perm[2] *= -1;
-         break;
-      case 6:
-         std::swap(perm[1], perm[2]);
-         perm[2] *= -1;
-         break;
-      case 7:
-         perm[2] *= -1;
-         break;
-      default:
-         break;
-   }
-
-   if (face_id1 == 3 || face_id1 == 4)
-   {
-      perm[1] *= -1;
-   }
-   else if (face_id1 == 0)
-   {
-      perm[2] *= -1;
-   }
-}
-
 static void PADGDiffusionSetupFaceInfo3D(const int nf, const Mesh &mesh,
                                          const FaceType type,
                                          Array<int> &face_info_)
@@ -462,7 +385,7 @@ static void PADGDiffusionSetupFaceInfo3D(const int nf, const Mesh &mesh,
          face_info(_fid_, 0, fidx) = fid0;
          face_info(_or_, 0, fidx) = or0;
 
-         FaceNormalPermutation(&face_info(0, 0, fidx), fid0);
+         internal::FaceNormalPermutation(&face_info(0, 0, fidx), fid0);
 
          if (f_info.IsInterior())
          {
@@ -480,8 +403,8 @@ static void PADGDiffusionSetupFaceInfo3D(const int nf, const Mesh &mesh,
             face_info(_fid_, 1, fidx) = fid1;
             face_info(_or_, 1, fidx) = or1;
 
-            SignedFaceNormalPermutation(&face_info(0, 1, fidx), fid0, fid1,
-                                        or1);
+            internal::SignedFaceNormalPermutation(&face_info(0, 1, fidx),
+                                                  fid0, fid1, or1);
          }
          else
          {
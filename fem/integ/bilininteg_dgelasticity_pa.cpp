@@ -0,0 +1,708 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../../mesh/face_nbr_geom.hpp"
+#include "../fe/face_map_utils.hpp"
+#include "../bilininteg.hpp"
+#include "../qfunction.hpp"
+
+namespace mfem
+{
+
+// The face data, stored at each face quadrature point, is:
+//
+//    n            unit normal, pointing from element 0 to element 1 (DIM)
+//    pen          kappa * w * det(J_f) * {(lambda + 2 mu) det(J_f)/det(J_e)}
+//    lambda, mu   the coefficients evaluated in element 0 and element 1 (4)
+//    A0, A1       the inverse Jacobians of element 0 and element 1, scaled by
+//                 the face weight w * det(J_f) (halved for interior faces),
+//                 with rows permuted and signed to correspond to the normal
+//                 and tangential derivatives available on the face (2 DIM^2)
+//
+// The rows of A0 and A1 are ordered as (normal, first tangential, second
+// tangential), the tangential directions being the ones of the lexicographic
+// ordering of the face with respect to element 0, see FaceNormalPermutation().
+template <int DIM>
+static constexpr int PADGElasticityDataSize() { return 5 + DIM + 2*DIM*DIM; }
+
+template <int DIM>
+static void PADGElasticitySetup(const int Q1D, const int NE, const int NF,
+                                const Array<real_t> &w,
+                                const GeometricFactors &el_geom,
+                                const FaceGeometricFactors &face_geom,
+                                const FaceNeighborGeometricFactors *nbr_geom,
+                                const Vector &lambda_loc,
+                                const Vector &lambda_shared,
+                                const Vector &mu_loc, const Vector &mu_shared,
+                                const real_t kappa, Vector &pa_data,
+                                const Array<int> &face_info_)
+{
+   constexpr int NPA = PADGElasticityDataSize<DIM>();
+   const int NQ = (DIM == 2) ? Q1D : Q1D*Q1D;
+   const int NQV = NQ*Q1D;
+
+   const auto J_loc = Reshape(el_geom.J.Read(), NQV, DIM, DIM, NE);
+   const auto detJe_loc = Reshape(el_geom.detJ.Read(), NQV, NE);
+
+   const int n_nbr = nbr_geom ? nbr_geom->num_neighbor_elems : 0;
+   const auto J_shared = Reshape(nbr_geom ? nbr_geom->J.Read() : nullptr,
+                                 NQV, DIM, DIM, n_nbr);
+   const auto detJ_shared =
+      Reshape(nbr_geom ? nbr_geom->detJ.Read() : nullptr, NQV, n_nbr);
+
+   const auto detJf = Reshape(face_geom.detJ.Read(), NQ, NF);
+   const auto n = Reshape(face_geom.normal.Read(), NQ, DIM, NF);
+
+   // The coefficients are either constant, or given at the volume quadrature
+   // points of the local and of the face neighbor elements.
+   const bool const_lambda = (lambda_loc.Size() == 1);
+   const bool const_mu = (mu_loc.Size() == 1);
+   const auto L_loc = Reshape(lambda_loc.Read(), const_lambda ? 1 : NQV,
+                              const_lambda ? 1 : NE);
+   const auto M_loc = Reshape(mu_loc.Read(), const_mu ? 1 : NQV,
+                              const_mu ? 1 : NE);
+   const auto L_shared = Reshape(lambda_shared.Read(), NQV,
+                                 lambda_shared.Size() / NQV);
+   const auto M_shared = Reshape(mu_shared.Read(), NQV, mu_shared.Size() / NQV);
+
+   const auto W = w.Read();
+
+   // (perm[0], perm[1], perm[2], element_index, local_face_id, orientation)
+   const auto face_info = Reshape(face_info_.Read(), 6, 2, NF);
+   constexpr int _el_ = 3;  // offset in face_info for element index
+   constexpr int _fid_ = 4; // offset in face_info for local face id
+   constexpr int _or_ = 5;  // offset in face_info for orientation
+
+   auto pa = Reshape(pa_data.Write(), NPA, NQ, NF);
+
+   mfem::forall(NF*NQ, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int p = idx % NQ;
+      const int f = idx / NQ;
+
+      const int fid0 = face_info(_fid_, 0, f);
+      const int fid1 = face_info(_fid_, 1, f);
+      const int ortn = face_info(_or_, 1, f);
+      const bool interior = face_info(_el_, 1, f) >= 0;
+      const int nsides = interior ? 2 : 1;
+      const real_t factor = interior ? 0.5 : 1.0;
+
+      const real_t dJf = detJf(p, f);
+      const real_t wf = W[p] * dJf;
+
+      for (int d = 0; d < DIM; ++d) { pa(d, p, f) = n(p, d, f); }
+
+      real_t pen = 0.0;
+      for (int side = 0; side < 2; ++side)
+      {
+         real_t *A = &pa(DIM + 5 + side*DIM*DIM, p, f);
+         if (side == nsides)
+         {
+            pa(DIM + 1 + 2*side, p, f) = 0.0;
+            pa(DIM + 2 + 2*side, p, f) = 0.0;
+            for (int i = 0; i < DIM*DIM; ++i) { A[i] = 0.0; }
+            continue;
+         }
+
+         int e = face_info(_el_, side, f);
+         const bool shared = (e >= NE);
+         e = shared ? e - NE : e;
+
+         const int iv = internal::FaceIdxToVolIdx(DIM, p, Q1D, fid0, fid1,
+                                                  side, ortn);
+
+         real_t Je[DIM*DIM], adjJe[DIM*DIM];
+         for (int c = 0; c < DIM; ++c)
+         {
+            for (int r = 0; r < DIM; ++r)
+            {
+               Je[r + DIM*c] = shared ? J_shared(iv, r, c, e) : J_loc(iv, r, c, e);
+            }
+         }
+         kernels::CalcAdjugate<DIM>(Je, adjJe);
+         const real_t dJe = shared ? detJ_shared(iv, e) : detJe_loc(iv, e);
+
+         const real_t lam = const_lambda ? L_loc(0, 0) :
+                            shared ? L_shared(iv, e) : L_loc(iv, e);
+         const real_t mu = const_mu ? M_loc(0, 0) :
+                           shared ? M_shared(iv, e) : M_loc(iv, e);
+         pa(DIM + 1 + 2*side, p, f) = lam;
+         pa(DIM + 2 + 2*side, p, f) = mu;
+
+         const real_t val = factor * wf / dJe;
+         for (int k = 0; k < DIM; ++k)
+         {
+            const int perm_k = face_info(k, side, f);
+            const int row = (perm_k < 0 ? -perm_k : perm_k) - 1;
+            const real_t sgn = (perm_k < 0) ? -1.0 : 1.0;
+            for (int a = 0; a < DIM; ++a)
+            {
+               A[k + DIM*a] = sgn * val * adjJe[row + DIM*a];
+            }
+         }
+
+         pen += factor * (lam + 2.0*mu) * dJf / dJe;
+      }
+      pa(DIM, p, f) = kappa * wf * pen;
+   });
+}
+
+static void PADGElasticitySetupFaceInfo(const int dim, const int nf,
+                                        const Mesh &mesh, const FaceType type,
+                                        Array<int> &face_info_)
+{
+   const int ne = mesh.GetNE();
+
+   // face_info array has 12 entries per face, 6 for each of the adjacent
+   // elements: (perm[0], perm[1], perm[2], element_index, local_face_id,
+   // orientation), see PADGElasticitySetup().
+   face_info_.SetSize(nf * 12);
+   constexpr int _e_ = 3;   // offset for element index
+   constexpr int _fid_ = 4; // offset for local face id
+   constexpr int _or_ = 5;  // offset for orientation
+
+   // In 2D, the reference direction normal to the edge face_id.
+   auto normal_dir_2d = [](int face_id)
+   {
+      return (face_id == 1 || face_id == 3) ? 0 : 1;
+   };
+   // In 2D, the sign of the tangential direction of the edge face_id relative
+   // to the lexicographic ordering of the element.
+   auto tangent_sgn_2d = [](int face_id)
+   {
+      return (face_id == 0 || face_id == 1) ? 1 : -1;
+   };
+
+   int fidx = 0;
+   auto face_info = Reshape(face_info_.HostWrite(), 6, 2, nf);
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      auto f_info = mesh.GetFaceInformation(f);
+      if (!f_info.IsOfFaceType(type)) { continue; }
+
+      const int fid0 = f_info.element[0].local_face_id;
+      face_info(_e_, 0, fidx) = f_info.element[0].index;
+      face_info(_fid_, 0, fidx) = fid0;
+      face_info(_or_, 0, fidx) = f_info.element[0].orientation;
+      if (dim == 2)
+      {
+         const int nd = normal_dir_2d(fid0);
+         face_info(0, 0, fidx) = nd + 1;
+         face_info(1, 0, fidx) = (1 - nd) + 1;
+         face_info(2, 0, fidx) = 0;
+      }
+      else
+      {
+         internal::FaceNormalPermutation(&face_info(0, 0, fidx), fid0);
+      }
+
+      if (f_info.IsInterior())
+      {
+         const int fid1 = f_info.element[1].local_face_id;
+         const int or1 = f_info.element[1].orientation;
+         face_info(_e_, 1, fidx) = f_info.IsShared() ?
+                                   ne + f_info.element[1].index :
+                                   f_info.element[1].index;
+         face_info(_fid_, 1, fidx) = fid1;
+         face_info(_or_, 1, fidx) = or1;
+         if (dim == 2)
+         {
+            // The edge is always reversed in element 1 relative to element 0
+            const int nd = normal_dir_2d(fid1);
+            const int sgn = -tangent_sgn_2d(fid0) * tangent_sgn_2d(fid1);
+            face_info(0, 1, fidx) = nd + 1;
+            face_info(1, 1, fidx) = sgn * ((1 - nd) + 1);
+            face_info(2, 1, fidx) = 0;
+         }
+         else
+         {
+            internal::SignedFaceNormalPermutation(&face_info(0, 1, fidx),
+                                                  fid0, fid1, or1);
+         }
+      }
+      else
+      {
+         for (int i = 0; i < 6; ++i) { face_info(i, 1, fidx) = -1; }
+      }
+      fidx++;
+   }
+}
+
+// Evaluate the face terms at one quadrature point, with the face data @a pa of
+// the point. On input, @a u and @a du hold the values and the reference
+// derivatives (normal, then tangential) of the components of u on both sides;
+// they are overwritten with the corresponding test function coefficients.
+template <int DIM>
+MFEM_HOST_DEVICE inline void PADGElasticityQPoint(const real_t *pa,
+                                                  const real_t alpha,
+                                                  real_t (&u)[2][DIM],
+                                                  real_t (&du)[2][DIM][DIM])
+{
+   const real_t *nor = pa;
+   const real_t pen = pa[DIM];
+
+   real_t jump[DIM], avg[DIM];
+   real_t n_jump = 0.0;
+   for (int c = 0; c < DIM; ++c)
+   {
+      jump[c] = u[0][c] - u[1][c];
+      avg[c] = 0.0;
+      n_jump += nor[c] * jump[c];
+   }
+
+   // avg <- {sigma(u) n} * w * det(J_f)
+   for (int s = 0; s < 2; ++s)
+   {
+      const real_t lam = pa[DIM + 1 + 2*s];
+      const real_t mu = pa[DIM + 2 + 2*s];
+      const real_t *A = pa + DIM + 5 + s*DIM*DIM;
+
+      real_t grad[DIM][DIM];
+      real_t div = 0.0;
+      for (int c = 0; c < DIM; ++c)
+      {
+         for (int a = 0; a < DIM; ++a)
+         {
+            real_t gca = 0.0;
+            for (int k = 0; k < DIM; ++k) { gca += A[k + DIM*a] * du[s][c][k]; }
+            grad[c][a] = gca;
+         }
+         div += grad[c][c];
+      }
+      for (int c = 0; c < DIM; ++c)
+      {
+         real_t t = lam * div * nor[c];
+         for (int a = 0; a < DIM; ++a)
+         {
+            t += mu * (grad[c][a] + grad[a][c]) * nor[a];
+         }
+         avg[c] += t;
+      }
+   }
+
+   for (int s = 0; s < 2; ++s)
+   {
+      const real_t lam = pa[DIM + 1 + 2*s];
+      const real_t mu = pa[DIM + 2 + 2*s];
+      const real_t *A = pa + DIM + 5 + s*DIM*DIM;
+      const real_t sgn = (s == 0) ? 1.0 : -1.0;
+
+      // - < {sigma(u) n}, [v] > + kappa < h^{-1} {lambda + 2 mu} [u], [v] >
+      for (int c = 0; c < DIM; ++c)
+      {
+         u[s][c] = sgn * (pen * jump[c] - avg[c]);
+      }
+
+      // alpha < {sigma(v) n}, [u] >
+      for (int c = 0; c < DIM; ++c)
+      {
+         real_t F[DIM];
+         for (int a = 0; a < DIM; ++a)
+         {
+            F[a] = alpha * (mu * (jump[c] * nor[a] + nor[c] * jump[a]) +
+                            ((a == c) ? lam * n_jump : 0.0));
+         }
+         for (int k = 0; k < DIM; ++k)
+         {
+            real_t h = 0.0;
+            for (int a = 0; a < DIM; ++a) { h += A[k + DIM*a] * F[a]; }
+            du[s][c][k] = h;
+         }
+      }
+   }
+}
+
+template <int T_D1D = 0, int T_Q1D = 0>
+static void PADGElasticityApply2D(const int NF, const Array<real_t> &b,
+                                  const Array<real_t> &g, const real_t alpha,
+                                  const Vector &pa_data, const Vector &x_,
+                                  const Vector &dxdn_, Vector &y_,
+                                  Vector &dydn_, const int d1d = 0,
+                                  const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+
+   constexpr int NPA = PADGElasticityDataSize<2>();
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto G = Reshape(g.Read(), Q1D, D1D);
+   const auto pa = Reshape(pa_data.Read(), NPA, Q1D, NF);
+   const auto x = Reshape(x_.Read(), D1D, 2, 2, NF);
+   const auto dxdn = Reshape(dxdn_.Read(), D1D, 2, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, 2, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, 2, 2, NF);
+
+   mfem::forall(NF, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Values and reference derivatives (normal, then tangential) of the
+      // components of u at the face quadrature points, on both sides. They
+      // are overwritten with the corresponding test function coefficients.
+      real_t u[MQ1][2][2];
+      real_t du[MQ1][2][2][2];
+
+      for (int s = 0; s < 2; ++s)
+      {
+         for (int c = 0; c < 2; ++c)
+         {
+            for (int q = 0; q < Q1D; ++q)
+            {
+               real_t bu = 0.0, gu = 0.0, bdu = 0.0;
+               for (int d = 0; d < D1D; ++d)
+               {
+                  bu += B(q,d) * x(d,c,s,f);
+                  gu += G(q,d) * x(d,c,s,f);
+                  bdu += B(q,d) * dxdn(d,c,s,f);
+               }
+               u[q][s][c] = bu;
+               du[q][s][c][0] = bdu;
+               du[q][s][c][1] = gu;
+            }
+         }
+      }
+
+      for (int q = 0; q < Q1D; ++q)
+      {
+         PADGElasticityQPoint<2>(&pa(0,q,f), alpha, u[q], du[q]);
+      }
+
+      for (int s = 0; s < 2; ++s)
+      {
+         for (int c = 0; c < 2; ++c)
+         {
+            for (int d = 0; d < D1D; ++d)
+            {
+               real_t yv = 0.0, ydn = 0.0;
+               for (int q = 0; q < Q1D; ++q)
+               {
+                  yv += B(q,d) * u[q][s][c] + G(q,d) * du[q][s][c][1];
+                  ydn += B(q,d) * du[q][s][c][0];
+               }
+               y(d,c,s,f) += yv;
+               dydn(d,c,s,f) += ydn;
+            }
+         }
+      }
+   });
+}
+
+template <int T_D1D = 0, int T_Q1D = 0>
+static void PADGElasticityApply3D(const int NF, const Array<real_t> &b,
+                                  const Array<real_t> &g, const real_t alpha,
+                                  const Vector &pa_data, const Vector &x_,
+                                  const Vector &dxdn_, Vector &y_,
+                                  Vector &dydn_, const int d1d = 0,
+                                  const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+
+   constexpr int NPA = PADGElasticityDataSize<3>();
+   const auto b_ = Reshape(b.Read(), Q1D, D1D);
+   const auto g_ = Reshape(g.Read(), Q1D, D1D);
+   const auto pa = Reshape(pa_data.Read(), NPA, Q1D, Q1D, NF);
+   const auto x = Reshape(x_.Read(), D1D, D1D, 3, 2, NF);
+   const auto dxdn = Reshape(dxdn_.Read(), D1D, D1D, 3, 2, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, 3, 2, NF);
+   auto dydn = Reshape(dydn_.ReadWrite(), D1D, D1D, 3, 2, NF);
+
+   const int NBX = std::max(D1D, Q1D);
+
+   mfem::forall_2D(NF, NBX, NBX, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t G[MQ1][MD1];
+
+      // Values and reference derivatives (normal, then tangential) of the
+      // components of u at the face quadrature points, on both sides. They
+      // are overwritten with the corresponding test function coefficients.
+      MFEM_SHARED real_t u[MQ1][MQ1][2][3];
+      MFEM_SHARED real_t du[MQ1][MQ1][2][3][3];
+
+      // Partial contractions in the first direction
+      MFEM_SHARED real_t T0[MQ1][MQ1];
+      MFEM_SHARED real_t T1[MQ1][MQ1];
+      MFEM_SHARED real_t T2[MQ1][MQ1];
+
+      MFEM_FOREACH_THREAD(d,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(q,x,Q1D)
+         {
+            B[q][d] = b_(q,d);
+            G[q][d] = g_(q,d);
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      for (int s = 0; s < 2; ++s)
+      {
+         for (int c = 0; c < 3; ++c)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  real_t bu = 0.0, gu = 0.0, bdu = 0.0;
+                  for (int dx = 0; dx < D1D; ++dx)
+                  {
+                     bu += B[qx][dx] * x(dx,dy,c,s,f);
+                     gu += G[qx][dx] * x(dx,dy,c,s,f);
+                     bdu += B[qx][dx] * dxdn(dx,dy,c,s,f);
+                  }
+                  T0[dy][qx] = bu;
+                  T1[dy][qx] = gu;
+                  T2[dy][qx] = bdu;
+               }
+            }
+            MFEM_SYNC_THREAD;
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  real_t bbu = 0.0, bgu = 0.0, gbu = 0.0, bbdu = 0.0;
+                  for (int dy = 0; dy < D1D; ++dy)
+                  {
+                     bbu += B[qy][dy] * T0[dy][qx];
+                     bgu += B[qy][dy] * T1[dy][qx];
+                     gbu += G[qy][dy] * T0[dy][qx];
+                     bbdu += B[qy][dy] * T2[dy][qx];
+                  }
+                  u[qy][qx][s][c] = bbu;
+                  du[qy][qx][s][c][0] = bbdu;
+                  du[qy][qx][s][c][1] = bgu;
+                  du[qy][qx][s][c][2] = gbu;
+               }
+            }
+            MFEM_SYNC_THREAD;
+         }
+      }
+
+      MFEM_FOREACH_THREAD(qy,y,Q1D)
+      {
+         MFEM_FOREACH_THREAD(qx,x,Q1D)
+         {
+            PADGElasticityQPoint<3>(&pa(0,qx,qy,f), alpha, u[qy][qx],
+                                    du[qy][qx]);
+         }
+      }
+      MFEM_SYNC_THREAD;
+
+      for (int s = 0; s < 2; ++s)
+      {
+         for (int c = 0; c < 3; ++c)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  real_t bv = 0.0, bn = 0.0, bt = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     bv += B[qx][dx] * u[qy][qx][s][c] +
+                           G[qx][dx] * du[qy][qx][s][c][1];
+                     bn += B[qx][dx] * du[qy][qx][s][c][0];
+                     bt += B[qx][dx] * du[qy][qx][s][c][2];
+                  }
+                  T0[qy][dx] = bv;
+                  T1[qy][dx] = bn;
+                  T2[qy][dx] = bt;
+               }
+            }
+            MFEM_SYNC_THREAD;
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  real_t yv = 0.0, ydn = 0.0;
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     yv += B[qy][dy] * T0[qy][dx] + G[qy][dy] * T2[qy][dx];
+                     ydn += B[qy][dy] * T1[qy][dx];
+                  }
+                  y(dx,dy,c,s,f) += yv;
+                  dydn(dx,dy,c,s,f) += ydn;
+               }
+            }
+            MFEM_SYNC_THREAD;
+         }
+      }
+   });
+}
+
+void DGElasticityIntegrator::SetupPA(const FiniteElementSpace &fes,
+                                     FaceType type)
+{
+   MFEM_VERIFY(lambda && mu, "DGElasticityIntegrator: partial assembly "
+               "requires the Lame coefficients.");
+
+   const MemoryType mt =
+      (pa_mt == MemoryType::DEFAULT) ? Device::GetDeviceMemoryType() : pa_mt;
+
+   const int ne = fes.GetNE();
+   nf = fes.GetNFbyType(type);
+
+   // Assumes tensor-product elements
+   Mesh &mesh = *fes.GetMesh();
+   dim = mesh.Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "DGElasticityIntegrator: partial "
+               "assembly is supported only in 2D and 3D.");
+   MFEM_VERIFY(fes.GetVDim() == dim, "DGElasticityIntegrator: the vector "
+               "dimension of the space must be equal to the mesh dimension.");
+
+   const Geometry::Type face_geom_type = mesh.GetTypicalFaceGeometry();
+   const FiniteElement &el = *fes.GetTypicalTraceElement();
+   const int ir_order =
+      IntRule ? IntRule->GetOrder()
+      : IntRules.Get(face_geom_type, 2*el.GetOrder()).GetOrder();
+   const IntegrationRule &ir = irs.Get(face_geom_type, ir_order);
+   const int q1d = (ir.GetOrder() + 3) / 2;
+   MFEM_ASSERT(q1d == pow(real_t(ir.Size()), 1.0 / (dim - 1)), "");
+
+   const auto vol_ir = irs.Get(mesh.GetTypicalElementGeometry(), ir_order);
+   const auto geom_flags =
+      GeometricFactors::JACOBIANS | GeometricFactors::DETERMINANTS;
+   const auto el_geom = mesh.GetGeometricFactors(vol_ir, geom_flags, mt);
+
+   std::unique_ptr<FaceNeighborGeometricFactors> nbr_geom;
+   if (type == FaceType::Interior)
+   {
+      nbr_geom.reset(new FaceNeighborGeometricFactors(*el_geom));
+   }
+
+   const auto face_geom_flags =
+      FaceGeometricFactors::DETERMINANTS | FaceGeometricFactors::NORMALS;
+   auto face_geom = mesh.GetFaceGeometricFactors(ir, face_geom_flags, type, mt);
+   maps = &el.GetDofToQuad(ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   MFEM_VERIFY(quad1D == q1d, "");
+
+   // Evaluate the coefficients at the volume quadrature points, so that they
+   // are evaluated in the elements on both sides of the faces (the
+   // coefficients may be discontinuous across the faces).
+   QuadratureSpace qs(mesh, vol_ir);
+   CoefficientVector lambda_q(*lambda, qs, CoefficientStorage::CONSTANTS);
+   CoefficientVector mu_q(*mu, qs, CoefficientStorage::CONSTANTS);
+   Vector lambda_shared, mu_shared;
+   if (nbr_geom)
+   {
+      if (lambda_q.Size() > 1)
+      {
+         nbr_geom->ExchangeFaceNbrQVectors(lambda_q, lambda_shared, 1);
+      }
+      if (mu_q.Size() > 1)
+      {
+         nbr_geom->ExchangeFaceNbrQVectors(mu_q, mu_shared, 1);
+      }
+   }
+
+   Array<int> face_info;
+   PADGElasticitySetupFaceInfo(dim, nf, mesh, type, face_info);
+
+   if (dim == 2)
+   {
+      const int npa = PADGElasticityDataSize<2>();
+      pa_data.SetSize(npa * quad1D * nf, Device::GetMemoryType());
+      PADGElasticitySetup<2>(quad1D, ne, nf, ir.GetWeights(), *el_geom,
+                             *face_geom, nbr_geom.get(), lambda_q,
+                             lambda_shared, mu_q, mu_shared, kappa, pa_data,
+                             face_info);
+   }
+   else
+   {
+      const int npa = PADGElasticityDataSize<3>();
+      pa_data.SetSize(npa * quad1D * quad1D * nf, Device::GetMemoryType());
+      PADGElasticitySetup<3>(quad1D, ne, nf, ir.GetWeights(), *el_geom,
+                             *face_geom, nbr_geom.get(), lambda_q,
+                             lambda_shared, mu_q, mu_shared, kappa, pa_data,
+                             face_info);
+   }
+}
+
+void DGElasticityIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Interior);
+}
+
+void DGElasticityIntegrator::AssemblePABoundaryFaces(
+   const FiniteElementSpace &fes)
+{
+   SetupPA(fes, FaceType::Boundary);
+}
+
+void DGElasticityIntegrator::AddMultPAFaceNormalDerivatives(
+   const Vector &x, const Vector &dxdn, Vector &y, Vector &dydn) const
+{
+   if (nf == 0) { return; }
+   ApplyPAKernels::Run(dim, dofs1D, quad1D, nf, maps->B, maps->G, alpha,
+                       pa_data, x, dxdn, y, dydn, dofs1D, quad1D);
+}
+
+DGElasticityIntegrator::DGElasticityIntegrator(real_t alpha_, real_t kappa_)
+   : lambda(NULL), mu(NULL), alpha(alpha_), kappa(kappa_)
+{
+   static Kernels kernels;
+}
+
+DGElasticityIntegrator::DGElasticityIntegrator(Coefficient &lambda_,
+                                               Coefficient &mu_,
+                                               real_t alpha_, real_t kappa_)
+   : DGElasticityIntegrator(alpha_, kappa_)
+{
+   lambda = &lambda_;
+   mu = &mu_;
+}
+
+/// \cond DO_NOT_DOCUMENT
+
+template <int DIM, int D1D, int Q1D>
+DGElasticityIntegrator::ApplyKernelType
+DGElasticityIntegrator::ApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2) { return PADGElasticityApply2D<D1D, Q1D>; }
+   else { return PADGElasticityApply3D<D1D, Q1D>; }
+}
+
+DGElasticityIntegrator::ApplyKernelType
+DGElasticityIntegrator::ApplyPAKernels::Fallback(int dim, int, int)
+{
+   if (dim == 2) { return PADGElasticityApply2D; }
+   else if (dim == 3) { return PADGElasticityApply3D; }
+   else { MFEM_ABORT(""); }
+}
+
+DGElasticityIntegrator::Kernels::Kernels()
+{
+   DGElasticityIntegrator::AddSpecialization<2, 2, 3>();
+   DGElasticityIntegrator::AddSpecialization<2, 3, 4>();
+   DGElasticityIntegrator::AddSpecialization<2, 4, 5>();
+   DGElasticityIntegrator::AddSpecialization<2, 5, 6>();
+
+   DGElasticityIntegrator::AddSpecialization<3, 2, 3>();
+   DGElasticityIntegrator::AddSpecialization<3, 3, 4>();
+   DGElasticityIntegrator::AddSpecialization<3, 4, 5>();
+   DGElasticityIntegrator::AddSpecialization<3, 5, 6>();
+}
+
+/// \endcond DO_NOT_DOCUMENT
+
+} // namespace mfem
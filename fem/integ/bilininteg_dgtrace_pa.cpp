@@ -247,6 +247,75 @@ void DGTraceIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
                         y, dofs1D, quad1D);
 }
 
+// PA DGTraceIntegrator face diagonal kernels: the two sides of a face only
+// couple through the off-diagonal blocks, so the diagonal of side 0 (resp. 1)
+// uses op(0,0) (resp. -op(1,0)) and the squared 1D basis values.
+static void PADGTraceDiagonal2D(const int D1D, const int Q1D, const int NF,
+                                const Array<real_t> &b, const Vector &op_,
+                                Vector &diag)
+{
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto op = Reshape(op_.Read(), Q1D, 2, 2, NF);
+   auto Y = Reshape(diag.ReadWrite(), D1D, 2, NF);
+
+   mfem::forall(D1D*NF, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int d = idx % D1D, f = idx / D1D;
+      real_t d0 = 0.0, d1 = 0.0;
+      for (int q = 0; q < Q1D; ++q)
+      {
+         const real_t BB = B(q,d) * B(q,d);
+         d0 += BB * op(q,0,0,f);
+         d1 -= BB * op(q,1,0,f);
+      }
+      Y(d,0,f) += d0;
+      Y(d,1,f) += d1;
+   });
+}
+
+static void PADGTraceDiagonal3D(const int D1D, const int Q1D, const int NF,
+                                const Array<real_t> &b, const Vector &op_,
+                                Vector &diag)
+{
+   const auto B = Reshape(b.Read(), Q1D, D1D);
+   const auto op = Reshape(op_.Read(), Q1D, Q1D, 2, 2, NF);
+   auto Y = Reshape(diag.ReadWrite(), D1D, D1D, 2, NF);
+
+   mfem::forall(D1D*D1D*NF, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int dx = idx % D1D, dy = (idx / D1D) % D1D, f = idx / (D1D*D1D);
+      real_t d0 = 0.0, d1 = 0.0;
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         const real_t BBy = B(qy,dy) * B(qy,dy);
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const real_t BB = B(qx,dx) * B(qx,dx) * BBy;
+            d0 += BB * op(qx,qy,0,0,f);
+            d1 -= BB * op(qx,qy,1,0,f);
+         }
+      }
+      Y(dx,dy,0,f) += d0;
+      Y(dx,dy,1,f) += d1;
+   });
+}
+
+void DGTraceIntegrator::AssembleDiagonalPAFaces(Vector &diag)
+{
+   if (nf == 0) { return; }
+   const int nd = (dim == 2) ? dofs1D : dofs1D*dofs1D;
+   MFEM_VERIFY(diag.Size() == 2*nd*nf,
+               "Vector spaces are not supported with DGTraceIntegrator.");
+   if (dim == 2)
+   {
+      PADGTraceDiagonal2D(dofs1D, quad1D, nf, maps->B, pa_data, diag);
+   }
+   else if (dim == 3)
+   {
+      PADGTraceDiagonal3D(dofs1D, quad1D, nf, maps->B, pa_data, diag);
+   }
+}
+
 DGTraceIntegrator::DGTraceIntegrator(real_t a, real_t b) : alpha(a), beta(b)
 {
    static Kernels kernels;
@@ -92,6 +92,29 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
 }
 
+void DiffusionIntegrator::AddMultPARange(const Vector &x, Vector &y,
+                                         int e_begin, int e_end) const
+{
+   MFEM_ASSERT(SupportsAddMultPARange(), "AddMultPARange is not supported");
+   const int n = e_end - e_begin;
+   if (n <= 0) { return; }
+   // the E-vectors and the PA data are ordered element by element
+   const int x_size = x.Size() / ne, d_size = pa_data.Size() / ne;
+   const Vector x_r(const_cast<Vector&>(x), e_begin*x_size, n*x_size);
+   Vector y_r(y, e_begin*x_size, n*x_size);
+   const Vector d_r(const_cast<Vector&>(pa_data), e_begin*d_size, n*d_size);
+   ApplyPAKernels::Run(dim, dofs1D, quad1D, n, symmetric, maps->B, maps->G,
+                       maps->Bt, maps->Gt, d_r, x_r, y_r, dofs1D, quad1D);
+}
+
+bool DiffusionIntegrator::SupportsAddMultPARange() const
+{
+#ifdef MFEM_USE_OCCA
+   if (DeviceCanUseOcca()) { return false; }
+#endif
+   return !DeviceCanUseCeed() && !fespace->UsesRaggedTensorBasis();
+}
+
 void DiffusionIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
 {
    if (symmetric)
@@ -115,4 +115,9 @@ void ElasticityComponentIntegrator::AddMultTransposePA(const Vector &x,
       *geom, *maps, x, *parent.q_vec, y, j_block, i_block);
 }
 
+void ElasticityComponentIntegrator::AssembleDiagonalPA(Vector &diag)
+{
+   ProbeDiagonalPA(fespace->GetNE(), diag);
+}
+
 } // namespace mfem
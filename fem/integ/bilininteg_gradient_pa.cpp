@@ -1130,4 +1130,10 @@ void GradientIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
                             x, y);
 }
 
+void GradientIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                 Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 } // namespace mfem
@@ -107,6 +107,12 @@ void MixedScalarCurlIntegrator::AddMultTransposePA(const Vector &x,
    }
 }
 
+void MixedScalarCurlIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                        Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 void MixedVectorCurlIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
                                            const FiniteElementSpace &test_fes)
 {
@@ -265,6 +271,12 @@ void MixedVectorCurlIntegrator::AddMultTransposePA(const Vector &x,
    }
 }
 
+void MixedVectorCurlIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                        Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 void MixedVectorWeakCurlIntegrator::AssemblePA(const FiniteElementSpace
                                                &trial_fes,
                                                const FiniteElementSpace &test_fes)
@@ -420,4 +432,10 @@ void MixedVectorWeakCurlIntegrator::AddMultTransposePA(const Vector &x,
    }
 }
 
+void MixedVectorWeakCurlIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                            Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 } // namespace mfem
@@ -0,0 +1,865 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../bilininteg.hpp"
+#include "../gridfunc.hpp"
+#include "../qfunction.hpp"
+
+/// \cond DO_NOT_DOCUMENT
+namespace mfem
+{
+
+// PA mixed scalar assemble kernel. The quadrature point data D is stored as
+// (NQ, NC, NE), where NC is 1 (value-value), DIM (value-gradient or
+// gradient-value) or DIM*DIM (gradient-gradient, with the test component
+// running fastest).
+static void PAMixedScalarSetup(const int dim,
+                               const int NQ,
+                               const int NE,
+                               const bool trial_grad,
+                               const bool test_grad,
+                               const Array<real_t> &w,
+                               const Vector &j,
+                               const Vector &c,
+                               const int cdim,
+                               const real_t alpha,
+                               Vector &op)
+{
+   const int NC = (trial_grad ? dim : 1)*(test_grad ? dim : 1);
+   const bool const_c = c.Size() == cdim;
+   const auto W = w.Read();
+   const auto J = Reshape(j.Read(), NQ, dim, dim, NE);
+   const auto C = const_c ? Reshape(c.Read(), cdim, 1, 1) :
+                  Reshape(c.Read(), cdim, NQ, NE);
+   auto y = Reshape(op.Write(), NQ, NC, NE);
+
+   mfem::forall(NE*NQ, [=] MFEM_HOST_DEVICE (int q_global)
+   {
+      const int e = q_global / NQ;
+      const int q = q_global % NQ;
+      real_t Jq[9], A[9];
+      for (int jj = 0; jj < dim; jj++)
+      {
+         for (int ii = 0; ii < dim; ii++)
+         {
+            Jq[ii + dim*jj] = J(q,ii,jj,e);
+         }
+      }
+      real_t detJ;
+      if (dim == 1)
+      {
+         detJ = Jq[0];
+         A[0] = 1.0;
+      }
+      else if (dim == 2)
+      {
+         detJ = kernels::Det<2>(Jq);
+         kernels::CalcAdjugate<2>(Jq, A);
+      }
+      else
+      {
+         detJ = kernels::Det<3>(Jq);
+         kernels::CalcAdjugate<3>(Jq, A);
+      }
+      auto coeff = [&](int k) { return const_c ? C(k,0,0) : C(k,q,e); };
+      const real_t wq = alpha * W[q];
+
+      if (!trial_grad && !test_grad)
+      {
+         // D = alpha * W * det(J) * Q
+         y(q,0,e) = wq * detJ * coeff(0);
+      }
+      else if (!trial_grad || !test_grad)
+      {
+         // D = alpha * W * det(J) * J^{-1} . V = alpha * W * adj(J) . V
+         for (int ii = 0; ii < dim; ii++)
+         {
+            real_t d = 0.0;
+            for (int k = 0; k < dim; k++) { d += A[ii + dim*k] * coeff(k); }
+            y(q,ii,e) = wq * d;
+         }
+      }
+      else
+      {
+         // D = alpha * W / det(J) * adj(J) . M . adj(J)^T, where M is a
+         // scalar, a diagonal matrix, or a full matrix (column-major)
+         for (int jj = 0; jj < dim; jj++)
+         {
+            for (int ii = 0; ii < dim; ii++)
+            {
+               real_t d = 0.0;
+               for (int l = 0; l < dim; l++)
+               {
+                  for (int k = 0; k < dim; k++)
+                  {
+                     const real_t M =
+                        (cdim == 1) ? ((k == l) ? coeff(0) : 0.0) :
+                        (cdim == dim) ? ((k == l) ? coeff(k) : 0.0) :
+                        coeff(k + dim*l);
+                     d += A[ii + dim*k] * M * A[jj + dim*l];
+                  }
+               }
+               y(q,ii + dim*jj,e) = wq / detJ * d;
+            }
+         }
+      }
+   });
+}
+
+// PA mixed scalar apply 1D kernel
+template<int GRAD_IN, int GRAD_OUT> static
+void PAMixedScalarApply1D(const int NE,
+                          const Array<real_t> &b_in,
+                          const Array<real_t> &g_in,
+                          const Array<real_t> &b_out,
+                          const Array<real_t> &g_out,
+                          const Vector &d_,
+                          const bool,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d,
+                          const int e1d,
+                          const int q1d)
+{
+   const int D1D = d1d;
+   const int E1D = e1d;
+   const int Q1D = q1d;
+   auto Bi = Reshape(GRAD_IN ? g_in.Read() : b_in.Read(), Q1D, D1D);
+   auto Bo = Reshape(GRAD_OUT ? g_out.Read() : b_out.Read(), Q1D, E1D);
+   auto D = Reshape(d_.Read(), Q1D, NE);
+   auto X = Reshape(x_.Read(), D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), E1D, NE);
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int max_Q1D = DofQuadLimits::MAX_Q1D;
+      real_t f[max_Q1D];
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         real_t u = 0.0;
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            u += Bi(qx,dx) * X(dx,e);
+         }
+         f[qx] = D(qx,e) * u;
+      }
+      for (int ex = 0; ex < E1D; ++ex)
+      {
+         real_t v = 0.0;
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            v += Bo(qx,ex) * f[qx];
+         }
+         Y(ex,e) += v;
+      }
+   });
+}
+
+// PA mixed scalar apply 2D kernel
+template<int GRAD_IN, int GRAD_OUT,
+         int T_D1D = 0, int T_E1D = 0, int T_Q1D = 0> static
+void PAMixedScalarApply2D(const int NE,
+                          const Array<real_t> &b_in,
+                          const Array<real_t> &g_in,
+                          const Array<real_t> &b_out,
+                          const Array<real_t> &g_out,
+                          const Vector &d_,
+                          const bool transpose,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int e1d = 0,
+                          const int q1d = 0)
+{
+   constexpr int DIM = 2;
+   // Number of components of the input and of the output at the quadrature
+   // points
+   constexpr int NI = GRAD_IN ? DIM : 1;
+   constexpr int NO = GRAD_OUT ? DIM : 1;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int E1D = T_E1D ? T_E1D : e1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(E1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto Bi = Reshape(b_in.Read(), Q1D, D1D);
+   auto Gi = Reshape(g_in.Read(), Q1D, D1D);
+   auto Bo = Reshape(b_out.Read(), Q1D, E1D);
+   auto Go = Reshape(g_out.Read(), Q1D, E1D);
+   auto D = Reshape(d_.Read(), Q1D, Q1D, NI*NO, NE);
+   auto X = Reshape(x_.Read(), D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), E1D, E1D, NE);
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int E1D = T_E1D ? T_E1D : e1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      // the following variables are evaluated at compile time
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_E1D = T_E1D ? T_E1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      real_t Bx[max_D1D][max_Q1D];
+      real_t Gx[max_D1D][max_Q1D];
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            real_t bx = 0.0, gx = 0.0;
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const real_t s = X(dx,dy,e);
+               bx += Bi(qx,dx) * s;
+               if (GRAD_IN) { gx += Gi(qx,dx) * s; }
+            }
+            Bx[dy][qx] = bx;
+            Gx[dy][qx] = gx;
+         }
+      }
+
+      real_t F[max_Q1D][max_Q1D][NO];
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            real_t u[NI];
+            for (int c = 0; c < NI; ++c) { u[c] = 0.0; }
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               if constexpr (GRAD_IN)
+               {
+                  u[0] += Bi(qy,dy) * Gx[dy][qx];
+                  u[NI-1] += Gi(qy,dy) * Bx[dy][qx];
+               }
+               else
+               {
+                  u[0] += Bi(qy,dy) * Bx[dy][qx];
+               }
+            }
+            for (int i = 0; i < NO; ++i)
+            {
+               real_t f = 0.0;
+               for (int j = 0; j < NI; ++j)
+               {
+                  f += D(qx,qy,transpose ? j + NI*i : i + NO*j,e) * u[j];
+               }
+               F[qy][qx][i] = f;
+            }
+         }
+      }
+
+      real_t Fy[max_Q1D][max_E1D][NO];
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         for (int ey = 0; ey < E1D; ++ey)
+         {
+            real_t t0 = 0.0, t1 = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               t0 += Bo(qy,ey) * F[qy][qx][0];
+               if constexpr (GRAD_OUT) { t1 += Go(qy,ey) * F[qy][qx][NO-1]; }
+            }
+            Fy[qx][ey][0] = t0;
+            Fy[qx][ey][NO-1] = GRAD_OUT ? t1 : t0;
+         }
+      }
+      for (int ey = 0; ey < E1D; ++ey)
+      {
+         for (int ex = 0; ex < E1D; ++ex)
+         {
+            real_t v = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               if constexpr (GRAD_OUT)
+               {
+                  v += Go(qx,ex) * Fy[qx][ey][0] + Bo(qx,ex) * Fy[qx][ey][1];
+               }
+               else
+               {
+                  v += Bo(qx,ex) * Fy[qx][ey][0];
+               }
+            }
+            Y(ex,ey,e) += v;
+         }
+      }
+   });
+}
+
+// PA mixed scalar apply 3D kernel
+template<int GRAD_IN, int GRAD_OUT,
+         int T_D1D = 0, int T_E1D = 0, int T_Q1D = 0> static
+void PAMixedScalarApply3D(const int NE,
+                          const Array<real_t> &b_in,
+                          const Array<real_t> &g_in,
+                          const Array<real_t> &b_out,
+                          const Array<real_t> &g_out,
+                          const Vector &d_,
+                          const bool transpose,
+                          const Vector &x_,
+                          Vector &y_,
+                          const int d1d = 0,
+                          const int e1d = 0,
+                          const int q1d = 0)
+{
+   constexpr int DIM = 3;
+   // Number of components of the input and of the output at the quadrature
+   // points
+   constexpr int NI = GRAD_IN ? DIM : 1;
+   constexpr int NO = GRAD_OUT ? DIM : 1;
+   // Number of partially contracted components of the input (output)
+   constexpr int PI = GRAD_IN ? 3 : 1;
+   constexpr int PO = GRAD_OUT ? 2 : 1;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int E1D = T_E1D ? T_E1D : e1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(E1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   auto Bi = Reshape(b_in.Read(), Q1D, D1D);
+   auto Gi = Reshape(g_in.Read(), Q1D, D1D);
+   auto Bo = Reshape(b_out.Read(), Q1D, E1D);
+   auto Go = Reshape(g_out.Read(), Q1D, E1D);
+   auto D = Reshape(d_.Read(), Q1D, Q1D, Q1D, NI*NO, NE);
+   auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), E1D, E1D, E1D, NE);
+
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int E1D = T_E1D ? T_E1D : e1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      // the following variables are evaluated at compile time
+      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_E1D = T_E1D ? T_E1D : DofQuadLimits::MAX_D1D;
+      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+
+      // Contract the input in x: B and G (if needed)
+      real_t Ux[max_D1D][max_D1D][max_Q1D][GRAD_IN ? 2 : 1];
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         for (int dy = 0; dy < D1D; ++dy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               real_t bx = 0.0, gx = 0.0;
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const real_t s = X(dx,dy,dz,e);
+                  bx += Bi(qx,dx) * s;
+                  if (GRAD_IN) { gx += Gi(qx,dx) * s; }
+               }
+               Ux[dz][dy][qx][0] = bx;
+               if constexpr (GRAD_IN) { Ux[dz][dy][qx][GRAD_IN] = gx; }
+            }
+         }
+      }
+
+      // Contract in y: BB, BG (x-derivative) and GB (y-derivative)
+      real_t Uy[max_D1D][max_Q1D][max_Q1D][PI];
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               real_t t[PI];
+               for (int c = 0; c < PI; ++c) { t[c] = 0.0; }
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  const real_t by = Bi(qy,dy);
+                  t[0] += by * Ux[dz][dy][qx][0];
+                  if constexpr (GRAD_IN)
+                  {
+                     t[GRAD_IN] += by * Ux[dz][dy][qx][GRAD_IN];
+                     t[PI-1] += Gi(qy,dy) * Ux[dz][dy][qx][0];
+                  }
+               }
+               for (int c = 0; c < PI; ++c) { Uy[dz][qy][qx][c] = t[c]; }
+            }
+         }
+      }
+
+      // Contract in z and apply the quadrature point data
+      real_t F[max_Q1D][max_Q1D][max_Q1D][NO];
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               real_t u[NI];
+               for (int c = 0; c < NI; ++c) { u[c] = 0.0; }
+               for (int dz = 0; dz < D1D; ++dz)
+               {
+                  const real_t bz = Bi(qz,dz);
+                  if constexpr (GRAD_IN)
+                  {
+                     u[0] += bz * Uy[dz][qy][qx][1];
+                     u[1] += bz * Uy[dz][qy][qx][PI-1];
+                     u[NI-1] += Gi(qz,dz) * Uy[dz][qy][qx][0];
+                  }
+                  else
+                  {
+                     u[0] += bz * Uy[dz][qy][qx][0];
+                  }
+               }
+               for (int i = 0; i < NO; ++i)
+               {
+                  real_t f = 0.0;
+                  for (int j = 0; j < NI; ++j)
+                  {
+                     f += D(qx,qy,qz,transpose ? j + NI*i : i + NO*j,e) * u[j];
+                  }
+                  F[qz][qy][qx][i] = f;
+               }
+            }
+         }
+      }
+
+      // Contract the output in z: B applied to the x and y components and G
+      // applied to the z component of the gradient
+      real_t Fz[max_E1D][max_Q1D][max_Q1D][NO];
+      for (int ez = 0; ez < E1D; ++ez)
+      {
+         for (int qy = 0; qy < Q1D; ++qy)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               real_t t[NO];
+               for (int c = 0; c < NO; ++c) { t[c] = 0.0; }
+               for (int qz = 0; qz < Q1D; ++qz)
+               {
+                  const real_t bz = Bo(qz,ez);
+                  t[0] += bz * F[qz][qy][qx][0];
+                  if constexpr (GRAD_OUT)
+                  {
+                     t[1] += bz * F[qz][qy][qx][1];
+                     t[NO-1] += Go(qz,ez) * F[qz][qy][qx][NO-1];
+                  }
+               }
+               for (int c = 0; c < NO; ++c) { Fz[ez][qy][qx][c] = t[c]; }
+            }
+         }
+      }
+
+      // Contract in y: the first component needs G in x, the second one
+      // combines the y and z components of the gradient, which need B in x
+      real_t Fy[max_E1D][max_E1D][max_Q1D][PO];
+      for (int ez = 0; ez < E1D; ++ez)
+      {
+         for (int ey = 0; ey < E1D; ++ey)
+         {
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               real_t t0 = 0.0, t1 = 0.0;
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const real_t by = Bo(qy,ey);
+                  t0 += by * Fz[ez][qy][qx][0];
+                  if constexpr (GRAD_OUT)
+                  {
+                     t1 += Go(qy,ey) * Fz[ez][qy][qx][1] +
+                           by * Fz[ez][qy][qx][NO-1];
+                  }
+               }
+               Fy[ez][ey][qx][0] = t0;
+               if constexpr (GRAD_OUT) { Fy[ez][ey][qx][PO-1] = t1; }
+            }
+         }
+      }
+
+      // Contract in x
+      for (int ez = 0; ez < E1D; ++ez)
+      {
+         for (int ey = 0; ey < E1D; ++ey)
+         {
+            for (int ex = 0; ex < E1D; ++ex)
+            {
+               real_t v = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  if constexpr (GRAD_OUT)
+                  {
+                     v += Go(qx,ex) * Fy[ez][ey][qx][0] +
+                          Bo(qx,ex) * Fy[ez][ey][qx][PO-1];
+                  }
+                  else
+                  {
+                     v += Bo(qx,ex) * Fy[ez][ey][qx][0];
+                  }
+               }
+               Y(ex,ey,ez,e) += v;
+            }
+         }
+      }
+   });
+}
+
+template <int DIM, int GRAD_IN, int GRAD_OUT, int T_D1D, int T_E1D, int T_Q1D>
+MixedScalarPAOperator::ApplyKernelType
+MixedScalarPAOperator::ApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2)
+   {
+      return PAMixedScalarApply2D<GRAD_IN, GRAD_OUT, T_D1D, T_E1D, T_Q1D>;
+   }
+   else if constexpr (DIM == 3)
+   {
+      return PAMixedScalarApply3D<GRAD_IN, GRAD_OUT, T_D1D, T_E1D, T_Q1D>;
+   }
+   MFEM_ABORT("");
+}
+
+MixedScalarPAOperator::ApplyKernelType
+MixedScalarPAOperator::ApplyPAKernels::Fallback(int DIM, int GRAD_IN,
+                                                int GRAD_OUT, int, int, int)
+{
+   const int k = 2*GRAD_IN + GRAD_OUT;
+   if (DIM == 1)
+   {
+      if (k == 0) { return PAMixedScalarApply1D<0,0>; }
+      if (k == 1) { return PAMixedScalarApply1D<0,1>; }
+      if (k == 2) { return PAMixedScalarApply1D<1,0>; }
+      return PAMixedScalarApply1D<1,1>;
+   }
+   else if (DIM == 2)
+   {
+      if (k == 0) { return PAMixedScalarApply2D<0,0>; }
+      if (k == 1) { return PAMixedScalarApply2D<0,1>; }
+      if (k == 2) { return PAMixedScalarApply2D<1,0>; }
+      return PAMixedScalarApply2D<1,1>;
+   }
+   else if (DIM == 3)
+   {
+      if (k == 0) { return PAMixedScalarApply3D<0,0>; }
+      if (k == 1) { return PAMixedScalarApply3D<0,1>; }
+      if (k == 2) { return PAMixedScalarApply3D<1,0>; }
+      return PAMixedScalarApply3D<1,1>;
+   }
+   MFEM_ABORT("Unsupported dimension: " << DIM);
+}
+
+MixedScalarPAOperator::Kernels::Kernels()
+{
+   // 2D, equal orders and test order one lower, with the quadrature rules
+   // used by the Mixed*Integrator classes on affine meshes
+   MixedScalarPAOperator::AddSpecialization<2,2,2,2>();
+   MixedScalarPAOperator::AddSpecialization<2,3,3,3>();
+   MixedScalarPAOperator::AddSpecialization<2,4,4,4>();
+   MixedScalarPAOperator::AddSpecialization<2,5,5,5>();
+   MixedScalarPAOperator::AddSpecialization<2,3,2,3>();
+   MixedScalarPAOperator::AddSpecialization<2,4,3,4>();
+   MixedScalarPAOperator::AddSpecialization<2,5,4,5>();
+   // 3D
+   MixedScalarPAOperator::AddSpecialization<3,2,2,3>();
+   MixedScalarPAOperator::AddSpecialization<3,3,3,4>();
+   MixedScalarPAOperator::AddSpecialization<3,4,4,5>();
+   MixedScalarPAOperator::AddSpecialization<3,3,2,3>();
+   MixedScalarPAOperator::AddSpecialization<3,4,3,4>();
+   MixedScalarPAOperator::AddSpecialization<3,5,4,5>();
+}
+
+void MixedScalarPAOperator::Setup(const FiniteElementSpace &trial_fes,
+                                  const FiniteElementSpace &test_fes,
+                                  const IntegrationRule &ir,
+                                  bool trial_grad_, bool test_grad_,
+                                  CoefficientVector &coeff,
+                                  real_t alpha)
+{
+   static Kernels kernels;
+
+   // Assumes tensor-product elements
+   Mesh *mesh = trial_fes.GetMesh();
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement*>(&trial_fe) &&
+               dynamic_cast<const TensorBasisElement*>(&test_fe),
+               "Only tensor-product elements are supported!");
+   MFEM_VERIFY(trial_fe.GetMapType() == FiniteElement::VALUE &&
+               test_fe.GetMapType() == FiniteElement::VALUE,
+               "Only finite elements with map type VALUE are supported!");
+   MFEM_VERIFY(mesh->SpaceDimension() == mesh->Dimension(),
+               "Embedded meshes are not supported!");
+
+   trial_grad = trial_grad_;
+   test_grad = test_grad_;
+   dim = mesh->Dimension();
+   ne = trial_fes.GetNE();
+   const int nq = ir.GetNPoints();
+   const MemoryType mt = Device::GetDeviceMemoryType();
+   const GeometricFactors *geom =
+      mesh->GetGeometricFactors(ir, GeometricFactors::JACOBIANS, mt);
+   trial_maps = &trial_fe.GetDofToQuad(ir, DofToQuad::TENSOR);
+   test_maps = &test_fe.GetDofToQuad(ir, DofToQuad::TENSOR);
+   trial_d1d = trial_maps->ndof;
+   test_d1d = test_maps->ndof;
+   quad1D = trial_maps->nqpt;
+
+   const int cdim = coeff.GetVDim();
+   if (trial_grad && test_grad)
+   {
+      MFEM_VERIFY(cdim == 1 || cdim == dim || cdim == dim*dim,
+                  "Invalid coefficient dimension: " << cdim);
+   }
+   else
+   {
+      MFEM_VERIFY(cdim == ((trial_grad || test_grad) ? dim : 1),
+                  "Invalid coefficient dimension: " << cdim);
+   }
+
+   const int nc = (trial_grad ? dim : 1)*(test_grad ? dim : 1);
+   pa_data.SetSize(nq * nc * ne, mt);
+   PAMixedScalarSetup(dim, nq, ne, trial_grad, test_grad, ir.GetWeights(),
+                      geom->J, coeff, cdim, alpha, pa_data);
+}
+
+void MixedScalarPAOperator::AddMult(const Vector &x, Vector &y) const
+{
+   ApplyPAKernels::Run(dim, trial_grad, test_grad, trial_d1d, test_d1d, quad1D,
+                       ne, trial_maps->B, trial_maps->G, test_maps->B,
+                       test_maps->G, pa_data, false, x, y, trial_d1d,
+                       test_d1d, quad1D);
+}
+
+void MixedScalarPAOperator::AddMultTranspose(const Vector &x,
+                                             Vector &y) const
+{
+   ApplyPAKernels::Run(dim, test_grad, trial_grad, test_d1d, trial_d1d, quad1D,
+                       ne, test_maps->B, test_maps->G, trial_maps->B,
+                       trial_maps->G, pa_data, true, x, y, test_d1d,
+                       trial_d1d, quad1D);
+}
+
+// Return the integration rule used by the Mixed*Integrator::AssemblePA methods,
+// the same as the one used by AssembleElementMatrix2: the rule prescribed by
+// the integrator, if any, and otherwise the rule of the given order.
+static const IntegrationRule &GetMixedPARule(const FiniteElement &trial_fe,
+                                             const IntegrationRule *ir,
+                                             int order)
+{
+   return ir ? *ir : IntRules.Get(trial_fe.GetGeomType(), order);
+}
+
+void MixedScalarMassIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
+                                           const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   CoefficientVector coeff(Q, qs, CoefficientStorage::CONSTANTS);
+   pa_op.Setup(trial_fes, test_fes, ir, false, false, coeff);
+}
+
+void MixedScalarMassIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedScalarMassIntegrator::AddMultTransposePA(const Vector &x,
+                                                   Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedScalarMassIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+void MixedScalarDerivativeIntegrator::AssemblePA(
+   const FiniteElementSpace &trial_fes, const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   CoefficientVector coeff(Q, qs, CoefficientStorage::CONSTANTS);
+   pa_op.Setup(trial_fes, test_fes, ir, true, false, coeff);
+}
+
+void MixedScalarDerivativeIntegrator::AddMultPA(const Vector &x,
+                                                Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedScalarDerivativeIntegrator::AddMultTransposePA(const Vector &x,
+                                                         Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedScalarDerivativeIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+void MixedScalarWeakDerivativeIntegrator::AssemblePA(
+   const FiniteElementSpace &trial_fes, const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   CoefficientVector coeff(Q, qs, CoefficientStorage::CONSTANTS);
+   pa_op.Setup(trial_fes, test_fes, ir, false, true, coeff, -1.0);
+}
+
+void MixedScalarWeakDerivativeIntegrator::AddMultPA(const Vector &x,
+                                                    Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedScalarWeakDerivativeIntegrator::AddMultTransposePA(const Vector &x,
+                                                             Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedScalarWeakDerivativeIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+void MixedDirectionalDerivativeIntegrator::AssemblePA(
+   const FiniteElementSpace &trial_fes, const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   CoefficientVector coeff(*VQ, qs, CoefficientStorage::CONSTANTS);
+   pa_op.Setup(trial_fes, test_fes, ir, true, false, coeff);
+}
+
+void MixedDirectionalDerivativeIntegrator::AddMultPA(const Vector &x,
+                                                     Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedDirectionalDerivativeIntegrator::AddMultTransposePA(
+   const Vector &x, Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedDirectionalDerivativeIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+void MixedScalarWeakDivergenceIntegrator::AssemblePA(
+   const FiniteElementSpace &trial_fes, const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   CoefficientVector coeff(*VQ, qs, CoefficientStorage::CONSTANTS);
+   pa_op.Setup(trial_fes, test_fes, ir, false, true, coeff, -1.0);
+}
+
+void MixedScalarWeakDivergenceIntegrator::AddMultPA(const Vector &x,
+                                                    Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedScalarWeakDivergenceIntegrator::AddMultTransposePA(
+   const Vector &x, Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedScalarWeakDivergenceIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+void MixedGradGradIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
+                                         const FiniteElementSpace &test_fes)
+{
+   const FiniteElement &trial_fe = *trial_fes.GetTypicalFE();
+   const FiniteElement &test_fe = *test_fes.GetTypicalFE();
+   ElementTransformation &T =
+      *trial_fes.GetMesh()->GetTypicalElementTransformation();
+   const IntegrationRule &ir =
+      GetMixedPARule(trial_fe, GetIntegrationRule(trial_fe, test_fe, T),
+                     GetIntegrationOrder(trial_fe, test_fe, T));
+   QuadratureSpace qs(*trial_fes.GetMesh(), ir);
+   MFEM_VERIFY(VQ == NULL, "Unsupported coefficient type!");
+   if (MQ)
+   {
+      CoefficientVector coeff(*MQ, qs, CoefficientStorage::CONSTANTS);
+      pa_op.Setup(trial_fes, test_fes, ir, true, true, coeff);
+   }
+   else if (DQ)
+   {
+      CoefficientVector coeff(*DQ, qs, CoefficientStorage::CONSTANTS);
+      pa_op.Setup(trial_fes, test_fes, ir, true, true, coeff);
+   }
+   else
+   {
+      CoefficientVector coeff(Q, qs, CoefficientStorage::CONSTANTS);
+      pa_op.Setup(trial_fes, test_fes, ir, true, true, coeff);
+   }
+}
+
+void MixedGradGradIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   pa_op.AddMult(x, y);
+}
+
+void MixedGradGradIntegrator::AddMultTransposePA(const Vector &x,
+                                                 Vector &y) const
+{
+   pa_op.AddMultTranspose(x, y);
+}
+
+void MixedGradGradIntegrator::AssembleDiagonalPA_ADAt(
+   const Vector &D, Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(pa_op.GetNE(), D, diag);
+}
+
+} // namespace mfem
+/// \endcond DO_NOT_DOCUMENT
@@ -758,4 +758,10 @@ void MixedVectorGradientIntegrator::AddMultTransposePA(const Vector &x,
    }
 }
 
+void MixedVectorGradientIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                            Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 } // namespace mfem
@@ -233,4 +233,188 @@ void NormalTraceJumpIntegrator::AssembleEAInteriorFaces(
    }
 }
 
+void TraceJumpIntegrator::AssembleEAInteriorFaces(
+   const FiniteElementSpace &trial_fes,
+   const FiniteElementSpace &test_fes,
+   Vector &emat,
+   const bool add)
+{
+   Mesh &mesh = *trial_fes.GetMesh();
+   MFEM_VERIFY(mesh.Conforming(), "TraceJumpIntegrator: element assembly is "
+               "not supported on nonconforming meshes.");
+   const int dim = mesh.Dimension();
+   const FaceType ftype = FaceType::Interior;
+   const int nf = mesh.GetNFbyType(ftype);
+   if (nf == 0) { return; }
+
+   const FiniteElement &test_el = *test_fes.GetTypicalFE();
+   const auto *test_tbe = dynamic_cast<const TensorBasisElement*>(&test_el);
+   MFEM_VERIFY(test_tbe && test_el.GetMapType() == FiniteElement::VALUE &&
+               FiniteElement::IsClosedType(test_tbe->GetBasisType()),
+               "TraceJumpIntegrator: element assembly requires test elements "
+               "with a closed nodal tensor basis.");
+
+   const FiniteElement &trial_face_el = *trial_fes.GetTypicalTraceElement();
+   const FiniteElement &test_face_el = *test_fes.GetTypicalTraceElement();
+   const bool scale_by_det = (trial_face_el.GetMapType() ==
+                              FiniteElement::VALUE);
+
+   // Local face indices and orientations of the interior faces, and the
+   // global index of the first one (used for the default quadrature order).
+   Array<int> face_info(nf * 4);
+   Array<int> face_index(nf);
+   {
+      int fidx = 0;
+      for (int f = 0; f < mesh.GetNumFaces(); ++f)
+      {
+         Mesh::FaceInformation finfo = mesh.GetFaceInformation(f);
+         if (!finfo.IsInterior()) { continue; }
+         face_info[0 + fidx*4] = finfo.element[0].local_face_id;
+         face_info[1 + fidx*4] = finfo.element[0].orientation;
+         face_info[2 + fidx*4] = finfo.element[1].local_face_id;
+         face_info[3 + fidx*4] = finfo.element[1].orientation;
+         face_index[fidx] = f;
+         fidx++;
+      }
+   }
+
+   const Geometry::Type geom = mesh.GetTypicalFaceGeometry();
+   int qorder = test_fes.GetMaxElementOrder() + trial_face_el.GetOrder();
+   if (scale_by_det)
+   {
+      qorder += mesh.GetFaceTransformation(face_index[0])->OrderW();
+   }
+   const IntegrationRule &ir = IntRule ? *IntRule : IntRules.Get(geom, qorder);
+   const int nquad = ir.Size();
+
+   // Quadrature weights, scaled by the face Jacobian determinants when the
+   // trial functions are of VALUE type.
+   Vector face_w(nquad * nf);
+   {
+      auto h_face_w = Reshape(face_w.HostWrite(), nquad, nf);
+      for (int fidx = 0; fidx < nf; ++fidx)
+      {
+         ElementTransformation *T =
+            scale_by_det ? mesh.GetFaceTransformation(face_index[fidx]) : NULL;
+         for (int q = 0; q < nquad; ++q)
+         {
+            const IntegrationPoint &ip = ir.IntPoint(q);
+            real_t w = ip.weight;
+            if (T)
+            {
+               T->SetIntPoint(&ip);
+               w *= T->Weight();
+            }
+            h_face_w(q, fidx) = w;
+         }
+      }
+   }
+
+   const DofToQuad &trial_maps =
+      trial_face_el.GetDofToQuad(ir, DofToQuad::TENSOR);
+   const DofToQuad &test_maps = test_face_el.GetDofToQuad(ir, DofToQuad::TENSOR);
+   const int trial_d1d = trial_maps.ndof;
+   const int test_d1d = test_maps.ndof;
+   const int q1d = trial_maps.nqpt;
+   const int ndof_trial = trial_face_el.GetDof();
+   const int ndof_test_face = test_face_el.GetDof();
+
+   // Face matrices (test trace DOFs x trial DOFs), both ordered
+   // lexicographically with respect to the face
+   Vector face_emat(ndof_test_face * ndof_trial * nf);
+   {
+      const auto Bi = Reshape(test_maps.B.Read(), q1d, test_d1d);
+      const auto Bj = Reshape(trial_maps.B.Read(), q1d, trial_d1d);
+      const auto W = Reshape(face_w.Read(), nquad, nf);
+      auto M = Reshape(face_emat.Write(), ndof_test_face, ndof_trial, nf);
+      mfem::forall(ndof_test_face * ndof_trial * nf,
+                   [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int i = idx % ndof_test_face;
+         const int j = (idx / ndof_test_face) % ndof_trial;
+         const int f = idx / (ndof_test_face * ndof_trial);
+         real_t val = 0.0;
+         if (dim == 2)
+         {
+            for (int q = 0; q < q1d; ++q)
+            {
+               val += Bi(q, i) * W(q, f) * Bj(q, j);
+            }
+         }
+         else // dim == 3
+         {
+            const int ix = i % test_d1d, iy = i / test_d1d;
+            const int jx = j % trial_d1d, jy = j / trial_d1d;
+            for (int qy = 0; qy < q1d; ++qy)
+            {
+               for (int qx = 0; qx < q1d; ++qx)
+               {
+                  val += Bi(qx, ix) * Bi(qy, iy) * W(qx + q1d*qy, f) *
+                         Bj(qx, jx) * Bj(qy, jy);
+               }
+            }
+         }
+         M(i, j, f) = val;
+      });
+   }
+
+   const int n_faces_per_el = 2*dim; // assuming tensor product
+   Array<int> face_maps(ndof_test_face * n_faces_per_el);
+   for (int lf_i = 0; lf_i < n_faces_per_el; ++lf_i)
+   {
+      Array<int> face_map(ndof_test_face);
+      test_el.GetFaceMap(lf_i, face_map);
+      for (int i = 0; i < ndof_test_face; ++i)
+      {
+         face_maps[i + lf_i*ndof_test_face] = face_map[i];
+      }
+   }
+
+   const int ndof_vol = test_el.GetDof();
+   const auto d_face_maps = Reshape(face_maps.Read(), ndof_test_face,
+                                    n_faces_per_el);
+   const auto d_face_info = Reshape(face_info.Read(), 2, 2, nf);
+   const auto face_mats = Reshape(face_emat.Read(), ndof_test_face, ndof_trial,
+                                  nf);
+
+   real_t *d_emat;
+   if (add)
+   {
+      d_emat = emat.ReadWrite();
+   }
+   else
+   {
+      d_emat = emat.Write();
+      emat = 0.0; // Will execute on device, since Write() sets the device flag
+   }
+   auto el_mats = Reshape(d_emat, ndof_vol, ndof_trial, 2, nf);
+
+   mfem::forall_3D(nf, ndof_test_face, ndof_trial, 2,
+                   [=] MFEM_HOST_DEVICE (int f)
+   {
+      MFEM_FOREACH_THREAD(el_i, z, 2)
+      {
+         const int lf_i = d_face_info(0, el_i, f);
+         const int orient = d_face_info(1, el_i, f);
+         // The jump is taken from element 0 to element 1
+         const real_t sgn = (el_i == 0) ? 1.0 : -1.0;
+         MFEM_FOREACH_THREAD(i_lex, x, ndof_test_face)
+         {
+            // Convert to lexicographic relative to the face itself
+            const int i_face = (dim == 2) ?
+                               internal::PermuteFace2D(lf_i, orient, test_d1d,
+                                                       i_lex) :
+                               internal::PermuteFace3D(lf_i, orient, test_d1d,
+                                                       i_lex);
+            // Convert from lexicographic face DOF to volume DOF
+            const int i = d_face_maps(i_lex, lf_i);
+            MFEM_FOREACH_THREAD(j, y, ndof_trial)
+            {
+               el_mats(i, j, el_i, f) += sgn * face_mats(i_face, j, f);
+            }
+         }
+      }
+   });
+}
+
 }
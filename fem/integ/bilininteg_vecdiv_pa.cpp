@@ -1076,4 +1076,10 @@ void VectorDivergenceIntegrator::AddMultTransposePA(const Vector &x,
                      true);
 }
 
+void VectorDivergenceIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                         Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 } // namespace mfem
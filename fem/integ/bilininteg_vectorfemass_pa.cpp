@@ -471,4 +471,10 @@ void VectorFEMassIntegrator::AddMultTransposePA(const Vector &x,
    }
 }
 
+void VectorFEMassIntegrator::AssembleDiagonalPA_ADAt(const Vector &D,
+                                                     Vector &diag)
+{
+   ProbeDiagonalPA_ADAt(ne, D, diag);
+}
+
 } // namespace mfem
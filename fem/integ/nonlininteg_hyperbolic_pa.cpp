@@ -0,0 +1,1037 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Partial assembly of HyperbolicFormIntegrator and batched evaluation of the
+// flux functions and numerical fluxes.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/kernels.hpp"
+#include "../hyperbolic.hpp"
+
+namespace mfem
+{
+
+// Maximum number of equations and dimension supported by the batched kernels
+static constexpr int MAX_NEQ = 5;
+static constexpr int MAX_DIM = 3;
+
+// Interpolation of the states with a 1D basis, U(c,q,e) = Σ_d B(q,d) X(d,c,e).
+// Used for the elements in 1D and for the faces in 2D.
+static void HyperbolicInterp1D(const int NE, const int NEQ, const int D1D,
+                               const int Q1D, const Array<real_t> &b_,
+                               const Vector &x_, Vector &u_)
+{
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto X = Reshape(x_.Read(), D1D, NEQ, NE);
+   auto U = Reshape(u_.Write(), NEQ, Q1D, NE);
+   mfem::forall(Q1D*NE, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % Q1D, e = idx / Q1D;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t u = 0.0;
+         for (int d = 0; d < D1D; d++) { u += B(q,d) * X(d,c,e); }
+         U(c,q,e) = u;
+      }
+   });
+}
+
+// Sum-factorized interpolation of the states, U = (B⊗B) X
+static void HyperbolicInterp2D(const int NE, const int NEQ, const int D1D,
+                               const int Q1D, const Array<real_t> &b_,
+                               const Vector &x_, Vector &u_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto x = Reshape(x_.Read(), D1D, D1D, NEQ, NE);
+   auto u = Reshape(u_.Write(), NEQ, Q1D, Q1D, NE);
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t X[MD1][MD1];
+      MFEM_SHARED real_t DQ[MD1][MQ1];
+      MFEM_FOREACH_THREAD(d,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(q,x,Q1D) { B[q][d] = b(q,d); }
+      }
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D) { X[dy][dx] = x(dx,dy,c,e); }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(qx,x,Q1D)
+            {
+               real_t v = 0.0;
+               for (int dx = 0; dx < D1D; dx++) { v += B[qx][dx] * X[dy][dx]; }
+               DQ[dy][qx] = v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qx,x,Q1D)
+            {
+               real_t v = 0.0;
+               for (int dy = 0; dy < D1D; dy++) { v += B[qy][dy] * DQ[dy][qx]; }
+               u(c,qx,qy,e) = v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Sum-factorized interpolation of the states, U = (B⊗B⊗B) X
+static void HyperbolicInterp3D(const int NE, const int NEQ, const int D1D,
+                               const int Q1D, const Array<real_t> &b_,
+                               const Vector &x_, Vector &u_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto x = Reshape(x_.Read(), D1D, D1D, D1D, NEQ, NE);
+   auto u = Reshape(u_.Write(), NEQ, Q1D, Q1D, Q1D, NE);
+   mfem::forall_3D(NE, Q1D, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int tidz = MFEM_THREAD_ID(z);
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t sm0[MDQ*MDQ*MDQ];
+      MFEM_SHARED real_t sm1[MDQ*MDQ*MDQ];
+      real_t (*X)[MD1][MD1] = (real_t (*)[MD1][MD1]) sm0;
+      real_t (*DDQ)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) sm1;
+      real_t (*DQQ)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) sm0;
+      if (tidz == 0)
+      {
+         MFEM_FOREACH_THREAD(d,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(q,x,Q1D) { B[q][d] = b(q,d); }
+         }
+      }
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(dz,z,D1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  X[dz][dy][dx] = x(dx,dy,dz,c,e);
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dz,z,D1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  real_t v = 0.0;
+                  for (int dx = 0; dx < D1D; dx++)
+                  {
+                     v += B[qx][dx] * X[dz][dy][dx];
+                  }
+                  DDQ[dz][dy][qx] = v;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dz,z,D1D)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  real_t v = 0.0;
+                  for (int dy = 0; dy < D1D; dy++)
+                  {
+                     v += B[qy][dy] * DDQ[dz][dy][qx];
+                  }
+                  DQQ[dz][qy][qx] = v;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(qx,x,Q1D)
+               {
+                  real_t v = 0.0;
+                  for (int dz = 0; dz < D1D; dz++)
+                  {
+                     v += B[qz][dz] * DQQ[dz][qy][qx];
+                  }
+                  u(c,qx,qy,qz,e) = v;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Integration of the reference fluxes against the gradients of a 1D basis,
+// Y(d,c,e) += Σ_q G(q,d) F(c,q,e)
+static void HyperbolicGradT1D(const int NE, const int NEQ, const int D1D,
+                              const int Q1D, const Array<real_t> &g_,
+                              const Vector &f_, Vector &y_)
+{
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   const auto F = Reshape(f_.Read(), NEQ, Q1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, NEQ, NE);
+   mfem::forall(D1D*NE, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int d = idx % D1D, e = idx / D1D;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t val = 0.0;
+         for (int q = 0; q < Q1D; q++) { val += G(q,d) * F(c,q,e); }
+         Y(d,c,e) += val;
+      }
+   });
+}
+
+// Sum-factorized integration of the reference fluxes against the reference
+// gradients, Y += (G⊗B)ᵀ F₀ + (B⊗G)ᵀ F₁
+static void HyperbolicGradT2D(const int NE, const int NEQ, const int D1D,
+                              const int Q1D, const Array<real_t> &b_,
+                              const Array<real_t> &g_, const Vector &f_,
+                              Vector &y_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto g = Reshape(g_.Read(), Q1D, D1D);
+   const auto f = Reshape(f_.Read(), NEQ, 2, Q1D, Q1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, NEQ, NE);
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t G[MQ1][MD1];
+      MFEM_SHARED real_t QD0[MQ1][MD1];
+      MFEM_SHARED real_t QD1[MQ1][MD1];
+      MFEM_FOREACH_THREAD(d,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(q,x,Q1D)
+         {
+            B[q][d] = b(q,d);
+            G[q][d] = g(q,d);
+         }
+      }
+      MFEM_SYNC_THREAD;
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               real_t v0 = 0.0, v1 = 0.0;
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  v0 += G[qx][dx] * f(c,0,qx,qy,e);
+                  v1 += B[qx][dx] * f(c,1,qx,qy,e);
+               }
+               QD0[qy][dx] = v0;
+               QD1[qy][dx] = v1;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               real_t v = 0.0;
+               for (int qy = 0; qy < Q1D; qy++)
+               {
+                  v += B[qy][dy] * QD0[qy][dx] + G[qy][dy] * QD1[qy][dx];
+               }
+               y(dx,dy,c,e) += v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Sum-factorized integration of the reference fluxes against the reference
+// gradients, Y += (G⊗B⊗B)ᵀ F₀ + (B⊗G⊗B)ᵀ F₁ + (B⊗B⊗G)ᵀ F₂
+static void HyperbolicGradT3D(const int NE, const int NEQ, const int D1D,
+                              const int Q1D, const Array<real_t> &b_,
+                              const Array<real_t> &g_, const Vector &f_,
+                              Vector &y_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto g = Reshape(g_.Read(), Q1D, D1D);
+   const auto f = Reshape(f_.Read(), NEQ, 3, Q1D, Q1D, Q1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NEQ, NE);
+   mfem::forall_3D(NE, Q1D, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int tidz = MFEM_THREAD_ID(z);
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t G[MQ1][MD1];
+      MFEM_SHARED real_t sm0[3][MDQ*MDQ*MDQ];
+      MFEM_SHARED real_t sm1[2][MDQ*MDQ*MDQ];
+      real_t (*QQD0)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm0+0);
+      real_t (*QQD1)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm0+1);
+      real_t (*QQD2)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm0+2);
+      real_t (*QDD0)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm1+0);
+      real_t (*QDD1)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm1+1);
+      if (tidz == 0)
+      {
+         MFEM_FOREACH_THREAD(d,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(q,x,Q1D)
+            {
+               B[q][d] = b(q,d);
+               G[q][d] = g(q,d);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qy,y,Q1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  real_t v0 = 0.0, v1 = 0.0, v2 = 0.0;
+                  for (int qx = 0; qx < Q1D; qx++)
+                  {
+                     v0 += G[qx][dx] * f(c,0,qx,qy,qz,e);
+                     v1 += B[qx][dx] * f(c,1,qx,qy,qz,e);
+                     v2 += B[qx][dx] * f(c,2,qx,qy,qz,e);
+                  }
+                  QQD0[qz][qy][dx] = v0;
+                  QQD1[qz][qy][dx] = v1;
+                  QQD2[qz][qy][dx] = v2;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         // Terms with B in z and with G in z
+         MFEM_FOREACH_THREAD(qz,z,Q1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  real_t v0 = 0.0, v1 = 0.0;
+                  for (int qy = 0; qy < Q1D; qy++)
+                  {
+                     v0 += B[qy][dy] * QQD0[qz][qy][dx] +
+                           G[qy][dy] * QQD1[qz][qy][dx];
+                     v1 += B[qy][dy] * QQD2[qz][qy][dx];
+                  }
+                  QDD0[qz][dy][dx] = v0;
+                  QDD1[qz][dy][dx] = v1;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dz,z,D1D)
+         {
+            MFEM_FOREACH_THREAD(dy,y,D1D)
+            {
+               MFEM_FOREACH_THREAD(dx,x,D1D)
+               {
+                  real_t v = 0.0;
+                  for (int qz = 0; qz < Q1D; qz++)
+                  {
+                     v += B[qz][dz] * QDD0[qz][dy][dx] +
+                          G[qz][dz] * QDD1[qz][dy][dx];
+                  }
+                  y(dx,dy,dz,c,e) += v;
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Sum-factorized interpolation of the states on both sides of the faces of a
+// 3D mesh, U₁ = (B⊗B) X₁ and U₂ = (B⊗B) X₂
+static void HyperbolicFaceInterp2D(const int NF, const int NEQ, const int D1D,
+                                   const int Q1D, const Array<real_t> &b_,
+                                   const Vector &x_, Vector &u1_, Vector &u2_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto x = Reshape(x_.Read(), D1D, D1D, NEQ, 2, NF);
+   auto u1 = Reshape(u1_.Write(), NEQ, Q1D, Q1D, NF);
+   auto u2 = Reshape(u2_.Write(), NEQ, Q1D, Q1D, NF);
+   mfem::forall_2D(NF, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t X[2][MD1][MD1];
+      MFEM_SHARED real_t DQ[2][MD1][MQ1];
+      MFEM_FOREACH_THREAD(d,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(q,x,Q1D) { B[q][d] = b(q,d); }
+      }
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               X[0][dy][dx] = x(dx,dy,c,0,f);
+               X[1][dy][dx] = x(dx,dy,c,1,f);
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(qx,x,Q1D)
+            {
+               real_t v0 = 0.0, v1 = 0.0;
+               for (int dx = 0; dx < D1D; dx++)
+               {
+                  v0 += B[qx][dx] * X[0][dy][dx];
+                  v1 += B[qx][dx] * X[1][dy][dx];
+               }
+               DQ[0][dy][qx] = v0;
+               DQ[1][dy][qx] = v1;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(qx,x,Q1D)
+            {
+               real_t v0 = 0.0, v1 = 0.0;
+               for (int dy = 0; dy < D1D; dy++)
+               {
+                  v0 += B[qy][dy] * DQ[0][dy][qx];
+                  v1 += B[qy][dy] * DQ[1][dy][qx];
+               }
+               u1(c,qx,qy,f) = v0;
+               u2(c,qx,qy,f) = v1;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Integration of -F̂n [v] on the faces of a 2D mesh
+static void HyperbolicFaceIntegrate1D(const int NF, const int NEQ,
+                                      const int D1D, const int Q1D,
+                                      const Array<real_t> &b_,
+                                      const Vector &w_, const Vector &fn_,
+                                      Vector &y_)
+{
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto W = w_.Read();
+   const auto FN = Reshape(fn_.Read(), NEQ, Q1D, NF);
+   auto Y = Reshape(y_.ReadWrite(), D1D, NEQ, 2, NF);
+   mfem::forall(D1D*NF, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int d = idx % D1D, f = idx / D1D;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t val = 0.0;
+         for (int q = 0; q < Q1D; q++) { val += W[q] * B(q,d) * FN(c,q,f); }
+         Y(d,c,0,f) -= val;
+         Y(d,c,1,f) += val;
+      }
+   });
+}
+
+// Sum-factorized integration of -F̂n [v] on the faces of a 3D mesh
+static void HyperbolicFaceIntegrate2D(const int NF, const int NEQ,
+                                      const int D1D, const int Q1D,
+                                      const Array<real_t> &b_,
+                                      const Vector &w_, const Vector &fn_,
+                                      Vector &y_)
+{
+   const auto b = Reshape(b_.Read(), Q1D, D1D);
+   const auto w = Reshape(w_.Read(), Q1D, Q1D);
+   const auto fn = Reshape(fn_.Read(), NEQ, Q1D, Q1D, NF);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, NEQ, 2, NF);
+   mfem::forall_2D(NF, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int f)
+   {
+      constexpr int MQ1 = DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = DofQuadLimits::MAX_D1D;
+      MFEM_SHARED real_t B[MQ1][MD1];
+      MFEM_SHARED real_t QD[MQ1][MD1];
+      MFEM_FOREACH_THREAD(d,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(q,x,Q1D) { B[q][d] = b(q,d); }
+      }
+      MFEM_SYNC_THREAD;
+      for (int c = 0; c < NEQ; c++)
+      {
+         MFEM_FOREACH_THREAD(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               real_t v = 0.0;
+               for (int qx = 0; qx < Q1D; qx++)
+               {
+                  v += B[qx][dx] * w(qx,qy) * fn(c,qx,qy,f);
+               }
+               QD[qy][dx] = v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(dx,x,D1D)
+            {
+               real_t v = 0.0;
+               for (int qy = 0; qy < Q1D; qy++) { v += B[qy][dy] * QD[qy][dx]; }
+               y(dx,dy,c,0,f) -= v;
+               y(dx,dy,c,1,f) += v;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+void HyperbolicFormIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(fluxFunction.SupportsBatchedEval(),
+               "the flux function does not support batched evaluation");
+   MFEM_VERIFY(fes.GetVDim() == num_equations,
+               "the vector dimension must match the number of equations");
+   MFEM_VERIFY(UsesTensorBasis(fes),
+               "PA is supported only for tensor-product elements");
+
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+
+   Mesh &mesh = *fes.GetMesh();
+   dim = mesh.Dimension();
+   MFEM_VERIFY(mesh.SpaceDimension() == dim,
+               "surface meshes are not supported");
+   MFEM_VERIFY(num_equations <= MAX_NEQ && dim <= MAX_DIM,
+               "too many equations or dimensions");
+   ne = fes.GetNE();
+   if (ne == 0) { return; }
+
+   const FiniteElement &el = *fes.GetTypicalFE();
+   const IntegrationRule *ir = IntRule;
+   if (!ir)
+   {
+      const int order = el.GetOrder()*2 + IntOrderOffset;
+      ir = &IntRules.Get(el.GetGeomType(), order);
+   }
+   nq = ir->GetNPoints();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   MFEM_VERIFY(maps->ndof <= DeviceDofQuadLimits::Get().MAX_D1D &&
+               maps->nqpt <= DeviceDofQuadLimits::Get().MAX_Q1D,
+               "the order of the elements or of the quadrature is too high");
+   const GeometricFactors *geom =
+      mesh.GetGeometricFactors(*ir, GeometricFactors::JACOBIANS, mt);
+
+   // Store w * sign * adj(J) so that (F(u), ∇v) = Σ_q ∇̂φ ⋅ (adj(J) Fᵀ) w
+   pa_data.SetSize(nq*dim*dim*ne, mt);
+   const int DIM = dim, NQ = nq;
+   const real_t s = sign;
+   const auto W = ir->GetWeights().Read();
+   const auto J = Reshape(geom->J.Read(), NQ, DIM, DIM, ne);
+   auto D = Reshape(pa_data.Write(), NQ, DIM, DIM, ne);
+   mfem::forall(NQ*ne, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ, e = idx / NQ;
+      real_t Jq[MAX_DIM*MAX_DIM], A[MAX_DIM*MAX_DIM];
+      for (int j = 0; j < DIM; j++)
+      {
+         for (int i = 0; i < DIM; i++) { Jq[i + DIM*j] = J(q,i,j,e); }
+      }
+      if (DIM == 1) { A[0] = 1.0; }
+      else if (DIM == 2) { kernels::CalcAdjugate<2>(Jq, A); }
+      else { kernels::CalcAdjugate<3>(Jq, A); }
+      for (int j = 0; j < DIM; j++)
+      {
+         for (int k = 0; k < DIM; k++) { D(q,k,j,e) = s * W[q] * A[k + DIM*j]; }
+      }
+   });
+}
+
+void HyperbolicFormIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   if (ne == 0) { return; }
+   const int NE = ne, NQ = nq, DIM = dim;
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   const int NEQ = num_equations;
+   const MemoryType mt = Device::GetDeviceMemoryType();
+   q_state.SetSize(NEQ*NQ*NE, mt);
+   q_flux.SetSize(NEQ*DIM*NQ*NE, mt);
+   q_speed.SetSize(NQ*NE, mt);
+
+   // 1. Interpolate the states to the quadrature points
+   switch (DIM)
+   {
+      case 1: HyperbolicInterp1D(NE, NEQ, D1D, Q1D, maps->B, x, q_state); break;
+      case 2: HyperbolicInterp2D(NE, NEQ, D1D, Q1D, maps->B, x, q_state); break;
+      case 3: HyperbolicInterp3D(NE, NEQ, D1D, Q1D, maps->B, x, q_state); break;
+   }
+
+   // 2. Evaluate the fluxes at all quadrature points
+   fluxFunction.ComputeFluxBatch(q_state, q_flux, q_speed);
+   max_char_speed = std::max(max_char_speed, q_speed.Max());
+
+   // 3. Transform the fluxes to the reference element, in place
+   const auto D = Reshape(pa_data.Read(), NQ, DIM, DIM, NE);
+   auto F = Reshape(q_flux.ReadWrite(), NEQ, DIM, NQ, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ, e = idx / NQ;
+      for (int c = 0; c < NEQ; c++)
+      {
+         real_t f[MAX_DIM];
+         for (int j = 0; j < DIM; j++) { f[j] = F(c,j,q,e); }
+         for (int k = 0; k < DIM; k++)
+         {
+            real_t fk = 0.0;
+            for (int j = 0; j < DIM; j++) { fk += D(q,k,j,e) * f[j]; }
+            F(c,k,q,e) = fk;
+         }
+      }
+   });
+
+   // 4. Integrate against the reference gradients of the test functions
+   switch (DIM)
+   {
+      case 1:
+         HyperbolicGradT1D(NE, NEQ, D1D, Q1D, maps->G, q_flux, y);
+         break;
+      case 2:
+         HyperbolicGradT2D(NE, NEQ, D1D, Q1D, maps->B, maps->G, q_flux, y);
+         break;
+      case 3:
+         HyperbolicGradT3D(NE, NEQ, D1D, Q1D, maps->B, maps->G, q_flux, y);
+         break;
+   }
+}
+
+void HyperbolicFormIntegrator::AssemblePAInteriorFaces(
+   const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(numFlux.SupportsBatchedEval(),
+               "the numerical flux does not support batched evaluation");
+   MFEM_VERIFY(fes.GetVDim() == num_equations,
+               "the vector dimension must match the number of equations");
+   MFEM_VERIFY(UsesTensorBasis(fes),
+               "PA is supported only for tensor-product elements");
+   // The face restriction evaluates the traces by taking the dofs on the face,
+   // which requires the dofs to be located at the element boundary
+   const auto *tbe =
+      dynamic_cast<const TensorBasisElement*>(fes.GetTypicalFE());
+   MFEM_VERIFY(tbe && tbe->GetBasisType() == BasisType::GaussLobatto,
+               "PA on faces requires a Gauss-Lobatto basis");
+
+   const MemoryType mt = (pa_mt == MemoryType::DEFAULT) ?
+                         Device::GetDeviceMemoryType() : pa_mt;
+
+   Mesh &mesh = *fes.GetMesh();
+   dim = mesh.Dimension();
+   MFEM_VERIFY(dim > 1, "PA on faces requires dim > 1");
+   MFEM_VERIFY(num_equations <= MAX_NEQ && dim <= MAX_DIM,
+               "too many equations or dimensions");
+   nf = fes.GetNFbyType(FaceType::Interior);
+   if (nf == 0) { return; }
+
+   const FiniteElement &el = *fes.GetTypicalTraceElement();
+   const IntegrationRule *ir = IntRule;
+   if (!ir)
+   {
+      const int order = 2*fes.GetTypicalFE()->GetOrder() + IntOrderOffset;
+      ir = &IntRules.Get(el.GetGeomType(), order);
+   }
+   nfq = ir->GetNPoints();
+   face_maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   MFEM_VERIFY(face_maps->ndof <= DeviceDofQuadLimits::Get().MAX_D1D &&
+               face_maps->nqpt <= DeviceDofQuadLimits::Get().MAX_Q1D,
+               "the order of the elements or of the quadrature is too high");
+   const FaceGeometricFactors *geom = mesh.GetFaceGeometricFactors(
+                                         *ir, FaceGeometricFactors::DETERMINANTS |
+                                         FaceGeometricFactors::NORMALS,
+                                         FaceType::Interior, mt);
+
+   // Scaled normals, equivalent to CalcOrtho() of the face Jacobian
+   const int DIM = dim, NQ = nfq;
+   pa_face_nor.SetSize(DIM*NQ*nf, mt);
+   const auto detJ = Reshape(geom->detJ.Read(), NQ, nf);
+   const auto n = Reshape(geom->normal.Read(), NQ, DIM, nf);
+   auto N = Reshape(pa_face_nor.Write(), DIM, NQ, nf);
+   mfem::forall(NQ*nf, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ, f = idx / NQ;
+      for (int d = 0; d < DIM; d++) { N(d,q,f) = detJ(q,f) * n(q,d,f); }
+   });
+   const Array<real_t> &w = ir->GetWeights();
+   pa_face_w.SetSize(NQ);
+   for (int q = 0; q < NQ; q++) { pa_face_w(q) = sign * w[q]; }
+}
+
+void HyperbolicFormIntegrator::AddMultPAInteriorFaces(const Vector &x,
+                                                      Vector &y) const
+{
+   if (nf == 0) { return; }
+   const int NF = nf, NQ = nfq;
+   const int D1D = face_maps->ndof, Q1D = face_maps->nqpt;
+   const int NEQ = num_equations;
+   const MemoryType mt = Device::GetDeviceMemoryType();
+   q_state.SetSize(NEQ*NQ*NF, mt);
+   q_state2.SetSize(NEQ*NQ*NF, mt);
+   q_flux.SetSize(NEQ*NQ*NF, mt);
+   q_speed.SetSize(NQ*NF, mt);
+
+   // 1. Interpolate the states from both sides to the quadrature points
+   if (dim == 2)
+   {
+      const auto B = Reshape(face_maps->B.Read(), Q1D, D1D);
+      const auto X = Reshape(x.Read(), D1D, NEQ, 2, NF);
+      auto U1 = Reshape(q_state.Write(), NEQ, Q1D, NF);
+      auto U2 = Reshape(q_state2.Write(), NEQ, Q1D, NF);
+      mfem::forall(Q1D*NF, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         const int q = idx % Q1D, f = idx / Q1D;
+         for (int c = 0; c < NEQ; c++)
+         {
+            real_t u1 = 0.0, u2 = 0.0;
+            for (int d = 0; d < D1D; d++)
+            {
+               u1 += B(q,d) * X(d,c,0,f);
+               u2 += B(q,d) * X(d,c,1,f);
+            }
+            U1(c,q,f) = u1;
+            U2(c,q,f) = u2;
+         }
+      });
+   }
+   else
+   {
+      HyperbolicFaceInterp2D(NF, NEQ, D1D, Q1D, face_maps->B, x,
+                             q_state, q_state2);
+   }
+
+   // 2. Evaluate the numerical fluxes at all quadrature points
+   numFlux.EvalBatch(q_state, q_state2, pa_face_nor, q_flux, q_speed);
+   max_char_speed = std::max(max_char_speed, q_speed.Max());
+
+   // 3. Integrate -F̂n [v]
+   if (dim == 2)
+   {
+      HyperbolicFaceIntegrate1D(NF, NEQ, D1D, Q1D, face_maps->B, pa_face_w,
+                                q_flux, y);
+   }
+   else
+   {
+      HyperbolicFaceIntegrate2D(NF, NEQ, D1D, Q1D, face_maps->B, pa_face_w,
+                                q_flux, y);
+   }
+}
+
+void RusanovFlux::EvalBatch(const Vector &states1, const Vector &states2,
+                            const Vector &nors, Vector &fluxes,
+                            Vector &speeds) const
+{
+   const int NEQ = fluxFunction.num_equations, DIM = fluxFunction.dim;
+   const int NP = speeds.Size();
+   fluxesN2.SetSize(NEQ*NP, fluxes.GetMemory().GetMemoryType());
+   speeds2.SetSize(NP, speeds.GetMemory().GetMemoryType());
+   fluxFunction.ComputeFluxDotNBatch(states1, nors, fluxes, speeds);
+   fluxFunction.ComputeFluxDotNBatch(states2, nors, fluxesN2, speeds2);
+
+   const auto U1 = Reshape(states1.Read(), NEQ, NP);
+   const auto U2 = Reshape(states2.Read(), NEQ, NP);
+   const auto N = Reshape(nors.Read(), DIM, NP);
+   const auto F2 = Reshape(fluxesN2.Read(), NEQ, NP);
+   const auto S2 = speeds2.Read();
+   auto F = Reshape(fluxes.ReadWrite(), NEQ, NP);
+   auto S = speeds.ReadWrite();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      // NOTE: nor in general is not a unit normal
+      const real_t maxE = fmax(S[p], S2[p]);
+      real_t nor2 = 0.0;
+      for (int d = 0; d < DIM; d++) { nor2 += N(d,p) * N(d,p); }
+      // here, |nor| is multiplied to match the scale with fluxN
+      const real_t scaledMaxE = maxE * sqrt(nor2);
+      for (int c = 0; c < NEQ; c++)
+      {
+         F(c,p) = 0.5*(scaledMaxE*(U1(c,p) - U2(c,p)) + (F(c,p) + F2(c,p)));
+      }
+      S[p] = maxE;
+   });
+}
+
+void ComponentwiseUpwindFlux::EvalBatch(const Vector &states1,
+                                        const Vector &states2,
+                                        const Vector &nors, Vector &fluxes,
+                                        Vector &speeds) const
+{
+   const int NEQ = fluxFunction.num_equations;
+   const int NP = speeds.Size();
+   fluxesN2.SetSize(NEQ*NP, fluxes.GetMemory().GetMemoryType());
+   speeds2.SetSize(NP, speeds.GetMemory().GetMemoryType());
+   fluxFunction.ComputeFluxDotNBatch(states1, nors, fluxes, speeds);
+   fluxFunction.ComputeFluxDotNBatch(states2, nors, fluxesN2, speeds2);
+
+   const auto U1 = Reshape(states1.Read(), NEQ, NP);
+   const auto U2 = Reshape(states2.Read(), NEQ, NP);
+   const auto F2 = Reshape(fluxesN2.Read(), NEQ, NP);
+   const auto S2 = speeds2.Read();
+   auto F = Reshape(fluxes.ReadWrite(), NEQ, NP);
+   auto S = speeds.ReadWrite();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      for (int c = 0; c < NEQ; c++)
+      {
+         F(c,p) = (U1(c,p) <= U2(c,p)) ? fmin(F(c,p), F2(c,p)) :
+                  fmax(F(c,p), F2(c,p));
+      }
+      S[p] = fmax(S[p], S2[p]);
+   });
+}
+
+bool AdvectionFlux::SupportsBatchedEval() const
+{
+   return dynamic_cast<const VectorConstantCoefficient*>(&b) != nullptr;
+}
+
+void AdvectionFlux::ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                                     Vector &speeds) const
+{
+   auto *cb = dynamic_cast<const VectorConstantCoefficient*>(&b);
+   MFEM_VERIFY(cb, "batched evaluation requires a constant velocity");
+   const int DIM = dim, NP = speeds.Size();
+   const Vector &bvec = cb->GetVec();
+   real_t bv[MAX_DIM];
+   for (int d = 0; d < DIM; d++) { bv[d] = bvec(d); }
+   const real_t bnorm = bvec.Norml2();
+
+   const auto U = Reshape(states.Read(), 1, NP);
+   auto F = Reshape(fluxes.Write(), 1, DIM, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      for (int d = 0; d < DIM; d++) { F(0,d,p) = U(0,p) * bv[d]; }
+      S[p] = bnorm;
+   });
+}
+
+void AdvectionFlux::ComputeFluxDotNBatch(const Vector &states,
+                                         const Vector &normals,
+                                         Vector &fluxesDotN,
+                                         Vector &speeds) const
+{
+   auto *cb = dynamic_cast<const VectorConstantCoefficient*>(&b);
+   MFEM_VERIFY(cb, "batched evaluation requires a constant velocity");
+   const int DIM = dim, NP = speeds.Size();
+   const Vector &bvec = cb->GetVec();
+   real_t bv[MAX_DIM];
+   for (int d = 0; d < DIM; d++) { bv[d] = bvec(d); }
+   const real_t bnorm = bvec.Norml2();
+
+   const auto U = Reshape(states.Read(), 1, NP);
+   const auto N = Reshape(normals.Read(), DIM, NP);
+   auto F = Reshape(fluxesDotN.Write(), 1, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      real_t bn = 0.0;
+      for (int d = 0; d < DIM; d++) { bn += bv[d] * N(d,p); }
+      F(0,p) = U(0,p) * bn;
+      S[p] = bnorm;
+   });
+}
+
+void BurgersFlux::ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                                   Vector &speeds) const
+{
+   const int DIM = dim, NP = speeds.Size();
+   const auto U = Reshape(states.Read(), 1, NP);
+   auto F = Reshape(fluxes.Write(), 1, DIM, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t u = U(0,p);
+      for (int d = 0; d < DIM; d++) { F(0,d,p) = u * u * 0.5; }
+      S[p] = fabs(u);
+   });
+}
+
+void BurgersFlux::ComputeFluxDotNBatch(const Vector &states,
+                                       const Vector &normals,
+                                       Vector &fluxesDotN,
+                                       Vector &speeds) const
+{
+   const int DIM = dim, NP = speeds.Size();
+   const auto U = Reshape(states.Read(), 1, NP);
+   const auto N = Reshape(normals.Read(), DIM, NP);
+   auto F = Reshape(fluxesDotN.Write(), 1, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t u = U(0,p);
+      real_t nsum = 0.0;
+      for (int d = 0; d < DIM; d++) { nsum += N(d,p); }
+      F(0,p) = u * u * 0.5 * nsum;
+      S[p] = fabs(u);
+   });
+}
+
+void ShallowWaterFlux::ComputeFluxBatch(const Vector &states,
+                                        Vector &fluxes,
+                                        Vector &speeds) const
+{
+   const int DIM = dim, NEQ = num_equations, NP = speeds.Size();
+   const real_t grav = g;
+   const auto U = Reshape(states.Read(), NEQ, NP);
+   auto F = Reshape(fluxes.Write(), NEQ, DIM, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t height = U(0,p);
+      const real_t energy = 0.5 * grav * (height * height);
+      real_t hvel2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         const real_t hvel_d = U(1 + d,p);
+         F(0,d,p) = hvel_d;
+         for (int i = 0; i < DIM; i++)
+         {
+            F(1 + i,d,p) = U(1 + i,p) * hvel_d / height;
+         }
+         F(1 + d,d,p) += energy;
+         hvel2 += hvel_d * hvel_d;
+      }
+      S[p] = sqrt(hvel2) / height + sqrt(grav * height);
+   });
+}
+
+void ShallowWaterFlux::ComputeFluxDotNBatch(const Vector &states,
+                                            const Vector &normals,
+                                            Vector &fluxesDotN,
+                                            Vector &speeds) const
+{
+   const int DIM = dim, NEQ = num_equations, NP = speeds.Size();
+   const real_t grav = g;
+   const auto U = Reshape(states.Read(), NEQ, NP);
+   const auto N = Reshape(normals.Read(), DIM, NP);
+   auto F = Reshape(fluxesDotN.Write(), NEQ, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t height = U(0,p);
+      const real_t energy = 0.5 * grav * (height * height);
+      real_t hvel_n = 0.0, nor2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         hvel_n += U(1 + d,p) * N(d,p);
+         nor2 += N(d,p) * N(d,p);
+      }
+      F(0,p) = hvel_n;
+      const real_t normal_vel = hvel_n / height;
+      for (int i = 0; i < DIM; i++)
+      {
+         F(1 + i,p) = normal_vel * U(1 + i,p) + energy * N(i,p);
+      }
+      S[p] = fabs(normal_vel) / sqrt(nor2) + sqrt(grav * height);
+   });
+}
+
+void EulerFlux::ComputeFluxBatch(const Vector &states, Vector &fluxes,
+                                 Vector &speeds) const
+{
+   const int DIM = dim, NEQ = num_equations, NP = speeds.Size();
+   const real_t gamma = specific_heat_ratio;
+   const auto U = Reshape(states.Read(), NEQ, NP);
+   auto F = Reshape(fluxes.Write(), NEQ, DIM, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t density = U(0,p);          // ρ
+      const real_t energy = U(1 + DIM,p);     // E
+      real_t momentum2 = 0.0;
+      for (int d = 0; d < DIM; d++) { momentum2 += U(1 + d,p) * U(1 + d,p); }
+      const real_t kinetic_energy = 0.5 * momentum2 / density;
+      // pressure, p = (γ-1)*(E - ½ρ|u|^2)
+      const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+      // enthalpy H = (E + p)/ρ
+      const real_t H = (energy + pressure) / density;
+      for (int d = 0; d < DIM; d++)
+      {
+         const real_t momentum_d = U(1 + d,p);
+         F(0,d,p) = momentum_d;
+         for (int i = 0; i < DIM; i++)
+         {
+            F(1 + i,d,p) = U(1 + i,p) * momentum_d / density;
+         }
+         F(1 + d,d,p) += pressure;
+         F(1 + DIM,d,p) = momentum_d * H;
+      }
+      // fluid speed + sound speed
+      S[p] = sqrt(2.0 * kinetic_energy / density) +
+             sqrt(gamma * pressure / density);
+   });
+}
+
+void EulerFlux::ComputeFluxDotNBatch(const Vector &states,
+                                     const Vector &normals,
+                                     Vector &fluxesDotN,
+                                     Vector &speeds) const
+{
+   const int DIM = dim, NEQ = num_equations, NP = speeds.Size();
+   const real_t gamma = specific_heat_ratio;
+   const auto U = Reshape(states.Read(), NEQ, NP);
+   const auto N = Reshape(normals.Read(), DIM, NP);
+   auto F = Reshape(fluxesDotN.Write(), NEQ, NP);
+   auto S = speeds.Write();
+   mfem::forall(NP, [=] MFEM_HOST_DEVICE (int p)
+   {
+      const real_t density = U(0,p);          // ρ
+      const real_t energy = U(1 + DIM,p);     // E
+      real_t momentum2 = 0.0, momentum_n = 0.0, nor2 = 0.0;
+      for (int d = 0; d < DIM; d++)
+      {
+         momentum2 += U(1 + d,p) * U(1 + d,p);
+         momentum_n += U(1 + d,p) * N(d,p);
+         nor2 += N(d,p) * N(d,p);
+      }
+      const real_t kinetic_energy = 0.5 * momentum2 / density;
+      // pressure, p = (γ-1)*(E - ½ρ|u|^2)
+      const real_t pressure = (gamma - 1.0) * (energy - kinetic_energy);
+      F(0,p) = momentum_n;                    // ρu⋅n
+      const real_t normal_velocity = momentum_n / density;
+      for (int d = 0; d < DIM; d++)
+      {
+         // ρu*(u⋅n) + pn
+         F(1 + d,p) = normal_velocity * U(1 + d,p) + pressure * N(d,p);
+      }
+      F(1 + DIM,p) = normal_velocity * (energy + pressure);
+      // fluid speed + sound speed
+      S[p] = fabs(normal_velocity) / sqrt(nor2) +
+             sqrt(gamma * pressure / density);
+   });
+}
+
+} // namespace mfem
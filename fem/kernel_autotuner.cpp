@@ -0,0 +1,134 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "kernel_autotuner.hpp"
+#include "../general/globals.hpp"
+#include "../general/error.hpp"
+#ifdef MFEM_USE_MPI
+#include "../general/communication.hpp"
+#endif
+
+#include <fstream>
+#include <sstream>
+
+namespace mfem
+{
+
+KernelAutotuner::KernelAutotuner()
+{
+   const char *env = GetEnv("MFEM_AUTOTUNE_KERNELS");
+   if (env)
+   {
+      if (std::string(env) != "NO") { enabled = true; }
+   }
+   const char *fname = GetEnv("MFEM_KERNEL_TUNING_CACHE");
+   if (fname && fname[0] != '\0') { cache_file = fname; }
+}
+
+KernelAutotuner &KernelAutotuner::Instance()
+{
+   static KernelAutotuner instance;
+   return instance;
+}
+
+std::string KernelAutotuner::MakeKey(const std::string &cpu,
+                                     const std::string &kernel,
+                                     const std::string &params)
+{
+   return cpu + '\t' + kernel + '\t' + params;
+}
+
+void KernelAutotuner::LoadCache()
+{
+   cache_loaded = true;
+   std::ifstream in(cache_file);
+   if (!in) { return; }
+   // Each line is: cpu <TAB> kernel <TAB> params <TAB> variant <TAB> time;
+   // later lines take precedence over earlier ones.
+   std::string line;
+   while (std::getline(in, line))
+   {
+      std::string field[4];
+      std::istringstream fields(line);
+      int n = 0;
+      while (n < 4 && std::getline(fields, field[n], '\t')) { n++; }
+      if (n < 4) { continue; }
+      cache[MakeKey(field[0], field[1], field[2])] = field[3];
+   }
+}
+
+void KernelAutotuner::SetCacheFile(const std::string &fname)
+{
+   KernelAutotuner &tuner = Instance();
+   tuner.cache_file = fname;
+   tuner.cache.clear();
+   tuner.cache_loaded = false;
+}
+
+const std::string &KernelAutotuner::GetCPUModel()
+{
+   static const std::string cpu_model = []()
+   {
+      std::string model;
+      std::ifstream cpuinfo("/proc/cpuinfo");
+      std::string line;
+      while (cpuinfo && std::getline(cpuinfo, line))
+      {
+         if (line.compare(0, 10, "model name") == 0 ||
+             (model.empty() && line.compare(0, 3, "CPU") == 0))
+         {
+            const size_t pos = line.find(':');
+            if (pos == std::string::npos) { continue; }
+            model = line.substr(line.find_first_not_of(" \t", pos + 1));
+            if (line.compare(0, 10, "model name") == 0) { break; }
+         }
+      }
+      for (char &c : model) { if (c == '\t') { c = ' '; } }
+      return model.empty() ? std::string("unknown") : model;
+   }();
+   return cpu_model;
+}
+
+bool KernelAutotuner::Lookup(const std::string &kernel,
+                             const std::string &params, std::string &variant)
+{
+   KernelAutotuner &tuner = Instance();
+   if (!tuner.cache_loaded) { tuner.LoadCache(); }
+   const auto it = tuner.cache.find(MakeKey(GetCPUModel(), kernel, params));
+   if (it == tuner.cache.end()) { return false; }
+   variant = it->second;
+   return true;
+}
+
+void KernelAutotuner::Store(const std::string &kernel,
+                            const std::string &params,
+                            const std::string &variant, double time)
+{
+   KernelAutotuner &tuner = Instance();
+   if (!tuner.cache_loaded) { tuner.LoadCache(); }
+   tuner.cache[MakeKey(GetCPUModel(), kernel, params)] = variant;
+
+#ifdef MFEM_USE_MPI
+   if (Mpi::IsInitialized() && !Mpi::Root()) { return; }
+#endif
+   // Append to the file, so that the choices of other runs are preserved
+   std::ofstream out(tuner.cache_file, std::ios::app);
+   if (!out)
+   {
+      MFEM_WARNING("cannot write the kernel tuning cache file "
+                   << tuner.cache_file);
+      return;
+   }
+   out << GetCPUModel() << '\t' << kernel << '\t' << params << '\t'
+       << variant << '\t' << time << '\n';
+}
+
+} // namespace mfem
@@ -0,0 +1,94 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_KERNEL_AUTOTUNER_HPP
+#define MFEM_KERNEL_AUTOTUNER_HPP
+
+#include "../config/config.hpp"
+#include <map>
+#include <string>
+
+namespace mfem
+{
+
+/// @brief Singleton class controlling the autotuning of the kernels registered
+/// with MFEM_REGISTER_KERNELS.
+///
+/// When autotuning is enabled, the first calls to KernelDispatchTable::Run()
+/// for a given set of dispatch parameters cycle through all the kernel
+/// variants registered for these parameters (including the variants that only
+/// differ in their optional parameters, e.g. NBZ, and the fallback kernel),
+/// timing each of them GetNumTrials() times. Each call still runs exactly one
+/// variant, so the results are not affected. The fastest variant is then used
+/// for all subsequent calls and it is appended to a cache file, keyed by the
+/// kernel name, the dispatch parameters and the CPU model, so that later runs
+/// skip the search.
+///
+/// @note Autotuning is only enabled when the environment variable
+/// MFEM_AUTOTUNE_KERNELS is set to a value other than 'NO' or if
+/// KernelAutotuner::Enable() is called. The cache file is given by the
+/// environment variable MFEM_KERNEL_TUNING_CACHE, or SetCacheFile(), and
+/// defaults to "mfem_kernel_tuning.txt" in the working directory. In parallel,
+/// only the MPI rank 0 writes to the cache file.
+class KernelAutotuner
+{
+   bool enabled = false;
+   int num_trials = 3;
+   std::string cache_file = "mfem_kernel_tuning.txt";
+   bool cache_loaded = false;
+   /// The cached choices: (cpu, kernel, parameters) -> variant.
+   std::map<std::string, std::string> cache;
+
+   KernelAutotuner();
+   static KernelAutotuner &Instance();
+   static std::string MakeKey(const std::string &cpu, const std::string &kernel,
+                              const std::string &params);
+   void LoadCache();
+
+public:
+   /// Enable (or disable) the autotuning of the kernels.
+   static void Enable(bool enable = true) { Instance().enabled = enable; }
+   /// Disable the autotuning of the kernels.
+   static void Disable() { Instance().enabled = false; }
+   /// Return true if the autotuning of the kernels is enabled.
+   static bool IsEnabled() { return Instance().enabled; }
+
+   /// Set the number of timings of each variant, default is 3.
+   static void SetNumTrials(int n) { Instance().num_trials = n < 1 ? 1 : n; }
+   /// Return the number of timings of each variant.
+   static int GetNumTrials() { return Instance().num_trials; }
+
+   /// @brief Set the cache file. The choices stored in the previous cache file
+   /// are discarded from memory.
+   static void SetCacheFile(const std::string &fname);
+   /// Return the name of the cache file.
+   static const std::string &GetCacheFile() { return Instance().cache_file; }
+
+   /// Return the CPU model used in the cache keys.
+   static const std::string &GetCPUModel();
+
+   /// @brief Find the variant of @a kernel stored in the cache for the
+   /// dispatch parameters @a params, on the current CPU model.
+   ///
+   /// Returns true and sets @a variant if found.
+   static bool Lookup(const std::string &kernel, const std::string &params,
+                      std::string &variant);
+
+   /// @brief Store the @a variant of @a kernel chosen for the dispatch
+   /// parameters @a params, on the current CPU model, with its measured
+   /// @a time in seconds.
+   static void Store(const std::string &kernel, const std::string &params,
+                     const std::string &variant, double time);
+};
+
+} // namespace mfem
+
+#endif
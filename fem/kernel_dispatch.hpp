@@ -14,11 +14,18 @@
 
 #include "../config/config.hpp"
 #include "kernel_reporter.hpp"
+#include "kernel_autotuner.hpp"
+#include "../general/backends.hpp"
 #include "../general/hash_util.hpp"
+#include "../general/tic_toc.hpp"
 #include <unordered_map>
 #include <tuple>
 #include <type_traits>
 #include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
 
 namespace mfem
 {
@@ -43,6 +50,11 @@ namespace mfem
 //
 // Specialized functions can be registered using the static AddSpecialization
 // member function.
+//
+// All the specializations registered for the same dispatch parameters (e.g.
+// with different NBZ) are kept as variants; by default, the last one registered
+// is used. When autotuning is enabled (see KernelAutotuner), the fastest
+// variant, including the fallback kernel, is selected at runtime.
 
 #define MFEM_EXPAND(X) X // Workaround needed for MSVC compiler
 
@@ -100,10 +112,43 @@ class KernelDispatchTable<Kernels,
          internal::KernelTypeList<Params...>,
          internal::KernelTypeList<OptParams...>>
 {
-   using TableType =
-      std::unordered_map<std::tuple<Params...>, Signature, TupleHasher>;
+   using KeyType = std::tuple<Params...>;
+   using TableType = std::unordered_map<KeyType, Signature, TupleHasher>;
    TableType table;
 
+   /// A registered kernel, with its (dispatch and optional) parameters.
+   struct Variant
+   {
+      std::string name;
+      Signature kernel;
+   };
+   /// All the registered variants for each dispatch key.
+   std::unordered_map<KeyType, std::vector<Variant>, TupleHasher> variants;
+
+   /// Autotuning state for a dispatch key, see RunTuned().
+   struct TuningState
+   {
+      std::vector<Variant> candidates;
+      std::vector<double> times;
+      int calls = 0;
+      int chosen = -1;
+   };
+   std::unordered_map<KeyType, TuningState, TupleHasher> tuning;
+
+   /// Register @a kernel as a variant of the dispatch key @a key.
+   static void AddVariant(const KeyType &key, const std::string &name,
+                          Signature kernel)
+   {
+      Kernels::Get().table[key] = kernel;
+      std::vector<Variant> &vars = Kernels::Get().variants[key];
+      for (Variant &v : vars)
+      {
+         if (v.name == name) { v.kernel = kernel; return; }
+      }
+      vars.push_back({name, kernel});
+      Kernels::Get().tuning.erase(key);
+   }
+
    /// @brief Call function @a f with arguments @a args (perfect forwaring).
    ///
    /// Only valid when the function @a f is not a member function.
@@ -126,12 +171,73 @@ class KernelDispatchTable<Kernels,
       (t.*f)(std::forward<Args>(args)...);
    }
 
+   /// @brief Run one of the variants registered for @a key, or the fallback
+   /// kernel, timing it, until all of them have been timed
+   /// KernelAutotuner::GetNumTrials() times; then run the fastest one.
+   ///
+   /// The choice is stored in (and read from) the KernelAutotuner cache.
+   template<typename... Args>
+   static void RunTuned(const KeyType &key, const std::vector<Variant> &vars,
+                        Params... params, Args&&... args)
+   {
+      Kernels &kernels = Kernels::Get();
+      TuningState &state = kernels.tuning[key];
+      if (state.candidates.empty())
+      {
+         state.candidates = vars;
+         state.candidates.push_back({"fallback", Kernels::Fallback(params...)});
+         state.times.assign(state.candidates.size(),
+                            std::numeric_limits<double>::infinity());
+         std::string cached;
+         if (KernelAutotuner::Lookup(kernels.kernel_name,
+                                     internal::Stringify(params...), cached))
+         {
+            for (size_t i = 0; i < state.candidates.size(); i++)
+            {
+               if (state.candidates[i].name == cached) { state.chosen = int(i); }
+            }
+         }
+      }
+      if (state.chosen >= 0)
+      {
+         Invoke(state.candidates[state.chosen].kernel,
+                std::forward<Args>(args)...);
+         return;
+      }
+
+      const int num_candidates = int(state.candidates.size());
+      const int i = state.calls % num_candidates;
+      StopWatch sw;
+      MFEM_DEVICE_SYNC;
+      sw.Start();
+      Invoke(state.candidates[i].kernel, std::forward<Args>(args)...);
+      MFEM_DEVICE_SYNC;
+      sw.Stop();
+      state.times[i] = std::min(state.times[i], sw.RealTime());
+
+      if (++state.calls == num_candidates*KernelAutotuner::GetNumTrials())
+      {
+         int best = 0;
+         for (int j = 1; j < num_candidates; j++)
+         {
+            if (state.times[j] < state.times[best]) { best = j; }
+         }
+         state.chosen = best;
+         KernelAutotuner::Store(kernels.kernel_name,
+                                internal::Stringify(params...),
+                                state.candidates[best].name,
+                                state.times[best]);
+      }
+   }
+
 public:
    /// @brief Run the kernel with the given dispatch parameters and arguments.
    ///
    /// If a compile-time specialized version of the kernel with the given
    /// parameters has been registered, it will be called. Otherwise, the
-   /// fallback kernel will be called.
+   /// fallback kernel will be called. When autotuning is enabled (see
+   /// KernelAutotuner) and specializations are registered for the parameters,
+   /// the fastest of them (or the fallback kernel) is selected.
    ///
    /// If the kernel is a member function, then the first argument after @a
    /// params should be the object on which it is called.
@@ -141,7 +247,12 @@ public:
       const auto &table = Kernels::Get().table;
       const std::tuple<Params...> key = std::make_tuple(params...);
       const auto it = table.find(key);
-      if (it != table.end())
+      if (it != table.end() && KernelAutotuner::IsEnabled())
+      {
+         RunTuned(key, Kernels::Get().variants.at(key), params...,
+                  std::forward<Args>(args)...);
+      }
+      else if (it != table.end())
       {
          Invoke(it->second, std::forward<Args>(args)...);
       }
@@ -160,8 +271,8 @@ public:
       static void Add()
       {
          std::tuple<Params...> param_tuple(PARAMS...);
-         Kernels::Get().table[param_tuple] =
-            Kernels:: template Kernel<PARAMS..., OptParams{}...>();
+         AddVariant(param_tuple, internal::Stringify(PARAMS..., OptParams{}...),
+                    Kernels:: template Kernel<PARAMS..., OptParams{}...>());
       };
       // Version with optional parameters
       template <OptParams... OPT_PARAMS>
@@ -170,8 +281,8 @@ public:
          static void Add()
          {
             std::tuple<Params...> param_tuple(PARAMS...);
-            Kernels::Get().table[param_tuple] =
-               Kernels:: template Kernel<PARAMS..., OPT_PARAMS...>();
+            AddVariant(param_tuple, internal::Stringify(PARAMS..., OPT_PARAMS...),
+                       Kernels:: template Kernel<PARAMS..., OPT_PARAMS...>());
          }
       };
    };
@@ -25,7 +25,9 @@ PANonlinearFormExtension::PANonlinearFormExtension(const NonlinearForm *nlf):
    NonlinearFormExtension(nlf),
    fes(*nlf->FESpace()),
    dnfi(*nlf->GetDNFI()),
+   fnfi(nlf->GetInteriorFaceIntegrators()),
    elemR(nullptr),
+   intFaceR(nullptr),
    Grad(*this)
 {
    if (!DeviceCanUseCeed())
@@ -38,6 +40,18 @@ PANonlinearFormExtension::PANonlinearFormExtension(const NonlinearForm *nlf):
    ye.UseDevice(true);
 }
 
+void PANonlinearFormExtension::SetupFaceRestriction()
+{
+   if (fnfi.Size() == 0) { intFaceR = nullptr; return; }
+   MFEM_VERIFY(!DeviceCanUseCeed(), "face integrators are not supported with"
+               " the Ceed backends");
+   intFaceR = fes.GetFaceRestriction(ElementDofOrdering::LEXICOGRAPHIC,
+                                     FaceType::Interior);
+   xf.SetSize(intFaceR->Height(), Device::GetMemoryType());
+   yf.SetSize(intFaceR->Height(), Device::GetMemoryType());
+   yf.UseDevice(true);
+}
+
 real_t PANonlinearFormExtension::GetGridFunctionEnergy(const Vector &x) const
 {
    real_t energy = 0.0;
@@ -52,11 +66,12 @@ real_t PANonlinearFormExtension::GetGridFunctionEnergy(const Vector &x) const
 
 void PANonlinearFormExtension::Assemble()
 {
-   MFEM_VERIFY(nlf->GetInteriorFaceIntegrators().Size() == 0 &&
-               nlf->GetBdrFaceIntegrators().Size() == 0,
-               "face integrators are not supported yet");
+   MFEM_VERIFY(nlf->GetBdrFaceIntegrators().Size() == 0,
+               "boundary face integrators are not supported yet");
 
+   SetupFaceRestriction();
    for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AssemblePA(fes); }
+   for (int i = 0; i < fnfi.Size(); ++i) { fnfi[i]->AssemblePAInteriorFaces(fes); }
 }
 
 void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
@@ -67,6 +82,16 @@ void PANonlinearFormExtension::Mult(const Vector &x, Vector &y) const
       elemR->Mult(x, xe);
       for (int i = 0; i < dnfi.Size(); ++i) { dnfi[i]->AddMultPA(xe, ye); }
       elemR->MultTranspose(ye, y);
+      if (intFaceR && xf.Size() > 0)
+      {
+         yf = 0.0;
+         intFaceR->Mult(x, xf);
+         for (int i = 0; i < fnfi.Size(); ++i)
+         {
+            fnfi[i]->AddMultPAInteriorFaces(xf, yf);
+         }
+         intFaceR->AddMultTransposeInPlace(yf, y);
+      }
    }
    else
    {
@@ -91,6 +116,7 @@ void PANonlinearFormExtension::Update()
    elemR = fes.GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
    xe.SetSize(elemR->Height());
    ye.SetSize(elemR->Height());
+   SetupFaceRestriction();
    Grad.Update();
 }
 
@@ -100,6 +126,8 @@ PANonlinearFormExtension::Gradient::Gradient(const PANonlinearFormExtension &e):
 
 void PANonlinearFormExtension::Gradient::AssembleGrad(const Vector &g)
 {
+   MFEM_VERIFY(ext.fnfi.Size() == 0,
+               "the gradient of face integrators is not supported yet");
    ext.elemR->Mult(g, ext.xe);
    for (int i = 0; i < ext.dnfi.Size(); ++i)
    {
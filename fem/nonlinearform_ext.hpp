@@ -90,11 +90,17 @@ private:
 
 protected:
    mutable Vector xe, ye;
+   mutable Vector xf, yf; // interior face E-vectors
    const FiniteElementSpace &fes;
    const Array<NonlinearFormIntegrator*> &dnfi;
+   const Array<NonlinearFormIntegrator*> &fnfi;
    const Operator *elemR; // not owned
+   const FaceRestriction *intFaceR; // not owned
    mutable Gradient Grad;
 
+   /// Set up the interior face restriction, if there are face integrators.
+   void SetupFaceRestriction();
+
 public:
    PANonlinearFormExtension(const NonlinearForm *nlf);
 
@@ -35,6 +35,12 @@ void NonlinearFormIntegrator::AssemblePA(const FiniteElementSpace &,
                "   is not implemented for this class.");
 }
 
+void NonlinearFormIntegrator::AssemblePAInteriorFaces(const FiniteElementSpace&)
+{
+   mfem_error ("NonlinearFormIntegrator::AssemblePAInteriorFaces(...)\n"
+               "   is not implemented for this class.");
+}
+
 void NonlinearFormIntegrator::AssembleGradPA(const Vector &x,
                                              const FiniteElementSpace &fes)
 {
@@ -48,6 +54,13 @@ void NonlinearFormIntegrator::AddMultPA(const Vector &, Vector &) const
                "   is not implemented for this class.");
 }
 
+void NonlinearFormIntegrator::AddMultPAInteriorFaces(const Vector &,
+                                                     Vector &) const
+{
+   mfem_error ("NonlinearFormIntegrator::AddMultPAInteriorFaces(...)\n"
+               "   is not implemented for this class.");
+}
+
 void NonlinearFormIntegrator::AddMultGradPA(const Vector&, Vector&) const
 {
    mfem_error ("NonlinearFormIntegrator::AddMultGradPA(...)\n"
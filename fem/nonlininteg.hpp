@@ -99,6 +99,11 @@ public:
    virtual void AssemblePA(const FiniteElementSpace &trial_fes,
                            const FiniteElementSpace &test_fes);
 
+   /// Method defining partial assembly on interior faces.
+   /** The result of the partial assembly is stored internally so that it can be
+       used later in the method AddMultPAInteriorFaces(). */
+   virtual void AssemblePAInteriorFaces(const FiniteElementSpace &fes);
+
    /** @brief Prepare the integrator for partial assembly (PA) gradient
        evaluations on the given FE space @a fes at the state @a x. */
    /** The result of the partial assembly is stored internally so that it can be
@@ -120,6 +125,15 @@ public:
        called. */
    virtual void AddMultPA(const Vector &x, Vector &y) const;
 
+   /// Method for partially assembled action on interior faces.
+   /** Perform the action of integrator on the input @a x and add the result to
+       the output @a y. Both @a x and @a y are double-valued face E-vectors,
+       see L2FaceRestriction.
+
+       This method can be called only after the method
+       AssemblePAInteriorFaces() has been called. */
+   virtual void AddMultPAInteriorFaces(const Vector &x, Vector &y) const;
+
    /// Method for partially assembled gradient action.
    /** All arguments are E-vectors. This method can be called only after the
        method AssembleGradPA() has been called.
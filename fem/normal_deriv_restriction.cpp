@@ -603,7 +603,6 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose2D(
          MFEM_FOREACH_THREAD(p,y,q)
          {
             G(p,i) = a * G_(p,i);
-            xx(p,i) = 0.0;
          }
       }
 
@@ -622,28 +621,52 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose2D(
       }
       MFEM_SYNC_THREAD;
 
-      for (int face_id=0; face_id < 4; ++face_id)
+      for (int c = 0; c < vd; ++c)
       {
-         const int f = faces[face_id];
+         MFEM_FOREACH_THREAD(k,x,d)
+         {
+            MFEM_FOREACH_THREAD(l,y,d)
+            {
+               xx(k,l) = 0.0;
+            }
+         }
+         MFEM_SYNC_THREAD;
 
-         if (f < 0) { continue; }
+         for (int face_id=0; face_id < 4; ++face_id)
+         {
+            const int f = faces[face_id];
 
-         const int side = sides[face_id];
+            if (f < 0) { continue; }
 
-         if (MFEM_THREAD_ID(y) == 0)
-         {
-            MFEM_FOREACH_THREAD(p,x,d)
+            const int side = sides[face_id];
+
+            if (MFEM_THREAD_ID(y) == 0)
             {
-               y_s[p] = d_y(p, 0, side, f);
+               MFEM_FOREACH_THREAD(p,x,d)
+               {
+                  y_s[p] = d_y(p, c, side, f);
 
-               const int ij = f2v(p, side, f);
-               const int i = ij % q;
-               const int j = ij / q;
+                  const int ij = f2v(p, side, f);
+                  const int i = ij % q;
+                  const int j = ij / q;
+
+                  pp[(face_id == 0 || face_id == 2) ? i : j] = p;
+                  if (MFEM_THREAD_ID(x) == 0)
+                  {
+                     jj = (face_id == 0 || face_id == 2) ? j : i;
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
 
-               pp[(face_id == 0 || face_id == 2) ? i : j] = p;
-               if (MFEM_THREAD_ID(x) == 0)
+            MFEM_FOREACH_THREAD(k,x,d)
+            {
+               MFEM_FOREACH_THREAD(l,y,d)
                {
-                  jj = (face_id == 0 || face_id == 2) ? j : i;
+                  const int p = (face_id == 0 || face_id == 2) ? pp[k] : pp[l];
+                  const int kk = (face_id == 0 || face_id == 2) ? l : k;
+                  const real_t g = G(jj, kk);
+                  xx(k,l) += g * y_s[p];
                }
             }
          }
@@ -653,22 +676,10 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose2D(
          {
             MFEM_FOREACH_THREAD(l,y,d)
             {
-               const int p = (face_id == 0 || face_id == 2) ? pp[k] : pp[l];
-               const int kk = (face_id == 0 || face_id == 2) ? l : k;
-               const real_t g = G(jj, kk);
-               xx(k,l) += g * y_s[p];
+               d_x(t?c:k, t?k:l, t?l:el, t?el:c) += xx(k,l);
             }
          }
-      }
-      MFEM_SYNC_THREAD;
-
-      MFEM_FOREACH_THREAD(k,x,d)
-      {
-         MFEM_FOREACH_THREAD(l,y,d)
-         {
-            const int c = 0;
-            d_x(t?c:k, t?k:l, t?l:el, t?el:c) += xx(k,l);
-         }
+         MFEM_SYNC_THREAD;
       }
    });
 }
@@ -680,8 +691,6 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose3D(
    const int vd = fes.GetVDim();
    const bool t = fes.GetOrdering() == Ordering::byVDIM;
 
-   MFEM_VERIFY(vd == 1, "vdim > 1 not supported.");
-
    const FiniteElement &fe = *fes.GetTypicalFE();
    const DofToQuad &maps = fe.GetDofToQuad(fe.GetNodes(), DofToQuad::TENSOR);
 
@@ -746,81 +755,87 @@ void L2NormalDerivativeFaceRestriction::AddMultTranspose3D(
          }
       }
 
-      MFEM_FOREACH_THREAD(k, x, d)
+      MFEM_SYNC_THREAD;
+
+      for (int c = 0; c < vd; ++c)
       {
-         MFEM_FOREACH_THREAD(j, y, d)
+         MFEM_FOREACH_THREAD(k, x, d)
          {
-            for (int i = 0; i < d; ++i)
+            MFEM_FOREACH_THREAD(j, y, d)
             {
-               xx(i, j, k) = 0.0;
+               for (int i = 0; i < d; ++i)
+               {
+                  xx(i, j, k) = 0.0;
+               }
             }
          }
-      }
-      MFEM_SYNC_THREAD;
-
-      for (int face_id = 0; face_id < 6; ++face_id)
-      {
-         const int f = faces[face_id];
+         MFEM_SYNC_THREAD;
 
-         if (f < 0)
+         for (int face_id = 0; face_id < 6; ++face_id)
          {
-            continue;
-         }
+            const int f = faces[face_id];
 
-         const int side = sides[face_id];
+            if (f < 0)
+            {
+               continue;
+            }
 
-         // is this face parallel to the x-y plane in reference coordinates?
-         const bool xy_plane = (face_id == 0 || face_id == 5);
-         const bool xz_plane = (face_id == 1 || face_id == 3);
+            const int side = sides[face_id];
 
-         MFEM_FOREACH_THREAD(p1, x, q)
-         {
-            MFEM_FOREACH_THREAD(p2, y, q)
+            // is this face parallel to the x-y plane in reference coordinates?
+            const bool xy_plane = (face_id == 0 || face_id == 5);
+            const bool xz_plane = (face_id == 1 || face_id == 3);
+
+            MFEM_FOREACH_THREAD(p1, x, q)
             {
-               const int p = p1 + q * p2;
-               y_s[p] = d_y(p, 0, side, f);
+               MFEM_FOREACH_THREAD(p2, y, q)
+               {
+                  const int p = p1 + q * p2;
+                  y_s[p] = d_y(p, c, side, f);
 
-               const int ijk = f2v(p, side, f);
-               const int k = ijk / q2d;
-               const int i = ijk % q;
-               const int j = (ijk - q2d*k) / q;
+                  const int ijk = f2v(p, side, f);
+                  const int k = ijk / q2d;
+                  const int i = ijk % q;
+                  const int j = (ijk - q2d*k) / q;
+
+                  pp[(xy_plane || xz_plane) ? i : j][(xy_plane) ? j : k] = p;
+                  if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0)
+                  {
+                     jj = (xy_plane) ? k : (xz_plane) ? j : i;
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
 
-               pp[(xy_plane || xz_plane) ? i : j][(xy_plane) ? j : k] = p;
-               if (MFEM_THREAD_ID(x) == 0 && MFEM_THREAD_ID(y) == 0)
+            MFEM_FOREACH_THREAD(n, x, d)
+            {
+               MFEM_FOREACH_THREAD(m, y, d)
                {
-                  jj = (xy_plane) ? k : (xz_plane) ? j : i;
+                  for (int l = 0; l < d; ++l)
+                  {
+                     const int p = (xy_plane) ? pp[l][m] :
+                                   (xz_plane) ? pp[l][n] : pp[m][n];
+                     const int kk = (xy_plane) ? n : (xz_plane) ? m : l;
+                     const real_t g = G(jj, kk);
+                     xx(l, m, n) += g * y_s[p];
+                  }
                }
             }
          }
          MFEM_SYNC_THREAD;
 
+         // map back to global array
          MFEM_FOREACH_THREAD(n, x, d)
          {
             MFEM_FOREACH_THREAD(m, y, d)
             {
                for (int l = 0; l < d; ++l)
                {
-                  const int p = (xy_plane) ? pp[l][m] : (xz_plane) ? pp[l][n] : pp[m][n];
-                  const int kk = (xy_plane) ? n : (xz_plane) ? m : l;
-                  const real_t g = G(jj, kk);
-                  xx(l, m, n) += g * y_s[p];
+                  d_x(t?c:l, t?l:m, t?m:n, t?n:el, t?el:c) += xx(l, m, n);
                }
             }
          }
-      }
-      MFEM_SYNC_THREAD;
-
-      // map back to global array
-      MFEM_FOREACH_THREAD(n, x, d)
-      {
-         MFEM_FOREACH_THREAD(m, y, d)
-         {
-            for (int l = 0; l < d; ++l)
-            {
-               const int c = 0;
-               d_x(t?c:l, t?l:m, t?m:n, t?n:el, t?el:c) += xx(l, m, n);
-            }
-         }
+         MFEM_SYNC_THREAD;
       }
    });
 }
@@ -19,6 +19,25 @@
 namespace mfem
 {
 
+MemoryReport ParBilinearForm::GetMemoryReport() const
+{
+   MemoryReport report("ParBilinearForm");
+   report.AddChild(BilinearForm::GetMemoryReport());
+   MemoryReport aux("auxiliary vectors");
+   aux.Add(Xaux.GetMemory()).Add(Yaux.GetMemory()).Add(Ytmp.GetMemory());
+   report.AddChild(aux);
+   if (p_mat.Ptr() && p_mat.Type() == Operator::Hypre_ParCSR)
+   {
+      report.AddChild(p_mat.As<HypreParMatrix>()->GetMemoryReport("p_mat"));
+   }
+   if (p_mat_e.Ptr() && p_mat_e.Type() == Operator::Hypre_ParCSR)
+   {
+      report.AddChild(
+         p_mat_e.As<HypreParMatrix>()->GetMemoryReport("p_mat_e"));
+   }
+   return report;
+}
+
 void ParBilinearForm::pAllocMat()
 {
    int nbr_size = pfes->GetFaceNbrVSize();
@@ -281,6 +281,9 @@ public:
 
    void Update(FiniteElementSpace *nfes = NULL) override;
 
+   /// Return a report of the memory held by the local and parallel form.
+   MemoryReport GetMemoryReport() const override;
+
    virtual ~ParBilinearForm() { }
 };
 
@@ -284,6 +284,30 @@ void ParFiniteElementSpace::Construct()
    }
 }
 
+MemoryReport ParFiniteElementSpace::GetMemoryReport() const
+{
+   MemoryReport report("ParFiniteElementSpace");
+   report.AddChild(FiniteElementSpace::GetMemoryReport());
+
+   MemoryReport dofs("parallel dof maps");
+   dofs.Add(ldof_group.GetMemory()).Add(ldof_ltdof.GetMemory());
+   dofs.Add(ldof_sign.GetMemory()).Add(dof_offsets.GetMemory());
+   dofs.Add(tdof_offsets.GetMemory()).Add(tdof_nb_offsets.GetMemory());
+   report.AddChild(dofs);
+
+   if (P) { report.AddChild(P->GetMemoryReport("P")); }
+   if (R) { report.AddChild(R->GetMemoryReport("R")); }
+
+   MemoryReport face_nbr("face neighbors");
+   face_nbr.Add("face_nbr_element_dof", face_nbr_element_dof)
+   .Add("face_nbr_element_fos", face_nbr_element_fos)
+   .Add("face_nbr_ldof", face_nbr_ldof)
+   .Add("send_face_nbr_ldof", send_face_nbr_ldof);
+   face_nbr.Add(face_nbr_glob_dof_map.GetMemory());
+   report.AddChild(face_nbr);
+   return report;
+}
+
 void ParFiniteElementSpace::PrintPartitionStats()
 {
    long long ltdofs = ltdof_size;
@@ -5219,6 +5243,13 @@ ConformingProlongationOperator::ConformingProlongationOperator(
 }
 
 void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
+{
+   MultBegin(x, y);
+   MultEnd(y);
+}
+
+void ConformingProlongationOperator::MultBegin(const Vector &x,
+                                               Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Width(), "");
    MFEM_ASSERT(y.Size() == Height(), "");
@@ -5245,16 +5276,26 @@ void ConformingProlongationOperator::Mult(const Vector &x, Vector &y) const
       j = end+1;
    }
    if (Width() > (j-m)) { std::copy(xdata+j-m, xdata+Width(), ydata+j); }
+}
 
+void ConformingProlongationOperator::MultEnd(Vector &y) const
+{
    const int out_layout = 0; // 0 - output is ldofs array
    if (!local)
    {
-      gc.BcastEnd(ydata, out_layout);
+      gc.BcastEnd(y.HostReadWrite(), out_layout);
    }
 }
 
 void ConformingProlongationOperator::MultTranspose(
    const Vector &x, Vector &y) const
+{
+   MultTransposeBegin(x, y);
+   MultTransposeEnd(y);
+}
+
+void ConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x, Vector &y) const
 {
    MFEM_ASSERT(x.Size() == Height(), "");
    MFEM_ASSERT(y.Size() == Width(), "");
@@ -5276,18 +5317,23 @@ void ConformingProlongationOperator::MultTranspose(
       j = end+1;
    }
    if (Height() > j) { std::copy(xdata+j, xdata+Height(), ydata+j-m); }
+}
 
+void ConformingProlongationOperator::MultTransposeEnd(Vector &y) const
+{
    const int out_layout = 2; // 2 - output is an array on all ltdofs
    if (!local)
    {
-      gc.ReduceEnd<real_t>(ydata, out_layout, GroupCommunicator::Sum);
+      gc.ReduceEnd<real_t>(y.HostReadWrite(), out_layout,
+                           GroupCommunicator::Sum);
    }
 }
 
 DeviceConformingProlongationOperator::DeviceConformingProlongationOperator(
    const GroupCommunicator &gc_, const SparseMatrix *R, bool local_)
    : ConformingProlongationOperator(R->Width(), gc_, local_),
-     mpi_gpu_aware(Device::GetGPUAwareMPI())
+     mpi_gpu_aware(Device::GetGPUAwareMPI()),
+     num_requests(0)
 {
    MFEM_ASSERT(R->Finalized(), "");
    const int tdofs = R->Height();
@@ -5419,8 +5465,8 @@ void DeviceConformingProlongationOperator::BcastEndCopy(
    SetSubVector(ext_ldof, ext_buf, y);
 }
 
-void DeviceConformingProlongationOperator::Mult(const Vector &x,
-                                                Vector &y) const
+void DeviceConformingProlongationOperator::MultBegin(const Vector &x,
+                                                     Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    int req_counter = 0;
@@ -5459,10 +5505,15 @@ void DeviceConformingProlongationOperator::Mult(const Vector &x,
          }
       }
    }
+   num_requests = req_counter;
    BcastLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultEnd(Vector &y) const
+{
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
       BcastEndCopy(y); // copy from 'ext_buf'
    }
 }
@@ -5521,8 +5572,8 @@ void DeviceConformingProlongationOperator::ReduceEndAssemble(Vector &y) const
    AddSubVector(unq_ltdof, unq_shr_i, unq_shr_j, shr_buf, y);
 }
 
-void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
-                                                         Vector &y) const
+void DeviceConformingProlongationOperator::MultTransposeBegin(
+   const Vector &x, Vector &y) const
 {
    const GroupTopology &gtopo = gc.GetGroupTopology();
    int req_counter = 0;
@@ -5551,10 +5602,15 @@ void DeviceConformingProlongationOperator::MultTranspose(const Vector &x,
          }
       }
    }
+   num_requests = req_counter;
    ReduceLocalCopy(x, y);
+}
+
+void DeviceConformingProlongationOperator::MultTransposeEnd(Vector &y) const
+{
    if (!local)
    {
-      MPI_Waitall(req_counter, requests, MPI_STATUSES_IGNORE);
+      MPI_Waitall(num_requests, requests, MPI_STATUSES_IGNORE);
       ReduceEndAssemble(y); // assemble from 'shr_buf'
    }
 }
@@ -534,6 +534,11 @@ public:
    /// Returns the maximum polynomial order over all elements globally.
    int GetMaxElementOrder() const override;
 
+   /** @brief Return a report of the memory held by the local space and by
+       the parallel dof maps, prolongation and restriction, and face-neighbor
+       data. */
+   MemoryReport GetMemoryReport() const override;
+
    virtual ~ParFiniteElementSpace() { Destroy(); }
 
    void PrintPartitionStats();
@@ -593,6 +598,10 @@ public:
 
    const GroupCommunicator &GetGroupCommunicator() const;
 
+   /// Return the sorted list of the external ldofs, i.e. the shared ldofs that
+   /// are not owned by this rank.
+   const Array<int> &GetExternalLDofs() const { return external_ldofs; }
+
    void Mult(const Vector &x, Vector &y) const override;
 
    void AbsMult(const Vector &x, Vector &y) const override
@@ -602,6 +611,25 @@ public:
 
    void AbsMultTranspose(const Vector &x, Vector &y) const override
    { MultTranspose(x,y); }
+
+   /** @brief Start the computation of y = P x: start the exchange of the shared
+       dofs and set the ldofs of @a y owned by this rank. */
+   /** The external ldofs of @a y are set by the matching call to MultEnd().
+       Mult() is equivalent to MultBegin() followed by MultEnd(). */
+   virtual void MultBegin(const Vector &x, Vector &y) const;
+
+   /// Complete the computation of y = P x started by MultBegin().
+   virtual void MultEnd(Vector &y) const;
+
+   /** @brief Start the computation of y = P^T x: start the exchange of the
+       external ldofs of @a x and set @a y to the values of the owned ldofs. */
+   /** MultTranspose() is equivalent to MultTransposeBegin() followed by
+       MultTransposeEnd(). */
+   virtual void MultTransposeBegin(const Vector &x, Vector &y) const;
+
+   /** @brief Complete the computation of y = P^T x started by
+       MultTransposeBegin(), adding the received contributions to @a y. */
+   virtual void MultTransposeEnd(Vector &y) const;
 };
 
 /// Auxiliary device class used by ParFiniteElementSpace.
@@ -616,6 +644,7 @@ protected:
    Array<int> ltdof_ldof, unq_ltdof;
    Array<int> unq_shr_i, unq_shr_j;
    MPI_Request *requests;
+   mutable int num_requests;
 
    // Kernel: copy ltdofs from 'src' to 'shr_buf' - prepare for send.
    //         shr_buf[i] = src[shr_ltdof[i]]
@@ -650,15 +679,13 @@ public:
 
    virtual ~DeviceConformingProlongationOperator();
 
-   void Mult(const Vector &x, Vector &y) const override;
+   void MultBegin(const Vector &x, Vector &y) const override;
 
-   void AbsMult(const Vector &x, Vector &y) const override
-   { Mult(x,y); }
+   void MultEnd(Vector &y) const override;
 
-   void MultTranspose(const Vector &x, Vector &y) const override;
+   void MultTransposeBegin(const Vector &x, Vector &y) const override;
 
-   void AbsMultTranspose(const Vector &x, Vector &y) const override
-   { MultTranspose(x,y); }
+   void MultTransposeEnd(Vector &y) const override;
 };
 
 }
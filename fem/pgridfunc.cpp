@@ -16,6 +16,7 @@
 #include "fem.hpp"
 #include <iostream>
 #include <limits>
+#include "../general/binary_sections.hpp"
 #include "../general/forall.hpp"
 using namespace std;
 
@@ -1473,6 +1474,108 @@ std::unique_ptr<ParGridFunction> ParGridFunction::ProlongateToMaxOrder() const
    return std::unique_ptr<ParGridFunction>(xMax);
 }
 
+void ParGridFunction::SaveRestart(const std::string &fname) const
+{
+   MFEM_VERIFY(!pfes->IsVariableOrder() && pfes->GetNURBSext() == NULL,
+               "variable order and NURBS spaces are not supported");
+   const int ne = pfes->GetNE();
+
+   // offsets of the global element numbers of all ranks
+   const int nranks = pfes->GetNRanks(), myid = pfes->GetMyRank();
+   Array<long long> offsets(nranks + 1);
+   const long long lne = ne;
+   offsets[0] = 0;
+   MPI_Allgather(&lne, 1, MPI_LONG_LONG, offsets.GetData() + 1, 1,
+                 MPI_LONG_LONG, pfes->GetComm());
+   for (int i = 0; i < nranks; i++) { offsets[i+1] += offsets[i]; }
+
+   // the element-wise values do not depend on the partitioning
+   Array<int> dof_offsets(ne + 1);
+   Array<real_t> values;
+   Vector el_values;
+   dof_offsets[0] = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      GetElementDofValues(i, el_values);
+      dof_offsets[i+1] = dof_offsets[i] + el_values.Size();
+      values.Append(el_values.GetData(), el_values.Size());
+   }
+
+   BinarySectionWriter out;
+   out.AddString("fec", pfes->FEColl()->Name());
+   out.AddValue("vdim", pfes->GetVDim());
+   out.AddValue("ordering", int(pfes->GetOrdering()));
+   out.Add("element_offsets", offsets);
+   out.Add("dof_offsets", dof_offsets);
+   out.Add("values", values);
+
+   const std::string name = MakeParFilename(fname + ".", myid);
+   ofstream ofs(name, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << name);
+   out.Write(ofs, "MFEM restart grid function v1.0");
+}
+
+std::unique_ptr<ParGridFunction> ParGridFunction::LoadRestart(
+   ParMesh *pmesh, const std::string &fname)
+{
+   FiniteElementCollection *fec;
+   ParFiniteElementSpace *pfes;
+   Array<long long> offsets;
+   {
+      BinarySectionReader input(MakeParFilename(fname + ".", 0));
+      MFEM_VERIFY(input.GetType() == "MFEM restart grid function v1.0",
+                  "invalid restart grid function file: " << fname);
+      fec = FiniteElementCollection::New(input.GetString("fec").c_str());
+      const int vdim = input.GetValue<int>("vdim");
+      const int ordering = input.GetValue<int>("ordering");
+      pfes = new ParFiniteElementSpace(pmesh, fec, vdim,
+                                       Ordering::Type(ordering));
+      std::size_t size;
+      const long long *off = input.GetData<long long>("element_offsets", size);
+      offsets.SetSize(int(size));
+      std::copy(off, off + size, offsets.GetData());
+   }
+   MFEM_VERIFY(offsets.Last() == pmesh->GetGlobalNE(),
+               "the grid function does not match the mesh");
+
+   ParGridFunction *gf = new ParGridFunction(pfes);
+   gf->MakeOwner(fec);
+
+   // this rank has the global elements [first,last)
+   const int ne = pmesh->GetNE();
+   const long long first = pmesh->GetGlobalElementNum(0);
+   const long long last = first + ne;
+
+   Array<int> vdofs;
+   DofTransformation doftrans;
+   Vector el_values;
+   for (int f = 0; f < offsets.Size() - 1; f++)
+   {
+      if (offsets[f+1] <= first || offsets[f] >= last) { continue; }
+
+      BinarySectionReader input(MakeParFilename(fname + ".", f));
+      std::size_t size;
+      const int *dof_off = input.GetData<int>("dof_offsets", size);
+      real_t *values = input.GetData<real_t>("values", size);
+
+      const long long begin = std::max(first, offsets[f]);
+      const long long end = std::min(last, offsets[f+1]);
+      for (long long e = begin; e < end; e++)
+      {
+         const int k = int(e - offsets[f]);
+         el_values.SetDataAndSize(values + dof_off[k],
+                                  dof_off[k+1] - dof_off[k]);
+         const int i = int(e - first);
+         pfes->GetElementVDofs(i, vdofs, doftrans);
+         MFEM_VERIFY(vdofs.Size() == el_values.Size(),
+                     "the grid function does not match the mesh");
+         doftrans.TransformPrimal(el_values);
+         gf->SetSubVector(vdofs, el_values);
+      }
+   }
+   return std::unique_ptr<ParGridFunction>(gf);
+}
+
 real_t L2ZZErrorEstimator(BilinearFormIntegrator &flux_integrator,
                           const ParGridFunction &x,
                           ParFiniteElementSpace &smooth_flux_fes,
@@ -679,6 +679,23 @@ public:
        maximum order of all elements in the mesh. */
    std::unique_ptr<ParGridFunction> ProlongateToMaxOrder() const;
 
+   /** @brief Save the ParGridFunction for a restart with LoadRestart(),
+       possibly on a different number of MPI ranks.
+
+       Each rank writes the element-wise values of its elements to the binary
+       file "<fname>.<rank>". Variable order and NURBS spaces are not
+       supported. See also ParMesh::SaveRestart(). */
+   void SaveRestart(const std::string &fname) const;
+
+   /** @brief Load a ParGridFunction saved with SaveRestart() on @a pmesh,
+       which must have the same global elements, in the same order, e.g. a mesh
+       loaded with ParMesh::LoadRestart().
+
+       The returned ParGridFunction owns its FiniteElementCollection and
+       ParFiniteElementSpace. */
+   static std::unique_ptr<ParGridFunction>
+   LoadRestart(ParMesh *pmesh, const std::string &fname);
+
    virtual ~ParGridFunction() = default;
 };
 
@@ -12,6 +12,7 @@
 #include "qfunction.hpp"
 #include "quadinterpolator.hpp"
 #include "quadinterpolator_face.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/forall.hpp"
 #include "../mesh/pmesh.hpp"
 
@@ -56,6 +57,42 @@ void QuadratureFunction::Save(std::ostream &os) const
    os.flush();
 }
 
+QuadratureFunction::QuadratureFunction(Mesh *mesh,
+                                       const BinarySectionReader &input)
+   : QuadratureFunction()
+{
+   MFEM_VERIFY(input.GetType() == "MFEM binary quadrature function v1.0",
+               "invalid binary quadrature function: " << input.GetType());
+
+   qspace = new QuadratureSpace(mesh, input.GetValue<int>("order"));
+   own_qspace = true;
+   vdim = input.GetValue<int>("vdim");
+
+   std::size_t size;
+   real_t *qf_data = input.GetData<real_t>("data", size);
+   MFEM_VERIFY(size == std::size_t(vdim*qspace->GetSize()),
+               "invalid binary quadrature function: wrong data size");
+   SetDataAndSize(qf_data, int(size));
+}
+
+void QuadratureFunction::SaveBinary(std::ostream &os) const
+{
+   MFEM_VERIFY(dynamic_cast<const QuadratureSpace*>(qspace),
+               "only QuadratureSpace is supported by the binary format");
+   BinarySectionWriter out;
+   out.AddValue("order", qspace->GetOrder());
+   out.AddValue("vdim", vdim);
+   out.Add("data", HostRead(), std::size_t(Size()));
+   out.Write(os, "MFEM binary quadrature function v1.0");
+}
+
+void QuadratureFunction::SaveBinary(const std::string &fname) const
+{
+   std::ofstream ofs(fname, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << fname);
+   SaveBinary(ofs);
+}
+
 void QuadratureFunction::ProjectGridFunctionFallback(const GridFunction &gf)
 {
    if (gf.VectorDim() == 1)
@@ -83,6 +83,14 @@ public:
    /** The QuadratureFunction assumes ownership of the read QuadratureSpace. */
    QuadratureFunction(Mesh *mesh, std::istream &in);
 
+   /** @brief Create a QuadratureFunction on @a mesh from a file written by
+       SaveBinary().
+
+       The data is not copied: the QuadratureFunction references the section
+       "data" of @a input, which must outlive it. The QuadratureFunction
+       assumes ownership of the created QuadratureSpace. */
+   QuadratureFunction(Mesh *mesh, const BinarySectionReader &input);
+
    /// Get the vector dimension.
    int GetVDim() const { return vdim; }
 
@@ -191,6 +199,14 @@ public:
    /// Write the QuadratureFunction to the stream @a out.
    void Save(std::ostream &out) const;
 
+   /** @brief Write the QuadratureFunction to @a out using the "MFEM binary
+       quadrature function v1.0" format. Only QuadratureSpace%s (i.e. not
+       FaceQuadratureSpace%s) are supported. */
+   void SaveBinary(std::ostream &out) const;
+
+   /// Write the QuadratureFunction to the file @a fname using SaveBinary().
+   void SaveBinary(const std::string &fname) const;
+
    /// @brief Write the QuadratureFunction to @a out in VTU (ParaView) format.
    ///
    /// The data will be uncompressed if @a compression_level is zero, or if the
@@ -509,6 +509,7 @@ void QuadratureInterpolator::Mult(const Vector &e_vec,
                                   Vector &q_der,
                                   Vector &q_det) const
 {
+   MFEM_PERF_SCOPE("QuadratureInterpolator::Mult");
    using namespace internal::quadrature_interpolator;
 
    const int ne = fespace->GetNE();
@@ -583,6 +584,7 @@ void QuadratureInterpolator::MultHDiv(const Vector &e_vec,
                                       Vector &q_val,
                                       Vector &q_div) const
 {
+   MFEM_PERF_SCOPE("QuadratureInterpolator::MultHDiv");
    const int ne = fespace->GetNE();
    if (ne == 0) { return; }
    MFEM_VERIFY(fespace->IsVariableOrder() == false,
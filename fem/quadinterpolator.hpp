@@ -78,6 +78,13 @@ public:
    QuadratureInterpolator(const FiniteElementSpace &fes,
                           const QuadratureSpace &qs);
 
+   /// Return a report of the memory held by the auxiliary buffers.
+   MemoryReport GetMemoryReport() const
+   {
+      return MemoryReport("QuadratureInterpolator")
+             .Add("d_buffer", d_buffer.GetMemory());
+   }
+
    /** @brief Disable the use of tensor product evaluations, for tensor-product
        elements, e.g. quads and hexes. By default, tensor product evaluations
        are enabled. */
@@ -34,7 +34,8 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
      nedofs(ne*dof),
      offsets(ndofs+1),
      indices(ne*dof),
-     gather_map(ne*dof)
+     gather_map(ne*dof),
+     colored_scatter(false)
 {
    // Assuming all finite elements are the same.
    MFEM_VERIFY(!f.IsVariableOrder(), "Variable-order spaces are not supported");
@@ -115,6 +116,7 @@ ElementRestriction::ElementRestriction(const FiniteElementSpace &f,
 
 void ElementRestriction::Mult(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_SCOPE("ElementRestriction::Mult");
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -135,6 +137,32 @@ void ElementRestriction::Mult(const Vector& x, Vector& y) const
    });
 }
 
+void ElementRestriction::MultRange(const Vector& x, Vector& y, int e_begin,
+                                   int e_end) const
+{
+   MFEM_ASSERT(0 <= e_begin && e_begin <= e_end && e_end <= ne,
+               "invalid element range");
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd);
+   auto d_y = Reshape(y.ReadWrite(), nd, vd, ne);
+   auto d_gather_map = gather_map.Read();
+   const int offset = e_begin*dof;
+   mfem::forall(dof*(e_end - e_begin), [=] MFEM_HOST_DEVICE (int k)
+   {
+      const int i = offset + k;
+      const int gid = d_gather_map[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int c = 0; c < vd; ++c)
+      {
+         const real_t dof_value = d_x(t?c:j, t?j:c);
+         d_y(i % nd, c, i / nd) = plus ? dof_value : -dof_value;
+      }
+   });
+}
+
 void ElementRestriction::AbsMult(const Vector& x, Vector& y) const
 {
    // Assumes all elements have the same number of dofs
@@ -156,9 +184,57 @@ void ElementRestriction::AbsMult(const Vector& x, Vector& y) const
    });
 }
 
+template <bool ADD>
+void ElementRestriction::ColoredAddMultTranspose(const Vector& x,
+                                                 Vector& y) const
+{
+   const Table &colors = fes.GetElementColoring();
+   const int nd = dof;
+   const int vd = vdim;
+   const bool t = byvdim;
+   const int *h_gather_map = gather_map.HostRead();
+   auto h_x = Reshape(x.HostRead(), nd, vd, ne);
+   auto h_y = Reshape(ADD ? y.HostReadWrite() : y.HostWrite(),
+                      t?vd:ndofs, t?ndofs:vd);
+   if (!ADD)
+   {
+      for (int i = 0; i < vd*ndofs; i++) { h_y[i] = 0.0; }
+   }
+   for (int color = 0; color < colors.Size(); color++)
+   {
+      const int *elems = colors.GetRow(color);
+      const int n = colors.RowSize(color);
+      // The elements of one color do not share dofs: no write conflicts
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for (int k = 0; k < n; k++)
+      {
+         const int e = elems[k];
+         for (int d = 0; d < nd; d++)
+         {
+            const int gid = h_gather_map[d + nd*e];
+            const bool plus = gid >= 0;
+            const int j = plus ? gid : -1-gid;
+            for (int c = 0; c < vd; ++c)
+            {
+               const real_t dof_value = h_x(d, c, e);
+               h_y(t?c:j, t?j:c) += plus ? dof_value : -dof_value;
+            }
+         }
+      }
+   }
+}
+
 template <bool ADD>
 void ElementRestriction::TAddMultTranspose(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_SCOPE("ElementRestriction::MultTranspose");
+   if (colored_scatter)
+   {
+      ColoredAddMultTranspose<ADD>(x, y);
+      return;
+   }
    // Assumes all elements have the same number of dofs
    const int nd = dof;
    const int vd = vdim;
@@ -514,6 +590,7 @@ L2ElementRestriction::L2ElementRestriction(const FiniteElementSpace &fes)
 
 void L2ElementRestriction::Mult(const Vector &x, Vector &y) const
 {
+   MFEM_PERF_SCOPE("L2ElementRestriction::Mult");
    const int nd = ndof;
    const int vd = vdim;
    const bool t = byvdim;
@@ -534,6 +611,7 @@ void L2ElementRestriction::Mult(const Vector &x, Vector &y) const
 template <bool ADD>
 void L2ElementRestriction::TAddMultTranspose(const Vector &x, Vector &y) const
 {
+   MFEM_PERF_SCOPE("L2ElementRestriction::MultTranspose");
    const int nd = ndof;
    const int vd = vdim;
    const bool t = byvdim;
@@ -663,6 +741,7 @@ ConformingFaceRestriction::ConformingFaceRestriction(
 void ConformingFaceRestriction::MultInternal(const Vector& x, Vector& y,
                                              const bool useAbs) const
 {
+   MFEM_PERF_SCOPE("ConformingFaceRestriction::Mult");
    if (nf==0) { return; }
    // Assumes all elements have the same number of dofs
    const int nface_dofs = face_dofs;
@@ -727,6 +806,7 @@ static void ConformingFaceRestriction_AddMultTranspose(
 void ConformingFaceRestriction::AddMultTranspose(
    const Vector& x, Vector& y, const real_t a) const
 {
+   MFEM_PERF_SCOPE("ConformingFaceRestriction::MultTranspose");
    ConformingFaceRestriction_AddMultTranspose(
       ndofs, face_dofs, nf, vdim, byvdim, gather_offsets, gather_indices, x, y,
       true, a);
@@ -1030,6 +1110,7 @@ void L2FaceRestriction::DoubleValuedConformingMult(const Vector& x,
 
 void L2FaceRestriction::Mult(const Vector& x, Vector& y) const
 {
+   MFEM_PERF_SCOPE("L2FaceRestriction::Mult");
    if (nf==0) { return; }
    if (m==L2FaceValues::DoubleValued)
    {
@@ -1105,6 +1186,7 @@ void L2FaceRestriction::DoubleValuedConformingAddMultTranspose(
 void L2FaceRestriction::AddMultTranspose(const Vector& x, Vector& y,
                                          const real_t a) const
 {
+   MFEM_PERF_SCOPE("L2FaceRestriction::MultTranspose");
    MFEM_VERIFY(a == 1.0, "General coefficient case is not yet supported!");
    if (nf==0) { return; }
    if (m == L2FaceValues::DoubleValued)
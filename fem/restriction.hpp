@@ -50,10 +50,23 @@ protected:
    Array<int> offsets;
    Array<int> indices;
    Array<int> gather_map;
+   bool colored_scatter;
+
+   /// Host implementation of TAddMultTranspose() using the element coloring
+   /// of the space, see UseColoredScatter().
+   template <bool ADD>
+   void ColoredAddMultTranspose(const Vector &x, Vector &y) const;
 
 public:
    ElementRestriction(const FiniteElementSpace&, ElementDofOrdering);
    void Mult(const Vector &x, Vector &y) const override;
+
+   /** @brief Same as Mult(), restricted to the elements in the range
+       [@a e_begin, @a e_end). */
+   /** Only the entries of the E-vector @a y that belong to these elements are
+       set, the other entries are left unchanged. */
+   void MultRange(const Vector &x, Vector &y, int e_begin, int e_end) const;
+
    void MultTranspose(const Vector &x, Vector &y) const override;
    void AddMultTranspose(const Vector &x, Vector &y,
                          const real_t a = 1.0) const override;
@@ -76,6 +89,16 @@ public:
    /// contributions; this is a left inverse of the Mult() operation
    void MultLeftInverse(const Vector &x, Vector &y) const;
 
+   /** @brief Enable or disable the use of the element coloring of the space
+       (see FiniteElementSpace::GetElementColoring()) in MultTranspose() and
+       AddMultTranspose().
+
+       With the coloring, the element contributions are scatter-added on the
+       host, one color at a time, with the elements of each color processed
+       concurrently by OpenMP threads. This is disabled by default; it is
+       meant for the Backend::OMP backend, without a GPU backend. */
+   void UseColoredScatter(bool use = true) { colored_scatter = use; }
+
    /// @brief Fills the E-vector y with `boolean` values 0.0 and 1.0 such that each
    /// each entry of the L-vector is uniquely represented in `y`.
    /** This means, the sum of the E-vector `y` is equal to the sum of the
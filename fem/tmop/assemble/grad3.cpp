@@ -21,13 +21,17 @@ void TMOP_Integrator::AssembleGradPA_3D(const Vector &x) const
 
    // Calls TMOPAssembleGradPA3D::Mult for the given mid.
    TMOPAssembleGradPA3D ker(this, x);
+   if (mid == 301) { return tmop::Kernel<301>(ker); }
    if (mid == 302) { return tmop::Kernel<302>(ker); }
    if (mid == 303) { return tmop::Kernel<303>(ker); }
    if (mid == 315) { return tmop::Kernel<315>(ker); }
+   if (mid == 316) { return tmop::Kernel<316>(ker); }
    if (mid == 318) { return tmop::Kernel<318>(ker); }
    if (mid == 321) { return tmop::Kernel<321>(ker); }
+   if (mid == 328) { return tmop::Kernel<328>(ker); }
    if (mid == 332) { return tmop::Kernel<332>(ker); }
    if (mid == 338) { return tmop::Kernel<338>(ker); }
+   if (mid == 360) { return tmop::Kernel<360>(ker); }
 
    MFEM_ABORT("Unsupported TMOP metric " << mid);
 }
@@ -0,0 +1,91 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../pa.hpp"
+#include "../mult/mult3.hpp"
+#include "../tools/energy3.hpp"
+#include "../assemble/grad3.hpp"
+
+namespace mfem
+{
+
+struct TMOP_PA_Metric_316 : TMOP_PA_Metric_3D
+{
+   MFEM_HOST_DEVICE real_t EvalW(const real_t (&Jpt)[DIM * DIM],
+                                 const real_t *w) const final
+   {
+      real_t B[9];
+      MFEM_CONTRACT_VAR(w);
+      kernels::InvariantsEvaluator3D ie(Args().J(Jpt).B(B));
+      // mu_316 = 0.5 * (I3b + 1/I3b) - 1.
+      const real_t I3b = ie.Get_I3b();
+      return 0.5 * (I3b + 1.0 / I3b) - 1.0;
+   }
+
+   // P_316 = 0.5*(1 - 1/I3b^2)*dI3b = (0.5 - 0.5/I3)*dI3b
+   MFEM_HOST_DEVICE void EvalP(const real_t (&Jpt)[9],
+                               const real_t *w, real_t (&P)[9]) const final
+   {
+      MFEM_CONTRACT_VAR(w);
+      real_t dI3b[9];
+      kernels::InvariantsEvaluator3D ie(Args().J(Jpt).dI3b(dI3b));
+
+      real_t sign_detJ;
+      const real_t I3b = ie.Get_I3b(sign_detJ);
+      kernels::Set(3, 3, 0.5 - 0.5 / (I3b * I3b), ie.Get_dI3b(sign_detJ), P);
+   }
+
+   MFEM_HOST_DEVICE void AssembleH(const int qx, const int qy, const int qz,
+                                   const int e,
+                                   const real_t weight,
+                                   real_t *Jrt,
+                                   real_t *Jpr,
+                                   const real_t (&Jpt)[9],
+                                   const real_t *w,
+                                   const DeviceTensor<8> &H) const final
+   {
+      MFEM_CONTRACT_VAR(w);
+      real_t *dI3b = Jrt, *ddI3b = Jpr;
+      // dP_316 = (1/I3b^3)*(dI3b x dI3b) + (0.5 - 0.5/I3)*ddI3b
+      kernels::InvariantsEvaluator3D ie(Args().J(Jpt).dI3b(dI3b).ddI3b(ddI3b));
+      real_t sign_detJ;
+      const real_t I3b = ie.Get_I3b(sign_detJ);
+      const real_t I3 = I3b * I3b;
+      ConstDeviceMatrix di3b(ie.Get_dI3b(sign_detJ), DIM, DIM);
+      for (int i = 0; i < DIM; i++)
+      {
+         for (int j = 0; j < DIM; j++)
+         {
+            ConstDeviceMatrix ddi3b(ie.Get_ddI3b(i, j), DIM, DIM);
+            for (int r = 0; r < DIM; r++)
+            {
+               for (int c = 0; c < DIM; c++)
+               {
+                  const real_t dp =
+                     weight / (I3 * I3b) * di3b(r, c) * di3b(i, j) +
+                     weight * (0.5 - 0.5 / I3) * ddi3b(r, c);
+                  H(r, c, i, j, qx, qy, qz, e) = dp;
+               }
+            }
+         }
+      }
+   }
+};
+
+using metric = TMOP_PA_Metric_316;
+
+using assemble = TMOPAssembleGradPA3D;
+using energy = TMOPEnergyPA3D;
+using mult = TMOPAddMultPA3D;
+
+MFEM_TMOP_REGISTER_METRIC(metric, assemble, energy, mult, 316);
+
+} // namespace mfem
@@ -0,0 +1,99 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../pa.hpp"
+#include "../mult/mult3.hpp"
+#include "../tools/energy3.hpp"
+#include "../assemble/grad3.hpp"
+
+namespace mfem
+{
+
+struct TMOP_PA_Metric_360 : TMOP_PA_Metric_3D
+{
+   MFEM_HOST_DEVICE real_t EvalW(const real_t (&Jpt)[DIM * DIM],
+                                 const real_t *w) const final
+   {
+      real_t B[9];
+      MFEM_CONTRACT_VAR(w);
+      kernels::InvariantsEvaluator3D ie(Args().J(Jpt).B(B));
+      // mu_360 = (I1/3)^(3/2) - I3b.
+      return std::pow(ie.Get_I1() / 3.0, 1.5) - ie.Get_I3b();
+   }
+
+   // P_360 = 1/2 * (I1/3)^1/2 * dI1 - dI3b.
+   // Non-barrier metric: uses the signed det(J), as the full assembly version.
+   MFEM_HOST_DEVICE void EvalP(const real_t (&Jpt)[9],
+                               const real_t *w, real_t (&P)[9]) const final
+   {
+      MFEM_CONTRACT_VAR(w);
+      real_t B[9];
+      real_t dI1[9], dI3b[9];
+      kernels::InvariantsEvaluator3D ie(Args().J(Jpt).B(B).dI1(dI1).dI3b(dI3b));
+      const real_t alpha = 0.5 * std::sqrt(ie.Get_I1() / 3.0);
+      kernels::Add(3, 3, alpha, ie.Get_dI1(), -1.0, ie.Get_dI3b(1.0), P);
+   }
+
+   MFEM_HOST_DEVICE void AssembleH(const int qx, const int qy, const int qz,
+                                   const int e,
+                                   const real_t weight,
+                                   real_t *Jrt,
+                                   real_t *Jpr,
+                                   const real_t (&Jpt)[9],
+                                   const real_t *w,
+                                   const DeviceTensor<8> &H) const final
+   {
+      MFEM_CONTRACT_VAR(w);
+      real_t B[9];
+      real_t dI1[9], ddI1[9];
+      real_t *dI3b = Jrt, *ddI3b = Jpr;
+      // dP_360 = 1/12 * (I1/3)^(-1/2) * (dI1 x dI1) +
+      //          1/2 * (I1/3)^1/2 * ddI1 - ddI3b
+      kernels::InvariantsEvaluator3D ie(Args()
+                                        .J(Jpt)
+                                        .B(B)
+                                        .dI1(dI1)
+                                        .ddI1(ddI1)
+                                        .dI3b(dI3b)
+                                        .ddI3b(ddI3b));
+      const real_t s = std::sqrt(ie.Get_I1() / 3.0);
+      ConstDeviceMatrix di1(ie.Get_dI1(), DIM, DIM);
+      ie.Get_dI3b(1.0);
+      for (int i = 0; i < DIM; i++)
+      {
+         for (int j = 0; j < DIM; j++)
+         {
+            ConstDeviceMatrix ddi1(ie.Get_ddI1(i, j), DIM, DIM);
+            ConstDeviceMatrix ddi3b(ie.Get_ddI3b(i, j), DIM, DIM);
+            for (int r = 0; r < DIM; r++)
+            {
+               for (int c = 0; c < DIM; c++)
+               {
+                  const real_t dp =
+                     weight / (12.0 * s) * di1(r, c) * di1(i, j) +
+                     weight * 0.5 * s * ddi1(r, c) - weight * ddi3b(r, c);
+                  H(r, c, i, j, qx, qy, qz, e) = dp;
+               }
+            }
+         }
+      }
+   }
+};
+
+using metric = TMOP_PA_Metric_360;
+
+using assemble = TMOPAssembleGradPA3D;
+using energy = TMOPEnergyPA3D;
+using mult = TMOPAddMultPA3D;
+
+MFEM_TMOP_REGISTER_METRIC(metric, assemble, energy, mult, 360);
+
+} // namespace mfem
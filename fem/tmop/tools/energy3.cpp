@@ -27,13 +27,17 @@ void TMOP_Integrator::GetLocalStateEnergyPA_3D(const Vector &X,
 
    // Calls TMOPEnergyPA3D::Mult for the given mid.
    TMOPEnergyPA3D ker(this, X, L, use_detA);
-   if (mid == 302) { tmop::Kernel<302>(ker); }
+   if (mid == 301) { tmop::Kernel<301>(ker); }
+   else if (mid == 302) { tmop::Kernel<302>(ker); }
    else if (mid == 303) { tmop::Kernel<303>(ker); }
    else if (mid == 315) { tmop::Kernel<315>(ker); }
+   else if (mid == 316) { tmop::Kernel<316>(ker); }
    else if (mid == 318) { tmop::Kernel<318>(ker); }
    else if (mid == 321) { tmop::Kernel<321>(ker); }
+   else if (mid == 328) { tmop::Kernel<328>(ker); }
    else if (mid == 332) { tmop::Kernel<332>(ker); }
    else if (mid == 338) { tmop::Kernel<338>(ker); }
+   else if (mid == 360) { tmop::Kernel<360>(ker); }
    else { MFEM_ABORT("Unsupported TMOP metric " << mid); }
 
    real_t lim_energy;
@@ -56,13 +60,17 @@ void TMOP_Integrator::GetLocalNormalizationEnergiesPA_3D(const Vector &X,
 
    // Calls TMOPEnergyPA3D::Mult for the given mid.
    TMOPEnergyPA3D ker(this, X, L, mn, mc, use_detA);
-   if (mid == 302) { tmop::Kernel<302>(ker); }
+   if (mid == 301) { tmop::Kernel<301>(ker); }
+   else if (mid == 302) { tmop::Kernel<302>(ker); }
    else if (mid == 303) { tmop::Kernel<303>(ker); }
    else if (mid == 315) { tmop::Kernel<315>(ker); }
+   else if (mid == 316) { tmop::Kernel<316>(ker); }
    else if (mid == 318) { tmop::Kernel<318>(ker); }
    else if (mid == 321) { tmop::Kernel<321>(ker); }
+   else if (mid == 328) { tmop::Kernel<328>(ker); }
    else if (mid == 332) { tmop::Kernel<332>(ker); }
    else if (mid == 338) { tmop::Kernel<338>(ker); }
+   else if (mid == 360) { tmop::Kernel<360>(ker); }
    else { MFEM_ABORT("Unsupported TMOP metric " << mid); }
 
    ker.GetEnergy(met_energy, lim_energy);
@@ -108,13 +116,17 @@ void TMOP_Combo_QualityMetric::GetLocalEnergyPA_3D(const GridFunction &nodes,
 
    // Calls TMOPEnergyPA3D::Mult for the given mid.
    TMOPEnergyPA3D ker(X, E, L, O, true, d, q, mn, N, metric, B, G, Jtr, ir, MC);
-   if (mid == 302) { tmop::Kernel<302>(ker); }
+   if (mid == 301) { tmop::Kernel<301>(ker); }
+   else if (mid == 302) { tmop::Kernel<302>(ker); }
    else if (mid == 303) { tmop::Kernel<303>(ker); }
    else if (mid == 315) { tmop::Kernel<315>(ker); }
+   else if (mid == 316) { tmop::Kernel<316>(ker); }
    else if (mid == 318) { tmop::Kernel<318>(ker); }
    else if (mid == 321) { tmop::Kernel<321>(ker); }
+   else if (mid == 328) { tmop::Kernel<328>(ker); }
    else if (mid == 332) { tmop::Kernel<332>(ker); }
    else if (mid == 338) { tmop::Kernel<338>(ker); }
+   else if (mid == 360) { tmop::Kernel<360>(ker); }
    else { MFEM_ABORT("Unsupported TMOP metric " << mid); }
 
    ker.GetEnergy(energy, vol);
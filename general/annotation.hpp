@@ -25,10 +25,19 @@
 
 #else
 
-#define MFEM_PERF_FUNCTION
-#define MFEM_PERF_BEGIN(s)
-#define MFEM_PERF_END(s)
-#define MFEM_PERF_SCOPE(name)
+// Without Caliper, the annotated regions are timed with the built-in, and by
+// default disabled, RegionTimer.
+#include "region_timer.hpp"
+#define MFEM_PERF_CONCAT_(a, b) a##b
+#define MFEM_PERF_CONCAT(a, b) MFEM_PERF_CONCAT_(a, b)
+#define MFEM_PERF_FUNCTION \
+   mfem::RegionTimerScope MFEM_PERF_CONCAT(mfem_perf_scope_, __LINE__)(__func__)
+#define MFEM_PERF_BEGIN(s) \
+   (mfem::RegionTimer::IsEnabled() ? mfem::RegionTimer::Begin(s) : void())
+#define MFEM_PERF_END(s) \
+   (mfem::RegionTimer::IsEnabled() ? mfem::RegionTimer::End(s) : void())
+#define MFEM_PERF_SCOPE(name) \
+   mfem::RegionTimerScope MFEM_PERF_CONCAT(mfem_perf_scope_, __LINE__)(name)
 
 #endif // MFEM_USE_CALIPER
 
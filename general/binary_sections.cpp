@@ -0,0 +1,240 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "binary_sections.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace mfem
+{
+
+using namespace binary_sections;
+
+namespace
+{
+
+constexpr std::uint32_t endian_mark = 0x01020304;
+
+std::size_t Align(std::size_t offset)
+{
+   return (offset + alignment - 1)/alignment*alignment;
+}
+
+// Layout of the header, after the type line, and of the section entries
+struct Header
+{
+   std::uint32_t endian, version;
+   std::uint64_t num_sections;
+   char padding[header_size - type_line_size - 16];
+};
+static_assert(sizeof(Header) == header_size - type_line_size, "");
+
+struct Entry
+{
+   char name[max_name_size + 1];
+   char type;
+   char padding[7];
+   std::uint64_t count, offset;
+};
+static_assert(sizeof(Entry) == header_size, "");
+
+} // anonymous namespace
+
+void BinarySectionWriter::AddSection(const std::string &name, char type,
+                                     std::size_t elem_size, const void *data,
+                                     std::size_t count, bool copy)
+{
+   MFEM_VERIFY(name.size() <= std::size_t(max_name_size),
+               "section name too long: " << name);
+   sections.push_back({name, type, count, elem_size, data, {}});
+   if (copy)
+   {
+      const char *bytes = static_cast<const char*>(data);
+      sections.back().own.assign(bytes, bytes + count*elem_size);
+   }
+}
+
+void BinarySectionWriter::AddString(const std::string &name,
+                                    const std::string &str)
+{
+   AddSection(name, TypeCode<char>::value, 1, str.data(), str.size(), true);
+}
+
+void BinarySectionWriter::Write(std::ostream &os, const std::string &type) const
+{
+   MFEM_VERIFY(type.size() < std::size_t(type_line_size) &&
+               type.find('\n') == std::string::npos, "invalid type: " << type);
+   std::vector<char> line(type_line_size, '\0');
+   std::memcpy(line.data(), type.data(), type.size());
+   line[type.size()] = '\n';
+   os.write(line.data(), type_line_size);
+
+   Header header = {};
+   header.endian = endian_mark;
+   header.version = version;
+   header.num_sections = sections.size();
+   os.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+
+   std::size_t offset = Align(header_size*(1 + sections.size()));
+   std::vector<std::size_t> offsets;
+   for (const Section &s : sections)
+   {
+      Entry entry = {};
+      std::memcpy(entry.name, s.name.data(), s.name.size());
+      entry.type = s.type;
+      entry.count = s.count;
+      entry.offset = offset;
+      os.write(reinterpret_cast<const char*>(&entry), sizeof(Entry));
+      offsets.push_back(offset);
+      offset = Align(offset + s.count*s.elem_size);
+   }
+
+   std::size_t pos = header_size*(1 + sections.size());
+   const std::vector<char> zeros(alignment, '\0');
+   for (std::size_t i = 0; i < sections.size(); i++)
+   {
+      const Section &s = sections[i];
+      os.write(zeros.data(), offsets[i] - pos);
+      const void *data = s.own.empty() ? s.data : s.own.data();
+      os.write(static_cast<const char*>(data), s.count*s.elem_size);
+      pos = offsets[i] + s.count*s.elem_size;
+   }
+   MFEM_VERIFY(os.good(), "error writing the binary file");
+}
+
+BinarySectionReader::BinarySectionReader(const std::string &filename)
+{
+#ifndef _WIN32
+   const int fd = open(filename.c_str(), O_RDONLY);
+   MFEM_VERIFY(fd >= 0, "cannot open file " << filename);
+   struct stat st;
+   if (fstat(fd, &st) == 0 && st.st_size > 0)
+   {
+      size = std::size_t(st.st_size);
+      void *ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                       fd, 0);
+      if (ptr != MAP_FAILED)
+      {
+         data = static_cast<char*>(ptr);
+         mapped = true;
+      }
+   }
+   close(fd);
+#endif
+   if (!mapped)
+   {
+      std::ifstream input(filename, std::ios::binary);
+      MFEM_VERIFY(input, "cannot open file " << filename);
+      buffer.assign(std::istreambuf_iterator<char>(input),
+                    std::istreambuf_iterator<char>());
+      data = buffer.data();
+      size = buffer.size();
+   }
+   Parse();
+}
+
+BinarySectionReader::BinarySectionReader(std::istream &input,
+                                         const std::string &type_line)
+{
+   buffer.assign(type_line.begin(), type_line.end());
+   buffer.push_back('\n');
+   buffer.insert(buffer.end(), std::istreambuf_iterator<char>(input),
+                 std::istreambuf_iterator<char>());
+   data = buffer.data();
+   size = buffer.size();
+   Parse();
+}
+
+BinarySectionReader::~BinarySectionReader()
+{
+#ifndef _WIN32
+   if (mapped) { munmap(data, size); }
+#endif
+}
+
+void BinarySectionReader::Parse()
+{
+   MFEM_VERIFY(size >= std::size_t(header_size), "invalid binary file");
+   const char *eol =
+      static_cast<const char*>(std::memchr(data, '\n', type_line_size));
+   MFEM_VERIFY(eol, "invalid binary file: type line not found");
+   type.assign(data, std::size_t(eol - data));
+
+   Header header;
+   std::memcpy(&header, data + type_line_size, sizeof(Header));
+   MFEM_VERIFY(header.endian == endian_mark,
+               "binary file written with a different byte order");
+   MFEM_VERIFY(header.version == version,
+               "unsupported binary file version " << header.version);
+   MFEM_VERIFY(size >= header_size*(1 + header.num_sections),
+               "invalid binary file: truncated table of sections");
+
+   for (std::uint64_t i = 0; i < header.num_sections; i++)
+   {
+      Entry entry;
+      std::memcpy(&entry, data + header_size*(1 + i), sizeof(Entry));
+      entry.name[max_name_size] = '\0';
+      names.push_back(entry.name);
+      sections.push_back({entry.type, std::size_t(entry.count),
+                          std::size_t(entry.offset)});
+   }
+}
+
+const BinarySectionReader::Section &BinarySectionReader::Find(
+   const std::string &name, char type_code, std::size_t elem_size) const
+{
+   for (std::size_t i = 0; i < names.size(); i++)
+   {
+      if (names[i] != name) { continue; }
+      const Section &s = sections[i];
+      MFEM_VERIFY(s.type == type_code, "section '" << name << "' has type '"
+                  << s.type << "', expected '" << type_code << "'");
+      MFEM_VERIFY(s.offset + s.count*elem_size <= size,
+                  "invalid binary file: section '" << name << "' truncated");
+      return s;
+   }
+   MFEM_ABORT("section '" << name << "' not found in the binary file");
+   return sections[0];
+}
+
+bool BinarySectionReader::Has(const std::string &name) const
+{
+   for (const std::string &n : names) { if (n == name) { return true; } }
+   return false;
+}
+
+std::size_t BinarySectionReader::GetCount(const std::string &name) const
+{
+   for (std::size_t i = 0; i < names.size(); i++)
+   {
+      if (names[i] == name) { return sections[i].count; }
+   }
+   MFEM_ABORT("section '" << name << "' not found in the binary file");
+   return 0;
+}
+
+std::string BinarySectionReader::GetString(const std::string &name) const
+{
+   std::size_t count;
+   const char *str = GetData<char>(name, count);
+   return std::string(str, count);
+}
+
+} // namespace mfem
@@ -0,0 +1,206 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_BINARY_SECTIONS_HPP
+#define MFEM_BINARY_SECTIONS_HPP
+
+#include "../config/config.hpp"
+#include "array.hpp"
+#include "error.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+/** @brief Container format of the MFEM binary files: a header followed by
+    named, typed and 64-byte aligned arrays ("sections").
+
+    The file starts with a type line, e.g. "MFEM binary mesh v1.0", so that the
+    text loaders (e.g. Mesh::Loader()) can recognize it, followed by a
+    fixed-size header (endianness mark, container version, number of sections),
+    the table of sections (name, type, count, offset) and the section data.
+    The data is stored in the native byte order and a file written on a machine
+    with a different byte order is rejected. Since the sections are aligned,
+    they can be used in place when the file is memory mapped, see
+    BinarySectionReader. */
+namespace binary_sections
+{
+/// Version of the container format.
+constexpr std::uint32_t version = 1;
+/// Maximal length of the type line, including the terminating newline.
+constexpr int type_line_size = 48;
+/// Size of the header and of each entry of the table of sections.
+constexpr int header_size = 64;
+/// Alignment of the section data.
+constexpr int alignment = 64;
+/// Maximal length of a section name.
+constexpr int max_name_size = 39;
+
+/// Type codes of the section data.
+template <typename T> struct TypeCode;
+template <> struct TypeCode<char> { static constexpr char value = 'c'; };
+template <> struct TypeCode<int> { static constexpr char value = 'i'; };
+template <> struct TypeCode<long long> { static constexpr char value = 'I'; };
+template <> struct TypeCode<float> { static constexpr char value = 'f'; };
+template <> struct TypeCode<double> { static constexpr char value = 'd'; };
+}
+
+/** @brief Write a binary file made of named sections.
+
+    The sections added with Add() are not copied: their data must remain valid
+    until Write() is called. */
+class BinarySectionWriter
+{
+   struct Section
+   {
+      std::string name;
+      char type;
+      std::size_t count, elem_size;
+      const void *data;
+      std::vector<char> own; // used by the sections with copied data
+   };
+   std::vector<Section> sections;
+
+   void AddSection(const std::string &name, char type, std::size_t elem_size,
+                   const void *data, std::size_t count, bool copy);
+
+public:
+   /// Add the section @a name with the @a count values in @a data.
+   template <typename T>
+   void Add(const std::string &name, const T *data, std::size_t count)
+   {
+      AddSection(name, binary_sections::TypeCode<T>::value, sizeof(T), data,
+                 count, false);
+   }
+
+   /// Add the section @a name with the entries of @a a.
+   template <typename T>
+   void Add(const std::string &name, const Array<T> &a)
+   { Add(name, a.GetData(), std::size_t(a.Size())); }
+
+   /// Add the section @a name with a copy of the @a count values in @a data.
+   template <typename T>
+   void AddCopy(const std::string &name, const T *data, std::size_t count)
+   {
+      AddSection(name, binary_sections::TypeCode<T>::value, sizeof(T), data,
+                 count, true);
+   }
+
+   /// Add the section @a name with a copy of the single value @a value.
+   template <typename T>
+   void AddValue(const std::string &name, const T &value)
+   {
+      AddSection(name, binary_sections::TypeCode<T>::value, sizeof(T), &value,
+                 1, true);
+   }
+
+   /// Add the section @a name with a copy of the string @a str.
+   void AddString(const std::string &name, const std::string &str);
+
+   /// Write the file with the given @a type line, e.g. "MFEM binary mesh v1.0".
+   void Write(std::ostream &os, const std::string &type) const;
+};
+
+/** @brief Read a binary file written by BinarySectionWriter.
+
+    When constructed from a file name, the file is memory mapped (with a
+    private, copy-on-write mapping) where supported, and the sections are
+    accessed in place: GetData() returns pointers into the mapping, that remain
+    valid as long as the reader exists. Otherwise, or when constructed from a
+    stream, the file is read into memory. */
+class BinarySectionReader
+{
+   struct Section
+   {
+      char type;
+      std::size_t count, offset;
+   };
+   std::string type;
+   std::vector<std::string> names;
+   std::vector<Section> sections;
+
+   char *data = nullptr;
+   std::size_t size = 0;
+   bool mapped = false;
+   std::vector<char> buffer;
+
+   void Parse();
+   const Section &Find(const std::string &name, char type_code,
+                       std::size_t elem_size) const;
+
+public:
+   /// Map (or read) the file @a filename.
+   explicit BinarySectionReader(const std::string &filename);
+
+   /** @brief Read the file from @a input, where the type line @a type_line has
+       already been extracted (without its newline), e.g. by Mesh::Loader(). */
+   BinarySectionReader(std::istream &input, const std::string &type_line);
+
+   BinarySectionReader(const BinarySectionReader &) = delete;
+   BinarySectionReader &operator=(const BinarySectionReader &) = delete;
+
+   ~BinarySectionReader();
+
+   /// Return the type line of the file, e.g. "MFEM binary mesh v1.0".
+   const std::string &GetType() const { return type; }
+
+   /// Return true if the file is memory mapped.
+   bool IsMapped() const { return mapped; }
+
+   /// Return true if the file has the section @a name.
+   bool Has(const std::string &name) const;
+
+   /// Return the number of values in the section @a name.
+   std::size_t GetCount(const std::string &name) const;
+
+   /** @brief Return a pointer to the values of the section @a name, checking
+       that their type is T. The values can be modified, this does not change
+       the file. */
+   template <typename T>
+   T *GetData(const std::string &name, std::size_t &count) const
+   {
+      const Section &s = Find(name, binary_sections::TypeCode<T>::value,
+                              sizeof(T));
+      count = s.count;
+      return reinterpret_cast<T*>(data + s.offset);
+   }
+
+   /// Return the single value of the section @a name.
+   template <typename T>
+   T GetValue(const std::string &name) const
+   {
+      std::size_t count;
+      const T *value = GetData<T>(name, count);
+      MFEM_VERIFY(count == 1, "section '" << name << "' is not a value");
+      return *value;
+   }
+
+   /// Return the string stored in the section @a name.
+   std::string GetString(const std::string &name) const;
+
+   /** @brief Make @a a a reference to the values of the section @a name,
+       without copying them. */
+   template <typename T>
+   void MakeRef(const std::string &name, Array<T> &a) const
+   {
+      std::size_t count;
+      T *values = GetData<T>(name, count);
+      a.MakeRef(values, int(count));
+   }
+};
+
+} // namespace mfem
+
+#endif // MFEM_BINARY_SECTIONS_HPP
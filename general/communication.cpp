@@ -25,6 +25,7 @@
 #include "text.hpp"
 #include "sort_pairs.hpp"
 #include "globals.hpp"
+#include "annotation.hpp"
 
 #ifdef MFEM_USE_STRUMPACK
 #include <StrumpackConfig.hpp> // STRUMPACK_USE_PTSCOTCH, etc.
@@ -375,6 +376,8 @@ GroupCommunicator::GroupCommunicator(const GroupTopology &gt, Mode m)
    num_requests = 0;
    request_marker = NULL;
    buf_offsets = NULL;
+   active_exchange = NULL;
+   nbr_comm = MPI_COMM_NULL;
 }
 
 void GroupCommunicator::Create(const Array<int> &ldof_group)
@@ -510,6 +513,177 @@ void GroupCommunicator::Finalize()
          }
       }
    }
+
+   if (mode == byNeighborCollective) { CreateNbrComm(); }
+}
+
+void GroupCommunicator::SetMode(Mode m)
+{
+   MFEM_VERIFY(comm_lock == 0, "object is in use");
+   if (m == mode) { return; }
+   DeleteNbrExchanges();
+   mode = m;
+   // The neighbor tables are built by Finalize()
+   if (mode == byNeighborCollective && nbr_send_groups.Size() > 0)
+   {
+      CreateNbrComm();
+   }
+}
+
+void GroupCommunicator::CreateNbrComm()
+{
+   if (nbr_comm != MPI_COMM_NULL) { return; }
+#if MPI_VERSION >= 3
+   // The neighbor relation is symmetric, so the same list of ranks is used
+   // for the sources and the destinations, in the order of the neighbors.
+   const int num_nbrs = gtopo.GetNumNeighbors() - 1;
+   Array<int> nbr_ranks(num_nbrs);
+   for (int nbr = 1; nbr <= num_nbrs; nbr++)
+   {
+      nbr_ranks[nbr-1] = gtopo.GetNeighborRank(nbr);
+   }
+   MPI_Dist_graph_create_adjacent(gtopo.GetComm(),
+                                  num_nbrs, nbr_ranks.GetData(),
+                                  MPI_UNWEIGHTED,
+                                  num_nbrs, nbr_ranks.GetData(),
+                                  MPI_UNWEIGHTED,
+                                  MPI_INFO_NULL, 0, &nbr_comm);
+#else
+   MFEM_ABORT("mode byNeighborCollective requires MPI 3");
+#endif
+}
+
+GroupCommunicator::NbrExchange &
+GroupCommunicator::GetNbrExchange(int op, MPI_Datatype type,
+                                  int type_size) const
+{
+   for (int i = 0; i < nbr_exchanges.Size(); i++)
+   {
+      NbrExchange &ex = *nbr_exchanges[i];
+      if (ex.op == op && ex.type == type) { return ex; }
+   }
+
+   NbrExchange *ex = new NbrExchange;
+   ex->op = op;
+   ex->type = type;
+
+   // Same layout of the buffer as in mode byNeighbor: for each neighbor, the
+   // data sent to it followed by the data received from it. In the Reduce
+   // operation, the send and receive groups are swapped.
+   const Table &send_groups = (op == 1) ? nbr_send_groups : nbr_recv_groups;
+   const Table &recv_groups = (op == 1) ? nbr_recv_groups : nbr_send_groups;
+   const int num_nbrs = nbr_send_groups.Size() - 1;
+   ex->send_counts.SetSize(num_nbrs);
+   ex->send_displs.SetSize(num_nbrs);
+   ex->recv_counts.SetSize(num_nbrs);
+   ex->recv_displs.SetSize(num_nbrs);
+   int offset = 0, num_requests = 0;
+   for (int nbr = 1; nbr <= num_nbrs; nbr++)
+   {
+      int send_size = 0, recv_size = 0;
+      for (int i = 0; i < send_groups.RowSize(nbr); i++)
+      {
+         send_size += group_ldof.RowSize(send_groups.GetRow(nbr)[i]);
+      }
+      for (int i = 0; i < recv_groups.RowSize(nbr); i++)
+      {
+         recv_size += group_ldof.RowSize(recv_groups.GetRow(nbr)[i]);
+      }
+      ex->send_counts[nbr-1] = send_size;
+      ex->send_displs[nbr-1] = offset;
+      offset += send_size;
+      ex->recv_counts[nbr-1] = recv_size;
+      ex->recv_displs[nbr-1] = offset;
+      offset += recv_size;
+      num_requests += (send_size > 0) + (recv_size > 0);
+   }
+   MFEM_ASSERT(offset == group_buf_size, "");
+   ex->buf.SetSize(group_buf_size*type_size);
+
+   if (mode == byNeighborPersistent)
+   {
+      const int tag = (op == 1) ? 40822 : 43822;
+      char *buf = ex->buf.GetData();
+      ex->requests.SetSize(num_requests);
+      int request_counter = 0;
+      for (int nbr = 1; nbr <= num_nbrs; nbr++)
+      {
+         if (ex->send_counts[nbr-1] > 0)
+         {
+            MPI_Send_init(buf + type_size*ex->send_displs[nbr-1],
+                          ex->send_counts[nbr-1],
+                          type,
+                          gtopo.GetNeighborRank(nbr),
+                          tag,
+                          gtopo.GetComm(),
+                          &ex->requests[request_counter++]);
+         }
+         if (ex->recv_counts[nbr-1] > 0)
+         {
+            MPI_Recv_init(buf + type_size*ex->recv_displs[nbr-1],
+                          ex->recv_counts[nbr-1],
+                          type,
+                          gtopo.GetNeighborRank(nbr),
+                          tag,
+                          gtopo.GetComm(),
+                          &ex->requests[request_counter++]);
+         }
+      }
+   }
+   else
+   {
+      ex->requests.SetSize(1);
+      ex->requests[0] = MPI_REQUEST_NULL;
+   }
+
+   nbr_exchanges.Append(ex);
+   return *ex;
+}
+
+void GroupCommunicator::StartNbrExchange(NbrExchange &ex) const
+{
+   if (mode == byNeighborPersistent)
+   {
+      if (ex.requests.Size() > 0)
+      {
+         MPI_Startall(ex.requests.Size(), ex.requests.GetData());
+      }
+      return;
+   }
+#if MPI_VERSION >= 3
+   char *buf = ex.buf.GetData();
+   MPI_Ineighbor_alltoallv(buf, ex.send_counts.GetData(),
+                           ex.send_displs.GetData(), ex.type,
+                           buf, ex.recv_counts.GetData(),
+                           ex.recv_displs.GetData(), ex.type,
+                           nbr_comm, &ex.requests[0]);
+#else
+   MFEM_ABORT("mode byNeighborCollective requires MPI 3");
+#endif
+}
+
+void GroupCommunicator::DeleteNbrExchanges()
+{
+   int mpi_finalized;
+   MPI_Finalized(&mpi_finalized);
+   for (int i = 0; i < nbr_exchanges.Size(); i++)
+   {
+      NbrExchange *ex = nbr_exchanges[i];
+      for (int j = 0; j < ex->requests.Size() && !mpi_finalized; j++)
+      {
+         if (ex->requests[j] != MPI_REQUEST_NULL)
+         {
+            MPI_Request_free(&ex->requests[j]);
+         }
+      }
+      delete ex;
+   }
+   nbr_exchanges.SetSize(0);
+   if (nbr_comm != MPI_COMM_NULL && !mpi_finalized)
+   {
+      MPI_Comm_free(&nbr_comm);
+   }
+   nbr_comm = MPI_COMM_NULL;
 }
 
 void GroupCommunicator::SetLTDofTable(const Array<int> &ldof_ltdof)
@@ -723,9 +897,11 @@ const T *GroupCommunicator::ReduceGroupFromBuffer(const T *buf, T *ldata,
 template <class T>
 void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::BcastBegin");
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // The neighbor collective has to be called on all ranks
+   if (group_buf_size == 0 && mode != byNeighborCollective) { return; }
 
    int request_counter = 0;
    switch (mode)
@@ -851,6 +1027,27 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
          break;
       }
+
+      case byNeighborPersistent:
+      case byNeighborCollective:
+      {
+         NbrExchange &ex = GetNbrExchange(1, MPITypeMap<T>::mpi_type,
+                                          sizeof(T));
+         T *buf = (T *)ex.buf.GetData();
+         for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+         {
+            const int num_send_groups = nbr_send_groups.RowSize(nbr);
+            const int *grp_list = nbr_send_groups.GetRow(nbr);
+            T *nbr_buf = buf + ex.send_displs[nbr-1];
+            for (int i = 0; i < num_send_groups; i++)
+            {
+               nbr_buf = CopyGroupToBuffer(ldata, nbr_buf, grp_list[i], layout);
+            }
+         }
+         StartNbrExchange(ex);
+         active_exchange = &ex;
+         break;
+      }
    }
 
    comm_lock = 1; // 1 - locked for Bcast
@@ -860,6 +1057,7 @@ void GroupCommunicator::BcastBegin(T *ldata, int layout) const
 template <class T>
 void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::BcastEnd");
    if (comm_lock == 0) { return; }
    // The above also handles the case (group_buf_size == 0).
    MFEM_VERIFY(comm_lock == 1, "object is NOT locked for Bcast");
@@ -913,6 +1111,26 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
          }
          break;
       }
+
+      case byNeighborPersistent:
+      case byNeighborCollective:
+      {
+         NbrExchange &ex = *active_exchange;
+         MPI_Waitall(ex.requests.Size(), ex.requests.GetData(),
+                     MPI_STATUSES_IGNORE);
+         for (int nbr = 1; nbr < nbr_recv_groups.Size(); nbr++)
+         {
+            const int num_recv_groups = nbr_recv_groups.RowSize(nbr);
+            const int *grp_list = nbr_recv_groups.GetRow(nbr);
+            const T *buf = (T *)ex.buf.GetData() + ex.recv_displs[nbr-1];
+            for (int i = 0; i < num_recv_groups; i++)
+            {
+               buf = CopyGroupFromBuffer(buf, ldata, grp_list[i], layout);
+            }
+         }
+         active_exchange = NULL;
+         break;
+      }
    }
 
    comm_lock = 0; // 0 - no lock
@@ -922,13 +1140,19 @@ void GroupCommunicator::BcastEnd(T *ldata, int layout) const
 template <class T>
 void GroupCommunicator::ReduceBegin(const T *ldata) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::ReduceBegin");
    MFEM_VERIFY(comm_lock == 0, "object is already in use");
 
-   if (group_buf_size == 0) { return; }
+   // The neighbor collective has to be called on all ranks
+   if (group_buf_size == 0 && mode != byNeighborCollective) { return; }
 
    int request_counter = 0;
-   group_buf.SetSize(group_buf_size*sizeof(T));
-   T *buf = (T *)group_buf.GetData();
+   T *buf = NULL;
+   if (mode == byGroup || mode == byNeighbor)
+   {
+      group_buf.SetSize(group_buf_size*sizeof(T));
+      buf = (T *)group_buf.GetData();
+   }
    switch (mode)
    {
       case byGroup: // ***** Communication by groups *****
@@ -1032,6 +1256,29 @@ void GroupCommunicator::ReduceBegin(const T *ldata) const
          MFEM_ASSERT(buf - (T*)group_buf.GetData() == group_buf_size, "");
          break;
       }
+
+      case byNeighborPersistent:
+      case byNeighborCollective:
+      {
+         NbrExchange &ex = GetNbrExchange(2, MPITypeMap<T>::mpi_type,
+                                          sizeof(T));
+         buf = (T *)ex.buf.GetData();
+         for (int nbr = 1; nbr < nbr_recv_groups.Size(); nbr++)
+         {
+            // In Reduce operation: send_groups <--> recv_groups
+            const int num_send_groups = nbr_recv_groups.RowSize(nbr);
+            const int *grp_list = nbr_recv_groups.GetRow(nbr);
+            T *nbr_buf = buf + ex.send_displs[nbr-1];
+            for (int i = 0; i < num_send_groups; i++)
+            {
+               const int layout = 0; // ldata is an array on all ldofs
+               nbr_buf = CopyGroupToBuffer(ldata, nbr_buf, grp_list[i], layout);
+            }
+         }
+         StartNbrExchange(ex);
+         active_exchange = &ex;
+         break;
+      }
    }
 
    comm_lock = 2;
@@ -1042,6 +1289,7 @@ template <class T>
 void GroupCommunicator::ReduceEnd(T *ldata, int layout,
                                   void (*Op)(OpData<T>)) const
 {
+   MFEM_PERF_SCOPE("GroupCommunicator::ReduceEnd");
    if (comm_lock == 0) { return; }
    // The above also handles the case (group_buf_size == 0).
    MFEM_VERIFY(comm_lock == 2, "object is NOT locked for Reduce");
@@ -1102,6 +1350,28 @@ void GroupCommunicator::ReduceEnd(T *ldata, int layout,
          }
          break;
       }
+
+      case byNeighborPersistent:
+      case byNeighborCollective:
+      {
+         NbrExchange &ex = *active_exchange;
+         MPI_Waitall(ex.requests.Size(), ex.requests.GetData(),
+                     MPI_STATUSES_IGNORE);
+         for (int nbr = 1; nbr < nbr_send_groups.Size(); nbr++)
+         {
+            // In Reduce operation: send_groups <--> recv_groups
+            const int num_recv_groups = nbr_send_groups.RowSize(nbr);
+            const int *grp_list = nbr_send_groups.GetRow(nbr);
+            const T *buf = (T *)ex.buf.GetData() + ex.recv_displs[nbr-1];
+            for (int i = 0; i < num_recv_groups; i++)
+            {
+               buf = ReduceGroupFromBuffer(buf, ldata, grp_list[i],
+                                           layout, Op);
+            }
+         }
+         active_exchange = NULL;
+         break;
+      }
    }
 
    comm_lock = 0; // 0 - no lock
@@ -1218,6 +1488,8 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
          break;
 
       case byNeighbor:
+      case byNeighborPersistent:
+      case byNeighborCollective:
          for (int gr = 1; gr < group_ldof.Size(); gr++)
          {
             const int nldofs = group_ldof.RowSize(gr);
@@ -1270,9 +1542,12 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
    {
       os << "\nGroupCommunicator:\n";
    }
+   const char *mode_names[] =
+   {
+      "byGroup", "byNeighbor", "byNeighborPersistent", "byNeighborCollective"
+   };
    os << "Rank " << myid << ":\n"
-      "   mode             = " <<
-      (mode == byGroup ? "byGroup" : "byNeighbor") << "\n"
+      "   mode             = " << mode_names[mode] << "\n"
       "   number of sends  = " << num_sends <<
       " (" << mem_sends << " bytes)\n"
       "   number of recvs  = " << num_recvs <<
@@ -1282,7 +1557,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
       num_master_groups << " + " <<
       group_ldof.Size()-num_master_groups-num_empty_groups << " + " <<
       num_empty_groups << " (master + slave + empty)\n";
-   if (mode == byNeighbor)
+   if (mode != byGroup)
    {
       os <<
          "   num neighbors    = " << nbr_send_groups.Size() << " = " <<
@@ -1304,6 +1579,7 @@ void GroupCommunicator::PrintInfo(std::ostream &os) const
 
 GroupCommunicator::~GroupCommunicator()
 {
+   DeleteNbrExchanges();
    delete [] buf_offsets;
    delete [] request_marker;
    // delete [] statuses;
@@ -236,8 +236,22 @@ public:
    enum Mode
    {
       byGroup,    ///< Communications are performed one group at a time.
-      byNeighbor  /**< Communications are performed one neighbor at a time,
+      byNeighbor, /**< Communications are performed one neighbor at a time,
                        aggregating over groups. */
+      byNeighborPersistent, /**< Same messages as byNeighbor, using persistent
+                                 requests that are created at the first
+                                 operation of each type and data type. */
+      byNeighborCollective  /**< Same messages as byNeighbor, exchanged with
+                                 MPI_Ineighbor_alltoallv() on a distributed
+                                 graph communicator of the neighbors. Every
+                                 Bcast and Reduce is then collective on that
+                                 communicator: BcastBegin() and ReduceBegin()
+                                 enter the neighbor collective even when the
+                                 local rank has no data to exchange
+                                 (group_buf_size == 0), so all ranks must call
+                                 every operation, in the same order; an
+                                 exchange performed only on some ranks
+                                 deadlocks. */
    };
 
 protected:
@@ -256,6 +270,30 @@ protected:
    int *buf_offsets; // size = max(number of groups, number of neighbors)
    Table nbr_send_groups, nbr_recv_groups; // nbr 0 = me
 
+   /** @brief Buffer and requests of one operation (Bcast or Reduce) for one
+       data type, used by the modes byNeighborPersistent and
+       byNeighborCollective. */
+   struct NbrExchange
+   {
+      int op; // 1 - Bcast, 2 - Reduce, as comm_lock
+      MPI_Datatype type;
+      Array<char> buf; // never reallocated, the requests point to it
+      // Counts and offsets in buf, in units of type, for the nbrs 1, 2, ...
+      Array<int> send_counts, send_displs, recv_counts, recv_displs;
+      // Persistent requests, or the request of the neighbor collective
+      Array<MPI_Request> requests;
+   };
+   mutable Array<NbrExchange*> nbr_exchanges;
+   mutable NbrExchange *active_exchange;
+   MPI_Comm nbr_comm; // graph communicator for mode byNeighborCollective
+
+   /// Return the NbrExchange for @a op and @a type, creating it if needed.
+   NbrExchange &GetNbrExchange(int op, MPI_Datatype type, int type_size) const;
+   /// Start the requests of @a ex, or the neighbor collective.
+   void StartNbrExchange(NbrExchange &ex) const;
+   void CreateNbrComm();
+   void DeleteNbrExchanges();
+
 public:
    /// Construct a GroupCommunicator object.
    /** The object must be initialized before it can be used to perform any
@@ -280,6 +318,15 @@ public:
    /// Allocate internal buffers after the GroupLDofTable is defined
    void Finalize();
 
+   /// Set the communication mode, see Mode.
+   /** No operation can be in progress. Switching to or from the mode
+       byNeighborCollective is collective on the communicator of the
+       GroupTopology, since it creates or frees the graph communicator. */
+   void SetMode(Mode m);
+
+   /// Return the communication mode.
+   Mode GetMode() const { return mode; }
+
    /// Initialize the internal group_ltdof Table.
    /** This method must be called before performing operations that use local
        data layout 2, see CopyGroupToBuffer() for layout descriptions. */
@@ -18,6 +18,9 @@
 #include "hash_util.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <type_traits>
 #include <utility>
 
@@ -457,6 +460,90 @@ protected:
    int BinSize(int idx) const;
 };
 
+/** @brief A HashTable whose find-or-insert methods can be called concurrently
+    by several threads.
+
+    The methods Get(), GetId(), Find() and FindId() of this class are
+    thread-safe and can be mixed freely. The bins of the hash table are
+    protected by a fixed number of striped locks, and the allocation of new
+    items by a separate lock. Rehashing the table, and enlarging the list of
+    blocks of the underlying BlockArray, require exclusive access and are done
+    by one thread while the other threads wait on a reader-writer lock.
+
+    The items are never moved, so the ids (and the pointers returned by Get())
+    remain valid, as in HashTable. The ids of items inserted concurrently depend
+    on the order in which the threads allocate them. The other methods of
+    HashTable (Delete(), Reparent(), the iterators, etc.) are not thread-safe
+    and must not be called during a concurrent insertion phase. */
+template<typename T>
+class ConcurrentHashTable : public HashTable<T>
+{
+protected:
+   typedef HashTable<T> Table;
+   typedef BlockArray<T> Block;
+
+public:
+   /** @brief Construct the table, see HashTable::HashTable(). The number of
+       bin locks @a num_locks must be a power of 2. */
+   ConcurrentHashTable(int block_size = 16*1024, int init_hash_size = 32*1024,
+                       int num_locks = 256);
+   /// Deep copy
+   ConcurrentHashTable(const ConcurrentHashTable &other);
+
+   /// Thread-safe version of HashTable::Get().
+   T* Get(int p1, int p2) { return Access(GetId(p1, p2)); }
+   /// Thread-safe version of HashTable::Get().
+   T* Get(int p1, int p2, int p3, int p4 = -1)
+   { return Access(GetId(p1, p2, p3, p4)); }
+
+   /// Thread-safe version of HashTable::GetId().
+   int GetId(int p1, int p2);
+   /// Thread-safe version of HashTable::GetId().
+   int GetId(int p1, int p2, int p3, int p4 = -1);
+
+   /// Thread-safe version of HashTable::Find().
+   T* Find(int p1, int p2) { return Access(FindId(p1, p2)); }
+   /// Thread-safe version of HashTable::Find().
+   T* Find(int p1, int p2, int p3, int p4 = -1)
+   { return Access(FindId(p1, p2, p3, p4)); }
+   /// Thread-safe version of HashTable::Find().
+   const T* Find(int p1, int p2) const { return Access(FindId(p1, p2)); }
+   /// Thread-safe version of HashTable::Find().
+   const T* Find(int p1, int p2, int p3, int p4 = -1) const
+   { return Access(FindId(p1, p2, p3, p4)); }
+
+   /// Thread-safe version of HashTable::FindId().
+   int FindId(int p1, int p2) const;
+   /// Thread-safe version of HashTable::FindId().
+   int FindId(int p1, int p2, int p3, int p4 = -1) const;
+
+protected:
+   /// Exclusive: rehash or grow the block list; shared: all other accesses.
+   mutable std::shared_mutex table_lock;
+   /// Striped locks of the bins, bin idx is protected by idx & lock_mask.
+   mutable std::unique_ptr<std::mutex[]> bin_locks;
+   int lock_mask;
+   /// Protects the allocation of new items (and the 'unused' list).
+   std::mutex alloc_lock;
+
+   std::mutex &BinLock(int idx) const { return bin_locks[idx & lock_mask]; }
+
+   /// Return the item @a id (or NULL if @a id < 0) under the shared lock.
+   T* Access(int id);
+   const T* Access(int id) const;
+
+   /** @brief Allocate a new item, under the shared lock. Return -1 if the list
+       of blocks of the BlockArray needs to be enlarged, see Grow(). Set
+       @a rehash to true if the table needs to be rehashed. */
+   int NewId(bool &rehash);
+
+   /// Enlarge the list of blocks of the BlockArray, with exclusive access.
+   void Grow();
+
+   /// Rehash the table if it is overfull, with exclusive access.
+   void Rehash();
+};
+
 /// Hash function for data sequences.
 /** Depends on GnuTLS for SHA-256 hashing. */
 class HashFunction
@@ -936,6 +1023,165 @@ void HashTable<T>::PrintStats() const
    }
 }
 
+template<typename T>
+ConcurrentHashTable<T>::ConcurrentHashTable(int block_size,
+                                            int init_hash_size, int num_locks)
+   : Table(block_size, init_hash_size),
+     bin_locks(new std::mutex[num_locks]), lock_mask(num_locks-1)
+{
+   MFEM_VERIFY(!(num_locks & lock_mask), "num_locks must be a power of two.");
+}
+
+template<typename T>
+ConcurrentHashTable<T>::ConcurrentHashTable(const ConcurrentHashTable &other)
+   : Table(other),
+     bin_locks(new std::mutex[other.lock_mask+1]), lock_mask(other.lock_mask)
+{ }
+
+template<typename T>
+inline T* ConcurrentHashTable<T>::Access(int id)
+{
+   if (id < 0) { return NULL; }
+   std::shared_lock<std::shared_mutex> shared(table_lock);
+   return &(Block::At(id));
+}
+
+template<typename T>
+inline const T* ConcurrentHashTable<T>::Access(int id) const
+{
+   if (id < 0) { return NULL; }
+   std::shared_lock<std::shared_mutex> shared(table_lock);
+   return &(Block::At(id));
+}
+
+template<typename T>
+int ConcurrentHashTable<T>::NewId(bool &rehash)
+{
+   std::lock_guard<std::mutex> guard(alloc_lock);
+   int new_id;
+   if (Table::unused.Size())
+   {
+      new_id = Table::unused.Last();
+      Table::unused.DeleteLast();
+   }
+   else
+   {
+      // the block list must not be reallocated while other threads read it
+      if (Block::size == Block::Capacity() &&
+          Block::blocks.Size() == Block::blocks.Capacity())
+      {
+         return -1;
+      }
+      new_id = Block::Append();
+   }
+   const int fill_factor = 2;
+   rehash = (Block::Size() > (Table::mask+1) * fill_factor);
+   return new_id;
+}
+
+template<typename T>
+void ConcurrentHashTable<T>::Grow()
+{
+   std::unique_lock<std::shared_mutex> exclusive(table_lock);
+   Block::blocks.Reserve(std::max(2*Block::blocks.Capacity(), 16));
+}
+
+template<typename T>
+void ConcurrentHashTable<T>::Rehash()
+{
+   std::unique_lock<std::shared_mutex> exclusive(table_lock);
+   Table::CheckRehash(); // another thread may have rehashed already
+}
+
+template<typename T>
+int ConcurrentHashTable<T>::GetId(int p1, int p2)
+{
+   if (p1 > p2) { std::swap(p1, p2); }
+   int id;
+   bool rehash = false;
+   {
+      std::shared_lock<std::shared_mutex> shared(table_lock);
+      const int idx = Table::Hash(p1, p2);
+      std::lock_guard<std::mutex> bin(BinLock(idx));
+
+      // search for the item in the hashtable
+      id = Table::SearchList(Table::table[idx], p1, p2);
+      if (id >= 0) { return id; }
+
+      // not found - use an unused item or create a new one
+      id = NewId(rehash);
+      if (id >= 0)
+      {
+         T& item = Block::At(id);
+         item.p1 = p1;
+         item.p2 = p2;
+         Table::Insert(idx, id, item);
+      }
+   }
+   if (id < 0)
+   {
+      Grow();
+      return GetId(p1, p2);
+   }
+   if (rehash) { Rehash(); }
+   return id;
+}
+
+template<typename T>
+int ConcurrentHashTable<T>::GetId(int p1, int p2, int p3, int p4)
+{
+   internal::sort4_ext(p1, p2, p3, p4);
+   int id;
+   bool rehash = false;
+   {
+      std::shared_lock<std::shared_mutex> shared(table_lock);
+      const int idx = Table::Hash(p1, p2, p3);
+      std::lock_guard<std::mutex> bin(BinLock(idx));
+
+      // search for the item in the hashtable
+      id = Table::SearchList(Table::table[idx], p1, p2, p3);
+      if (id >= 0) { return id; }
+
+      // not found - use an unused item or create a new one
+      id = NewId(rehash);
+      if (id >= 0)
+      {
+         T& item = Block::At(id);
+         item.p1 = p1;
+         item.p2 = p2;
+         item.p3 = p3;
+         Table::Insert(idx, id, item);
+      }
+   }
+   if (id < 0)
+   {
+      Grow();
+      return GetId(p1, p2, p3);
+   }
+   if (rehash) { Rehash(); }
+   return id;
+}
+
+template<typename T>
+int ConcurrentHashTable<T>::FindId(int p1, int p2) const
+{
+   if (p1 > p2) { std::swap(p1, p2); }
+   std::shared_lock<std::shared_mutex> shared(table_lock);
+   const int idx = Table::Hash(p1, p2);
+   std::lock_guard<std::mutex> bin(BinLock(idx));
+   return Table::SearchList(Table::table[idx], p1, p2);
+}
+
+template<typename T>
+int ConcurrentHashTable<T>::FindId(int p1, int p2, int p3, int p4) const
+{
+   internal::sort4_ext(p1, p2, p3, p4);
+   std::shared_lock<std::shared_mutex> shared(table_lock);
+   const int idx = Table::Hash(p1, p2, p3);
+   std::lock_guard<std::mutex> bin(BinLock(idx));
+   return Table::SearchList(Table::table[idx], p1, p2, p3);
+}
+
 
 template <typename int_type_const_iter>
 HashFunction &HashFunction::EncodeAndHashInts(int_type_const_iter begin,
@@ -17,6 +17,8 @@
 #include <unordered_map>
 #include <algorithm> // std::max
 #include <cstdint>
+#include <mutex>
+#include <vector>
 
 // Uncomment to try _WIN32 platform
 //#define _WIN32
@@ -80,10 +82,12 @@ bool MemoryClassContainsType(MemoryClass mc, MemoryType mt)
       case MemoryClass::HOST_32:
          return (mt == MemoryType::HOST_32 ||
                  mt == MemoryType::HOST_64 ||
-                 mt == MemoryType::HOST_DEBUG);
+                 mt == MemoryType::HOST_DEBUG ||
+                 mt == MemoryType::HOST_POOL);
       case MemoryClass::HOST_64:
          return (mt == MemoryType::HOST_64 ||
-                 mt == MemoryType::HOST_DEBUG);
+                 mt == MemoryType::HOST_DEBUG ||
+                 mt == MemoryType::HOST_POOL);
       case MemoryClass::DEVICE: return IsDeviceMemory(mt);
       case MemoryClass::MANAGED:
          return (mt == MemoryType::MANAGED);
@@ -263,6 +267,140 @@ public:
    void Dealloc(void *ptr) override { mfem_aligned_free(ptr); }
 };
 
+/// The pooled host memory space
+/** The blocks are 64-byte aligned and rounded up, together with a 64-byte
+    header storing their size, to power-of-two size classes. Deallocated blocks
+    are cached in per-class free lists and reused by later allocations of the
+    same class; blocks larger than the largest class are not cached. All the
+    operations are protected by a mutex. */
+class PoolHostMemorySpace : public HostMemorySpace
+{
+   static constexpr size_t align = 64;
+   static constexpr int min_log2 = 6, max_log2 = 30;
+   static constexpr int num_classes = max_log2 - min_log2 + 1;
+
+   std::mutex mutex;
+   std::vector<void*> free_blocks[num_classes];
+   // Size of the blocks in use. It is kept out of the blocks, so that a
+   // power-of-two request fills its size class exactly.
+   std::unordered_map<void*, size_t> block_sizes;
+   size_t max_cached_bytes = size_t(1) << 30;
+   HostPoolStatistics stats;
+
+   /// Return the size class of a block of @a bytes, or -1 if too large
+   static int SizeClass(size_t bytes)
+   {
+      for (int c = 0; c < num_classes; c++)
+      {
+         if (bytes <= (size_t(1) << (min_log2 + c))) { return c; }
+      }
+      return -1;
+   }
+
+   static size_t BlockBytes(int c, size_t bytes)
+   {
+      return (c >= 0) ? (size_t(1) << (min_log2 + c)) :
+             (bytes + align - 1) / align * align;
+   }
+
+   // Free the cached blocks, starting from the largest classes, until at most
+   // @a max_bytes are cached. The mutex must be locked.
+   void Trim(size_t max_bytes)
+   {
+      for (int c = num_classes - 1; c >= 0 && stats.bytes_cached > max_bytes;
+           c--)
+      {
+         const size_t block_bytes = BlockBytes(c, 0);
+         while (!free_blocks[c].empty() && stats.bytes_cached > max_bytes)
+         {
+            mfem_aligned_free(free_blocks[c].back());
+            free_blocks[c].pop_back();
+            stats.bytes_cached -= block_bytes;
+         }
+      }
+   }
+
+public:
+   PoolHostMemorySpace(): HostMemorySpace() { }
+   ~PoolHostMemorySpace() { Release(); }
+
+   void Alloc(void **ptr, size_t bytes) override
+   {
+      const int c = SizeClass(bytes);
+      const size_t block_bytes = BlockBytes(c, bytes);
+      void *block = nullptr;
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stats.num_allocs++;
+         if (c >= 0 && !free_blocks[c].empty())
+         {
+            block = free_blocks[c].back();
+            free_blocks[c].pop_back();
+            stats.num_hits++;
+            stats.bytes_cached -= block_bytes;
+         }
+         stats.bytes_in_use += block_bytes;
+         stats.peak_bytes = std::max(stats.peak_bytes, stats.bytes_in_use);
+      }
+      if (!block && mfem_memalign(&block, align, block_bytes) != 0)
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         stats.bytes_in_use -= block_bytes;
+         throw ::std::bad_alloc();
+      }
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         block_sizes[block] = block_bytes;
+      }
+      *ptr = block;
+   }
+
+   void Dealloc(void *ptr) override
+   {
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         auto it = block_sizes.find(ptr);
+         MFEM_ASSERT(it != block_sizes.end(), "unknown HOST_POOL block");
+         const size_t block_bytes = it->second;
+         block_sizes.erase(it);
+         stats.bytes_in_use -= block_bytes;
+         // Blocks larger than the largest class are not cached
+         const int c = SizeClass(block_bytes);
+         if (c >= 0)
+         {
+            if (stats.bytes_cached + block_bytes <= max_cached_bytes)
+            {
+               free_blocks[c].push_back(ptr);
+               stats.bytes_cached += block_bytes;
+               return;
+            }
+         }
+      }
+      mfem_aligned_free(ptr);
+   }
+
+   HostPoolStatistics GetStatistics()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      return stats;
+   }
+
+   void SetCacheLimit(size_t bytes)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      max_cached_bytes = bytes;
+      Trim(max_cached_bytes);
+   }
+
+   void Release()
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      Trim(0);
+      stats.num_allocs = stats.num_hits = 0;
+      stats.peak_bytes = stats.bytes_in_use;
+   }
+};
+
 #ifndef _WIN32
 static uintptr_t pagesize = 0;
 static uintptr_t pagemask = 0;
@@ -685,7 +823,8 @@ class Ctrl
    typedef MemoryType MT;
 
 public:
-   HostMemorySpace *host[HostMemoryTypeSize];
+   // Indexed by MemoryType, HOST_POOL follows the device types
+   HostMemorySpace *host[MemoryTypeSize];
    DeviceMemorySpace *device[DeviceMemoryTypeSize];
 
 public:
@@ -699,11 +838,12 @@ public:
       }
 
       // Filling the host memory backends
-      // HOST, HOST_32 & HOST_64 are always ready
+      // HOST, HOST_32, HOST_64 & HOST_POOL are always ready
       // MFEM_USE_UMPIRE will set either [No/Umpire] HostMemorySpace
       host[static_cast<int>(MT::HOST)] = new StdHostMemorySpace();
       host[static_cast<int>(MT::HOST_32)] = new Aligned32HostMemorySpace();
       host[static_cast<int>(MT::HOST_64)] = new Aligned64HostMemorySpace();
+      host[static_cast<int>(MT::HOST_POOL)] = new PoolHostMemorySpace();
       // HOST_DEBUG is delayed, as it reroutes signals
       host[static_cast<int>(MT::HOST_DEBUG)] = nullptr;
       host[static_cast<int>(MT::HOST_UMPIRE)] = nullptr;
@@ -749,9 +889,9 @@ public:
    ~Ctrl()
    {
       constexpr int mt_h = HostMemoryType;
-      constexpr int mt_d = DeviceMemoryType;
       for (int mt = mt_h; mt < HostMemoryTypeSize; mt++) { delete host[mt]; }
-      for (int mt = mt_d; mt < MemoryTypeSize; mt++) { delete device[mt-mt_d]; }
+      delete host[static_cast<int>(MT::HOST_POOL)];
+      for (int mt = 0; mt < DeviceMemoryTypeSize; mt++) { delete device[mt]; }
    }
 
 private:
@@ -1054,12 +1194,14 @@ bool MemoryManager::MemoryClassCheck_(MemoryClass mc, void *h_ptr,
       case MemoryClass::HOST_32:
       {
          MFEM_VERIFY(h_mt == MemoryType::HOST_32 ||
-                     h_mt == MemoryType::HOST_64,"");
+                     h_mt == MemoryType::HOST_64 ||
+                     h_mt == MemoryType::HOST_POOL,"");
          return true;
       }
       case MemoryClass::HOST_64:
       {
-         MFEM_VERIFY(h_mt == MemoryType::HOST_64,"");
+         MFEM_VERIFY(h_mt == MemoryType::HOST_64 ||
+                     h_mt == MemoryType::HOST_POOL,"");
          return true;
       }
       case MemoryClass::DEVICE:
@@ -1366,6 +1508,15 @@ bool MemoryManager::IsAlias_(const void *h_ptr)
    return maps->aliases.find(h_ptr) != maps->aliases.end();
 }
 
+bool MemoryManager::HasDevicePtr_(const void *h_ptr)
+{
+   if (!mm.exists) { return false; }
+   const auto iter = maps->memories.find(h_ptr);
+   if (iter == maps->memories.end()) { return false; }
+   const void *d_ptr = iter->second.d_ptr;
+   return d_ptr != nullptr && d_ptr != h_ptr;
+}
+
 void MemoryManager::Insert(void *h_ptr, size_t bytes,
                            MemoryType h_mt, MemoryType d_mt)
 {
@@ -1604,6 +1755,27 @@ void MemoryManager::Init()
 
 MemoryManager::MemoryManager() { Init(); }
 
+HostPoolStatistics MemoryManager::GetHostPoolStatistics()
+{
+   if (!exists) { return HostPoolStatistics(); }
+   return static_cast<internal::PoolHostMemorySpace*>(
+             ctrl->Host(MemoryType::HOST_POOL))->GetStatistics();
+}
+
+void MemoryManager::ReleaseHostPool()
+{
+   if (!exists) { return; }
+   static_cast<internal::PoolHostMemorySpace*>(
+      ctrl->Host(MemoryType::HOST_POOL))->Release();
+}
+
+void MemoryManager::SetHostPoolCacheLimit(size_t bytes)
+{
+   if (!exists) { return; }
+   static_cast<internal::PoolHostMemorySpace*>(
+      ctrl->Host(MemoryType::HOST_POOL))->SetCacheLimit(bytes);
+}
+
 MemoryManager::~MemoryManager() { if (exists) { Destroy(); } }
 
 void MemoryManager::SetDualMemoryType(MemoryType mt, MemoryType dual_mt)
@@ -1808,7 +1980,8 @@ MemoryType MemoryManager::dual_map[MemoryTypeSize] =
    /* DEVICE          */  MemoryType::HOST,
    /* DEVICE_DEBUG    */  MemoryType::HOST_DEBUG,
    /* DEVICE_UMPIRE   */  MemoryType::HOST_UMPIRE,
-   /* DEVICE_UMPIRE_2 */  MemoryType::HOST_UMPIRE
+   /* DEVICE_UMPIRE_2 */  MemoryType::HOST_UMPIRE,
+   /* HOST_POOL       */  MemoryType::DEVICE
 };
 
 #ifdef MFEM_USE_UMPIRE
@@ -1842,6 +2015,7 @@ const char *MemoryTypeName[MemoryTypeSize] =
    "device-umpire",
    "device-umpire-2",
 #endif
+   "host-pool"
 };
 
 } // namespace mfem
@@ -53,6 +53,9 @@ enum class MemoryType
                         set with MemoryManager::SetUmpireDeviceAllocatorName */
    DEVICE_UMPIRE_2, /**< Device memory; using a second Umpire allocator settable
                          with MemoryManager::SetUmpireDevice2AllocatorName */
+   HOST_POOL,      /**< Host memory; aligned at 64 bytes and recycled through a
+                        thread-safe size-class pool, see
+                        MemoryManager::GetHostPoolStatistics */
    SIZE,           ///< Number of host and device memory types
 
    PRESERVE,       /**< Pseudo-MemoryType used as default value for MemoryType
@@ -68,7 +71,8 @@ constexpr int MemoryTypeSize = static_cast<int>(MemoryType::SIZE);
 constexpr int HostMemoryType = static_cast<int>(MemoryType::HOST);
 constexpr int HostMemoryTypeSize = static_cast<int>(MemoryType::DEVICE);
 constexpr int DeviceMemoryType = static_cast<int>(MemoryType::MANAGED);
-constexpr int DeviceMemoryTypeSize = MemoryTypeSize - DeviceMemoryType;
+constexpr int DeviceMemoryTypeSize =
+   static_cast<int>(MemoryType::HOST_POOL) - DeviceMemoryType;
 
 /// Memory type names, used during Device:: configuration.
 extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
@@ -80,21 +84,25 @@ extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, HOST_PINNED, MANAGED } */
-   HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
-   HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
+                                 HOST_UMPIRE, HOST_PINNED, HOST_POOL,
+                                 MANAGED } */
+   HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG, HOST_POOL }
+   HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG, HOST_POOL }
    DEVICE,  /**< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE,
                                  DEVICE_UMPIRE_2, MANAGED } */
    MANAGED  ///< Memory types: { MANAGED }
 };
 
 /// Return true if the given memory type is in MemoryClass::HOST.
-inline bool IsHostMemory(MemoryType mt) { return mt <= MemoryType::MANAGED; }
+inline bool IsHostMemory(MemoryType mt)
+{
+   return mt <= MemoryType::MANAGED || mt == MemoryType::HOST_POOL;
+}
 
 /// Return true if the given memory type is in MemoryClass::DEVICE
 inline bool IsDeviceMemory(MemoryType mt)
 {
-   return mt >= MemoryType::MANAGED && mt < MemoryType::SIZE;
+   return mt >= MemoryType::MANAGED && mt <= MemoryType::DEVICE_UMPIRE_2;
 }
 
 /// Return a suitable MemoryType for a given MemoryClass.
@@ -306,6 +314,11 @@ public:
    void SetDevicePtrOwner(bool own) const
    { flags = own ? (flags | OWNS_DEVICE) : (flags & ~OWNS_DEVICE); }
 
+   /** @brief Return true if a separate device allocation exists and is owned,
+       i.e. it will be deleted by the method Delete(). Always false for
+       aliases. */
+   inline bool HasOwnedDeviceAllocation() const;
+
    /** @brief Clear the ownership flags for the host and device pointers, as
        well as any internal data allocated by the Memory object. */
    void ClearOwnerFlags() const
@@ -618,6 +631,20 @@ void swap(Memory<T> &a, Memory<T> &b)
 }
 
 
+/// Usage statistics of the MemoryType::HOST_POOL allocator.
+struct HostPoolStatistics
+{
+   size_t num_allocs = 0;   ///< Number of allocations
+   size_t num_hits = 0;     ///< Allocations served from a cached block
+   size_t bytes_in_use = 0; ///< Bytes of the blocks currently allocated
+   size_t peak_bytes = 0;   ///< Maximum of bytes_in_use
+   size_t bytes_cached = 0; ///< Bytes of the blocks cached for reuse
+
+   /// Return the fraction of the allocations served from a cached block.
+   double HitRate() const
+   { return num_allocs ? double(num_hits)/double(num_allocs) : 0.0; }
+};
+
 /** The MFEM memory manager class. Host-side pointers are inserted into this
     manager which keeps track of the associated device pointer, and where the
     data currently resides. */
@@ -751,6 +778,10 @@ private: // Static methods used by the Memory<T> class
        memory manager. */
    static bool IsAlias_(const void *h_ptr);
 
+   /** @brief Check if the registered (non-alias) host pointer @a h_ptr has a
+       separate device allocation. */
+   static bool HasDevicePtr_(const void *h_ptr);
+
    /// Compare the contents of the host and the device memory.
    static int CompareHostAndDevice_(void *h_ptr, size_t size, unsigned flags);
 
@@ -811,6 +842,7 @@ public:
        HOST_DEBUG      | DEVICE_DEBUG
        HOST_UMPIRE     | DEVICE_UMPIRE
        HOST_PINNED     | DEVICE
+       HOST_POOL       | DEVICE
        MANAGED         | MANAGED
        DEVICE          | HOST
        DEVICE_DEBUG    | HOST_DEBUG
@@ -878,6 +910,26 @@ public:
    static MemoryType GetHostMemoryType() { return host_mem_type; }
    static MemoryType GetDeviceMemoryType() { return device_mem_type; }
 
+   /// Return the usage statistics of the MemoryType::HOST_POOL allocator.
+   /** The pool rounds the allocations up to power-of-two size classes (up to
+       1 GiB) and keeps the released blocks for reuse by later allocations of
+       the same class, see SetHostPoolCacheLimit(). It can be used explicitly,
+       e.g. Vector(n, MemoryType::HOST_POOL), or as the default host MemoryType
+       through Device::SetMemoryTypes() or the environment variable
+       MFEM_MEMORY=pool. */
+   static HostPoolStatistics GetHostPoolStatistics();
+
+   /// Free the blocks cached by the MemoryType::HOST_POOL allocator.
+   /** The blocks that are in use are not affected; the peak and the counters
+       of the statistics are reset. */
+   static void ReleaseHostPool();
+
+   /// Set the maximum number of bytes cached by the MemoryType::HOST_POOL
+   /// allocator, the default is 1 GiB.
+   /** Released blocks that would exceed the limit are freed instead of being
+       cached; cached blocks exceeding a lowered limit are freed. */
+   static void SetHostPoolCacheLimit(size_t bytes);
+
 #ifdef MFEM_USE_ENZYME
    static void myfree(void* mem, MemoryType MT, unsigned &flags)
    {
@@ -1278,6 +1330,16 @@ inline bool Memory<T>::DeviceIsValid() const
    return flags & VALID_DEVICE ? true : false;
 }
 
+template <typename T>
+inline bool Memory<T>::HasOwnedDeviceAllocation() const
+{
+   if (!(flags & Registered) || (flags & ALIAS) || !(flags & OWNS_DEVICE))
+   {
+      return false;
+   }
+   return MemoryManager::HasDevicePtr_(h_ptr);
+}
+
 template <typename T>
 inline void Memory<T>::CopyFrom(const Memory &src, int size)
 {
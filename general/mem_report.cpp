@@ -0,0 +1,160 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mem_report.hpp"
+
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace mfem
+{
+
+std::size_t MemoryReport::HostBytes() const
+{
+   std::size_t bytes = host_bytes;
+   for (const MemoryReport &child : children) { bytes += child.HostBytes(); }
+   return bytes;
+}
+
+std::size_t MemoryReport::DeviceBytes() const
+{
+   std::size_t bytes = device_bytes;
+   for (const MemoryReport &child : children) { bytes += child.DeviceBytes(); }
+   return bytes;
+}
+
+std::string MemoryReport::FormatBytes(std::size_t bytes)
+{
+   static const char *units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+   double value = double(bytes);
+   int u = 0;
+   while (value >= 1024.0 && u < 4) { value /= 1024.0; u++; }
+   std::ostringstream os;
+   if (u == 0) { os << bytes << ' ' << units[0]; }
+   else
+   {
+      os << std::fixed << std::setprecision(1) << value << ' ' << units[u];
+   }
+   return os.str();
+}
+
+namespace
+{
+
+/// A node of a flattened MemoryReport: its depth, path and totals.
+struct FlatNode
+{
+   int depth;
+   std::string path, name;
+   std::size_t host, device;
+};
+
+void Flatten(const MemoryReport &report, int depth, const std::string &path,
+             int max_depth, std::vector<FlatNode> &nodes)
+{
+   nodes.push_back({depth, path, report.GetName(), report.HostBytes(),
+                    report.DeviceBytes()});
+   if (max_depth >= 0 && depth >= max_depth) { return; }
+   // Children with the same name are distinguished by their index
+   std::map<std::string, int> count;
+   for (const MemoryReport &child : report.GetChildren())
+   {
+      const int k = count[child.GetName()]++;
+      std::string child_path = path + '/' + child.GetName();
+      if (k > 0) { child_path += '#' + std::to_string(k); }
+      Flatten(child, depth + 1, child_path, max_depth, nodes);
+   }
+}
+
+} // anonymous namespace
+
+void MemoryReport::Print(std::ostream &os, int depth) const
+{
+   std::vector<FlatNode> nodes;
+   Flatten(*this, 0, name, depth, nodes);
+   os << std::left << std::setw(48) << "Memory report" << std::right
+      << std::setw(14) << "host" << std::setw(14) << "device" << '\n';
+   for (const FlatNode &n : nodes)
+   {
+      os << std::left << std::setw(48) << (std::string(2*n.depth, ' ') + n.name)
+         << std::right << std::setw(14) << FormatBytes(n.host)
+         << std::setw(14) << FormatBytes(n.device) << '\n';
+   }
+   os << std::flush;
+}
+
+#ifdef MFEM_USE_MPI
+void MemoryReport::PrintSummary(MPI_Comm comm, std::ostream &os,
+                                int depth) const
+{
+   int rank;
+   MPI_Comm_rank(comm, &rank);
+
+   std::vector<FlatNode> nodes;
+   Flatten(*this, 0, name, depth, nodes);
+
+   // Broadcast the structure of the report on rank 0
+   std::string structure;
+   if (rank == 0)
+   {
+      for (const FlatNode &n : nodes) { structure += n.path + '\n'; }
+   }
+   int length = int(structure.size());
+   MPI_Bcast(&length, 1, MPI_INT, 0, comm);
+   structure.resize(length);
+   MPI_Bcast(&structure[0], length, MPI_CHAR, 0, comm);
+
+   std::map<std::string, const FlatNode*> local;
+   for (const FlatNode &n : nodes) { local[n.path] = &n; }
+
+   std::vector<std::string> paths;
+   std::istringstream is(structure);
+   for (std::string path; std::getline(is, path); ) { paths.push_back(path); }
+
+   const int num_nodes = int(paths.size());
+   std::vector<double> values(2*num_nodes, 0.0);
+   for (int i = 0; i < num_nodes; i++)
+   {
+      const auto it = local.find(paths[i]);
+      if (it == local.end()) { continue; }
+      values[2*i+0] = double(it->second->host);
+      values[2*i+1] = double(it->second->device);
+   }
+   std::vector<double> vmin(2*num_nodes), vmax(2*num_nodes), vsum(2*num_nodes);
+   MPI_Reduce(values.data(), vmin.data(), 2*num_nodes, MPI_DOUBLE, MPI_MIN, 0,
+              comm);
+   MPI_Reduce(values.data(), vmax.data(), 2*num_nodes, MPI_DOUBLE, MPI_MAX, 0,
+              comm);
+   MPI_Reduce(values.data(), vsum.data(), 2*num_nodes, MPI_DOUBLE, MPI_SUM, 0,
+              comm);
+   if (rank != 0) { return; }
+
+   os << std::left << std::setw(40) << "Memory summary" << std::right
+      << std::setw(12) << "host min" << std::setw(12) << "host max"
+      << std::setw(12) << "host sum" << std::setw(12) << "device max"
+      << std::setw(12) << "device sum" << '\n';
+   for (int i = 0; i < num_nodes; i++)
+   {
+      const FlatNode &n = nodes[i];
+      os << std::left << std::setw(40) << (std::string(2*n.depth, ' ') + n.name)
+         << std::right
+         << std::setw(12) << FormatBytes(std::size_t(vmin[2*i]))
+         << std::setw(12) << FormatBytes(std::size_t(vmax[2*i]))
+         << std::setw(12) << FormatBytes(std::size_t(vsum[2*i]))
+         << std::setw(12) << FormatBytes(std::size_t(vmax[2*i+1]))
+         << std::setw(12) << FormatBytes(std::size_t(vsum[2*i+1])) << '\n';
+   }
+   os << std::flush;
+}
+#endif
+
+} // namespace mfem
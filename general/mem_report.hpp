@@ -0,0 +1,137 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_MEM_REPORT_HPP
+#define MFEM_MEM_REPORT_HPP
+
+#include "../config/config.hpp"
+#include "globals.hpp"
+#include "mem_manager.hpp"
+#include "table.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace mfem
+{
+
+/** @brief Hierarchical report of the host and device memory held by an object
+    and the objects it owns.
+
+    Each node of the report has a name, e.g. the class or member name, the host
+    and device bytes held directly by the node, and a list of children. Objects
+    such as Mesh, FiniteElementSpace and BilinearForm build their report with a
+    GetMemoryReport() method, and a report for a whole simulation can be
+    composed with AddChild():
+
+    @code
+    MemoryReport report("simulation");
+    report.AddChild(mesh.GetMemoryReport());
+    report.AddChild(fespace.GetMemoryReport());
+    report.AddChild(a.GetMemoryReport());
+    report.Print();
+    @endcode
+
+    The reports only account for the memory of the large data containers
+    (Memory, Array, Vector, Table, SparseMatrix, ...), not for the size of the
+    objects themselves. The memory of aliases and of non-owned data is not
+    counted. */
+class MemoryReport
+{
+   std::string name;
+   std::size_t host_bytes = 0;
+   std::size_t device_bytes = 0;
+   std::vector<MemoryReport> children;
+
+public:
+   /// Create an empty report with the given @a name.
+   explicit MemoryReport(const std::string &name_ = "") : name(name_) { }
+
+   /// Return the name of the report.
+   const std::string &GetName() const { return name; }
+
+   /// Return the sub-reports.
+   const std::vector<MemoryReport> &GetChildren() const { return children; }
+
+   /// Add @a host and @a device bytes to this node.
+   MemoryReport &AddBytes(std::size_t host, std::size_t device = 0)
+   {
+      host_bytes += host;
+      device_bytes += device;
+      return *this;
+   }
+
+   /// Add the host and device allocations owned by @a mem to this node.
+   template <typename T>
+   MemoryReport &Add(const Memory<T> &mem)
+   {
+      const std::size_t bytes = std::size_t(mem.Capacity())*sizeof(T);
+      if (mem.OwnsHostPtr()) { host_bytes += bytes; }
+      if (mem.HasOwnedDeviceAllocation()) { device_bytes += bytes; }
+      return *this;
+   }
+
+   /// Add a child named @a child_name with the allocations owned by @a mem.
+   template <typename T>
+   MemoryReport &Add(const std::string &child_name, const Memory<T> &mem)
+   {
+      MemoryReport child(child_name);
+      child.Add(mem);
+      return AddChild(child);
+   }
+
+   /// Add a child named @a child_name with the arrays of @a table.
+   MemoryReport &Add(const std::string &child_name, const Table &table)
+   {
+      MemoryReport child(child_name);
+      child.Add(table.GetIMemory()).Add(table.GetJMemory());
+      return AddChild(child);
+   }
+
+   /// Add @a child as a sub-report; empty reports are skipped.
+   MemoryReport &AddChild(const MemoryReport &child)
+   {
+      if (child.HostBytes() + child.DeviceBytes() > 0)
+      {
+         children.push_back(child);
+      }
+      return *this;
+   }
+
+   /// Return the host bytes of this node and all its children.
+   std::size_t HostBytes() const;
+
+   /// Return the device bytes of this node and all its children.
+   std::size_t DeviceBytes() const;
+
+   /** @brief Print the report as a tree with the host and device totals of
+       each node, up to the given @a depth (a negative value prints all). */
+   void Print(std::ostream &os = mfem::out, int depth = -1) const;
+
+#ifdef MFEM_USE_MPI
+   /** @brief Print the minimum, maximum and sum over the ranks of @a comm of
+       the host and device totals of each node, on rank 0.
+
+       The structure of the report is taken from rank 0; nodes missing on some
+       ranks count as zero there, and nodes that only exist on other ranks are
+       ignored. This method is collective on @a comm. */
+   void PrintSummary(MPI_Comm comm, std::ostream &os = mfem::out,
+                     int depth = -1) const;
+#endif
+
+   /// Return @a bytes as a human-readable string, e.g. "1.5 MiB".
+   static std::string FormatBytes(std::size_t bytes);
+};
+
+} // namespace mfem
+
+#endif
@@ -0,0 +1,522 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "region_timer.hpp"
+#include "error.hpp"
+#ifdef MFEM_USE_MPI
+#include "communication.hpp"
+#endif
+
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <vector>
+
+namespace mfem
+{
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+/// A region of the tree of a thread.
+struct RegionNode
+{
+   std::string name;
+   int parent;
+   std::vector<int> children;
+   long count = 0;
+   double time = 0.0;
+};
+
+/// A recorded region instance: its node, start time and duration in seconds.
+struct TraceEvent
+{
+   int node;
+   double start, duration;
+};
+
+/// The region tree, the active regions and the trace events of a thread.
+struct ThreadRegions
+{
+   const int id;
+   std::vector<RegionNode> nodes; // nodes[0] is the (unnamed) root
+   std::vector<int> stack; // the active nodes, starting with the root
+   std::vector<Clock::time_point> starts; // the start times of stack[1:]
+   std::vector<TraceEvent> events;
+
+   explicit ThreadRegions(int id_) : id(id_) { Clear(); }
+
+   void Clear()
+   {
+      nodes.assign(1, RegionNode{"", -1});
+      stack.assign(1, 0);
+      starts.clear();
+      events.clear();
+   }
+};
+
+/// A region of the tree merged over the threads, in depth-first order.
+struct FlatRegion
+{
+   int depth;
+   std::string path, name;
+   long count;
+   double time, max_thread_time;
+   int num_threads;
+};
+
+struct Registry
+{
+   std::mutex mutex;
+   std::vector<std::unique_ptr<ThreadRegions>> threads;
+   const Clock::time_point epoch = Clock::now();
+   bool trace = false;
+   long max_events = 0;
+   int rank = -1; // the MPI world rank, when known
+   std::string report_file, trace_file; // written at exit, if set
+};
+
+// The registry is never destroyed, so that regions can be timed at exit
+Registry &GetRegistry()
+{
+   static Registry *registry = new Registry;
+   return *registry;
+}
+
+thread_local ThreadRegions *this_thread = nullptr;
+
+ThreadRegions &ThisThread()
+{
+   if (!this_thread)
+   {
+      Registry &reg = GetRegistry();
+      std::lock_guard<std::mutex> lock(reg.mutex);
+      reg.threads.emplace_back(new ThreadRegions(int(reg.threads.size())));
+      this_thread = reg.threads.back().get();
+#ifdef MFEM_USE_MPI
+      if (Mpi::IsInitialized() && !Mpi::IsFinalized())
+      {
+         reg.rank = Mpi::WorldRank();
+      }
+#endif
+   }
+   return *this_thread;
+}
+
+/// A node of the region tree merged over the threads.
+struct MergedNode
+{
+   std::string name;
+   long count = 0;
+   double time = 0.0, max_thread_time = 0.0;
+   int num_threads = 0;
+   std::vector<MergedNode> children;
+};
+
+void MergeInto(MergedNode &m, const ThreadRegions &t, int node)
+{
+   for (int c : t.nodes[node].children)
+   {
+      const RegionNode &child = t.nodes[c];
+      MergedNode *mc = nullptr;
+      for (MergedNode &mchild : m.children)
+      {
+         if (mchild.name == child.name) { mc = &mchild; break; }
+      }
+      if (!mc)
+      {
+         m.children.emplace_back();
+         mc = &m.children.back();
+         mc->name = child.name;
+      }
+      mc->count += child.count;
+      mc->time += child.time;
+      mc->max_thread_time = std::max(mc->max_thread_time, child.time);
+      mc->num_threads++;
+      MergeInto(*mc, t, c);
+   }
+}
+
+void Flatten(const MergedNode &m, int depth, const std::string &path,
+             std::vector<FlatRegion> &regions)
+{
+   for (const MergedNode &c : m.children)
+   {
+      const std::string c_path = path.empty() ? c.name : path + '/' + c.name;
+      regions.push_back({depth, c_path, c.name, c.count, c.time,
+                         c.max_thread_time, c.num_threads});
+      Flatten(c, depth + 1, c_path, regions);
+   }
+}
+
+std::vector<FlatRegion> GetRegions(Registry &reg)
+{
+   MergedNode root;
+   std::lock_guard<std::mutex> lock(reg.mutex);
+   for (const auto &t : reg.threads) { MergeInto(root, *t, 0); }
+   std::vector<FlatRegion> regions;
+   Flatten(root, 0, "", regions);
+   return regions;
+}
+
+std::string JSONString(const std::string &s)
+{
+   std::string json = "\"";
+   for (char c : s)
+   {
+      if (c == '"' || c == '\\') { json += '\\'; json += c; }
+      else if (c == '\n') { json += "\\n"; }
+      else { json += c; }
+   }
+   return json + '"';
+}
+
+/** Print the depth-first list @a regions as nested JSON objects, with the
+    fields of region i printed by @a fields(i). */
+void PrintNestedJSON(std::ostream &os, const std::vector<FlatRegion> &regions,
+                     const std::function<void(int)> &fields)
+{
+   os << '[';
+   int prev = 0;
+   for (int i = 0; i < int(regions.size()); i++)
+   {
+      const int depth = regions[i].depth;
+      if (i > 0)
+      {
+         if (depth > prev) { os << ", \"children\": ["; }
+         else
+         {
+            os << '}';
+            for (int k = depth; k < prev; k++) { os << "]}"; }
+            os << ", ";
+         }
+      }
+      os << '{';
+      fields(i);
+      prev = depth;
+   }
+   if (!regions.empty())
+   {
+      os << '}';
+      for (int k = 0; k < prev; k++) { os << "]}"; }
+   }
+   os << ']';
+}
+
+void PrintJSON(Registry &reg, std::ostream &os)
+{
+   const std::vector<FlatRegion> regions = GetRegions(reg);
+   os << "{\"rank\": " << std::max(reg.rank, 0) << ", \"regions\": ";
+   PrintNestedJSON(os, regions, [&](int i)
+   {
+      const FlatRegion &r = regions[i];
+      os << "\"name\": " << JSONString(r.name) << ", \"calls\": " << r.count
+         << ", \"time\": " << r.time << ", \"max_thread_time\": "
+         << r.max_thread_time << ", \"threads\": " << r.num_threads;
+   });
+   os << "}\n" << std::flush;
+}
+
+void PrintChromeTrace(Registry &reg, std::ostream &os)
+{
+   std::lock_guard<std::mutex> lock(reg.mutex);
+   const std::ios::fmtflags flags = os.flags();
+   const std::streamsize precision = os.precision();
+   os << std::fixed << std::setprecision(3) << "{\"traceEvents\": [";
+   bool first = true;
+   for (const auto &t : reg.threads)
+   {
+      for (const TraceEvent &e : t->events)
+      {
+         os << (first ? "\n" : ",\n") << "{\"name\": "
+            << JSONString(t->nodes[e.node].name)
+            << ", \"ph\": \"X\", \"ts\": " << 1e6*e.start
+            << ", \"dur\": " << 1e6*e.duration
+            << ", \"pid\": " << std::max(reg.rank, 0)
+            << ", \"tid\": " << t->id << '}';
+         first = false;
+      }
+   }
+   os << "\n], \"displayTimeUnit\": \"ms\"}\n" << std::flush;
+   os.flags(flags);
+   os.precision(precision);
+}
+
+std::string RankFileName(const Registry &reg, const std::string &fname)
+{
+   return reg.rank < 0 ? fname : fname + '.' + std::to_string(reg.rank);
+}
+
+/// Write the files requested with the environment variables at exit.
+struct ReportAtExit
+{
+   ~ReportAtExit()
+   {
+      Registry &reg = GetRegistry();
+      if (!reg.report_file.empty())
+      {
+         std::ofstream ofs(RankFileName(reg, reg.report_file));
+         if (ofs) { PrintJSON(reg, ofs); }
+      }
+      if (!reg.trace_file.empty())
+      {
+         std::ofstream ofs(RankFileName(reg, reg.trace_file));
+         if (ofs) { PrintChromeTrace(reg, ofs); }
+      }
+   }
+} report_at_exit;
+
+bool InitRegionTimers()
+{
+   Registry &reg = GetRegistry();
+   bool enable = false;
+   const char *timers = GetEnv("MFEM_REGION_TIMERS");
+   if (timers && std::string(timers) != "NO")
+   {
+      enable = true;
+      const std::string value(timers);
+      if (value != "YES" && value != "1") { reg.report_file = value; }
+   }
+   const char *trace = GetEnv("MFEM_REGION_TRACE");
+   if (trace && trace[0] != '\0')
+   {
+      enable = true;
+      reg.trace = true;
+      reg.max_events = 1000000;
+      reg.trace_file = trace;
+   }
+   return enable;
+}
+
+} // anonymous namespace
+
+bool RegionTimer::enabled = InitRegionTimers();
+
+void RegionTimer::EnableTrace(bool enable, long max_events)
+{
+   Registry &reg = GetRegistry();
+   reg.trace = enable;
+   reg.max_events = max_events;
+}
+
+void RegionTimer::Begin(const char *name)
+{
+   ThreadRegions &t = ThisThread();
+   const int parent = t.stack.back();
+   int node = -1;
+   for (int c : t.nodes[parent].children)
+   {
+      if (t.nodes[c].name == name) { node = c; break; }
+   }
+   if (node < 0)
+   {
+      node = int(t.nodes.size());
+      t.nodes.push_back(RegionNode{name, parent});
+      t.nodes[parent].children.push_back(node);
+   }
+   t.stack.push_back(node);
+   t.starts.push_back(Clock::now());
+}
+
+void RegionTimer::End(const char *name)
+{
+   const Clock::time_point stop = Clock::now();
+   ThreadRegions &t = ThisThread();
+   // Ignore the ends of regions started before the timers were enabled
+   if (t.stack.size() <= 1) { return; }
+   RegionNode &node = t.nodes[t.stack.back()];
+   MFEM_ASSERT(name == nullptr || node.name == name,
+               "region '" << name << "' ended inside region '" << node.name
+               << "'");
+   const double duration =
+      std::chrono::duration<double>(stop - t.starts.back()).count();
+   node.count++;
+   node.time += duration;
+   const Registry &reg = GetRegistry();
+   if (reg.trace && long(t.events.size()) < reg.max_events)
+   {
+      const double start =
+         std::chrono::duration<double>(t.starts.back() - reg.epoch).count();
+      t.events.push_back({t.stack.back(), start, duration});
+   }
+   t.stack.pop_back();
+   t.starts.pop_back();
+}
+
+double RegionTimer::GetTime(const std::string &name)
+{
+   Registry &reg = GetRegistry();
+   std::lock_guard<std::mutex> lock(reg.mutex);
+   double time = 0.0;
+   for (const auto &t : reg.threads)
+   {
+      for (const RegionNode &n : t->nodes)
+      {
+         if (n.parent >= 0 && n.name == name) { time += n.time; }
+      }
+   }
+   return time;
+}
+
+long RegionTimer::GetCount(const std::string &name)
+{
+   Registry &reg = GetRegistry();
+   std::lock_guard<std::mutex> lock(reg.mutex);
+   long count = 0;
+   for (const auto &t : reg.threads)
+   {
+      for (const RegionNode &n : t->nodes)
+      {
+         if (n.parent >= 0 && n.name == name) { count += n.count; }
+      }
+   }
+   return count;
+}
+
+void RegionTimer::Reset()
+{
+   Registry &reg = GetRegistry();
+   std::lock_guard<std::mutex> lock(reg.mutex);
+   for (const auto &t : reg.threads) { t->Clear(); }
+}
+
+void RegionTimer::Print(std::ostream &os)
+{
+   const std::vector<FlatRegion> regions = GetRegions(GetRegistry());
+   os << std::left << std::setw(48) << "Region" << std::right
+      << std::setw(10) << "calls" << std::setw(14) << "total (s)"
+      << std::setw(14) << "avg (ms)" << std::setw(9) << "threads" << '\n';
+   for (const FlatRegion &r : regions)
+   {
+      os << std::left << std::setw(48) << (std::string(2*r.depth, ' ') + r.name)
+         << std::right << std::setw(10) << r.count << std::scientific
+         << std::setprecision(4) << std::setw(14) << r.time
+         << std::setw(14) << 1e3*r.time/std::max(r.count, 1L)
+         << std::defaultfloat << std::setw(9) << r.num_threads << '\n';
+   }
+   os << std::flush;
+}
+
+void RegionTimer::PrintJSON(std::ostream &os)
+{
+   mfem::PrintJSON(GetRegistry(), os);
+}
+
+void RegionTimer::PrintChromeTrace(std::ostream &os)
+{
+   mfem::PrintChromeTrace(GetRegistry(), os);
+}
+
+#ifdef MFEM_USE_MPI
+namespace
+{
+
+/// The regions of rank 0 with the time (min, max, sum) and the calls (sum) of
+/// each region over the ranks of @a comm, valid on rank 0.
+void ReduceRegions(MPI_Comm comm, std::vector<FlatRegion> &regions,
+                   std::vector<double> &tmin, std::vector<double> &tmax,
+                   std::vector<double> &tsum, std::vector<double> &calls)
+{
+   int rank;
+   MPI_Comm_rank(comm, &rank);
+   std::vector<FlatRegion> local = GetRegions(GetRegistry());
+
+   // Broadcast the region paths of rank 0
+   std::string structure;
+   if (rank == 0)
+   {
+      for (const FlatRegion &r : local) { structure += r.path + '\n'; }
+   }
+   int length = int(structure.size());
+   MPI_Bcast(&length, 1, MPI_INT, 0, comm);
+   structure.resize(length);
+   MPI_Bcast(&structure[0], length, MPI_CHAR, 0, comm);
+
+   std::map<std::string, const FlatRegion*> by_path;
+   for (const FlatRegion &r : local) { by_path[r.path] = &r; }
+   std::vector<std::string> paths;
+   std::istringstream is(structure);
+   for (std::string path; std::getline(is, path); ) { paths.push_back(path); }
+
+   const int n = int(paths.size());
+   std::vector<double> time(n, 0.0), count(n, 0.0);
+   for (int i = 0; i < n; i++)
+   {
+      const auto it = by_path.find(paths[i]);
+      if (it == by_path.end()) { continue; }
+      time[i] = it->second->time;
+      count[i] = double(it->second->count);
+   }
+   tmin.resize(n); tmax.resize(n); tsum.resize(n); calls.resize(n);
+   MPI_Reduce(time.data(), tmin.data(), n, MPI_DOUBLE, MPI_MIN, 0, comm);
+   MPI_Reduce(time.data(), tmax.data(), n, MPI_DOUBLE, MPI_MAX, 0, comm);
+   MPI_Reduce(time.data(), tsum.data(), n, MPI_DOUBLE, MPI_SUM, 0, comm);
+   MPI_Reduce(count.data(), calls.data(), n, MPI_DOUBLE, MPI_SUM, 0, comm);
+   regions = std::move(local);
+}
+
+} // anonymous namespace
+
+void RegionTimer::PrintSummary(MPI_Comm comm, std::ostream &os)
+{
+   int rank, size;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &size);
+   std::vector<FlatRegion> regions;
+   std::vector<double> tmin, tmax, tsum, calls;
+   ReduceRegions(comm, regions, tmin, tmax, tsum, calls);
+   if (rank != 0) { return; }
+
+   os << std::left << std::setw(48) << "Region" << std::right
+      << std::setw(12) << "calls" << std::setw(14) << "min (s)"
+      << std::setw(14) << "max (s)" << std::setw(14) << "avg (s)" << '\n';
+   for (int i = 0; i < int(regions.size()); i++)
+   {
+      const FlatRegion &r = regions[i];
+      os << std::left << std::setw(48) << (std::string(2*r.depth, ' ') + r.name)
+         << std::right << std::setw(12) << (long long)(calls[i])
+         << std::scientific << std::setprecision(4)
+         << std::setw(14) << tmin[i] << std::setw(14) << tmax[i]
+         << std::setw(14) << tsum[i]/size << std::defaultfloat << '\n';
+   }
+   os << std::flush;
+}
+
+void RegionTimer::PrintJSON(MPI_Comm comm, std::ostream &os)
+{
+   int rank, size;
+   MPI_Comm_rank(comm, &rank);
+   MPI_Comm_size(comm, &size);
+   std::vector<FlatRegion> regions;
+   std::vector<double> tmin, tmax, tsum, calls;
+   ReduceRegions(comm, regions, tmin, tmax, tsum, calls);
+   if (rank != 0) { return; }
+
+   os << "{\"ranks\": " << size << ", \"regions\": ";
+   PrintNestedJSON(os, regions, [&](int i)
+   {
+      os << "\"name\": " << JSONString(regions[i].name) << ", \"calls\": "
+         << (long long)(calls[i]) << ", \"time_min\": " << tmin[i]
+         << ", \"time_max\": " << tmax[i] << ", \"time_avg\": "
+         << tsum[i]/size;
+   });
+   os << "}\n" << std::flush;
+}
+#endif
+
+} // namespace mfem
@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_REGION_TIMER_HPP
+#define MFEM_REGION_TIMER_HPP
+
+#include "../config/config.hpp"
+#include "globals.hpp"
+
+#include <string>
+
+namespace mfem
+{
+
+/** @brief Built-in, lightweight timers for the regions annotated with the
+    MFEM_PERF_FUNCTION, MFEM_PERF_SCOPE and MFEM_PERF_BEGIN/END macros, used
+    when MFEM is built without Caliper.
+
+    The regions form a tree per thread: a region started while another one is
+    active on the same thread is recorded as its child. For each region the
+    number of calls and the total time are accumulated. The reports merge the
+    trees of all threads by region path, and in parallel PrintSummary() and
+    PrintJSON(MPI_Comm, ...) aggregate them over the MPI ranks (min/max/avg).
+    Optionally, every region instance can be recorded as an event and written
+    in the Chrome trace format (chrome://tracing, https://ui.perfetto.dev).
+
+    The timers are disabled by default, in which case an annotated region costs
+    a single branch. They can be enabled with Enable() or with the environment
+    variable MFEM_REGION_TIMERS set to a value other than 'NO'. If the value is
+    neither 'YES' nor '1', it is used as a file name to which the JSON report is
+    written at exit. Similarly, the environment variable MFEM_REGION_TRACE can
+    be set to a file name that enables the trace recording and to which the
+    Chrome trace is written at exit. In parallel, the MPI rank is appended to
+    these file names.
+
+    @note The methods that reset or print the timers must not be called while
+    other threads are inside timed regions. */
+class RegionTimer
+{
+   static MFEM_EXPORT bool enabled;
+
+public:
+   /// Enable (or disable) the region timers.
+   static void Enable(bool enable = true) { enabled = enable; }
+   /// Disable the region timers.
+   static void Disable() { enabled = false; }
+   /// Return true if the region timers are enabled.
+   static bool IsEnabled() { return enabled; }
+
+   /** @brief Enable (or disable) the recording of every region instance for
+       PrintChromeTrace(). At most @a max_events are recorded per thread. */
+   static void EnableTrace(bool enable = true, long max_events = 1000000);
+
+   /// Start the region @a name, nested in the active region of the thread.
+   static void Begin(const char *name);
+   /// End the active region of the thread, @a name is only used for checks.
+   static void End(const char *name = nullptr);
+
+   /// Return the total time in seconds spent in the regions named @a name.
+   static double GetTime(const std::string &name);
+   /// Return the number of calls of the regions named @a name.
+   static long GetCount(const std::string &name);
+
+   /// Discard all the timings and trace events.
+   static void Reset();
+
+   /// Print the region tree of this process with calls and times.
+   static void Print(std::ostream &os = mfem::out);
+   /// Print the region tree of this process in JSON format.
+   static void PrintJSON(std::ostream &os);
+   /// Print the recorded region instances in the Chrome trace JSON format.
+   static void PrintChromeTrace(std::ostream &os);
+
+#ifdef MFEM_USE_MPI
+   /** @brief Print, on rank 0, the minimum, maximum and average over the ranks
+       of @a comm of the time of each region. The region tree is taken from
+       rank 0. This method is collective on @a comm. */
+   static void PrintSummary(MPI_Comm comm, std::ostream &os = mfem::out);
+   /// Same as PrintSummary(), in JSON format.
+   static void PrintJSON(MPI_Comm comm, std::ostream &os);
+#endif
+};
+
+/// Time the enclosing scope with RegionTimer, if enabled at construction.
+class RegionTimerScope
+{
+   const bool active;
+
+public:
+   explicit RegionTimerScope(const char *name)
+      : active(RegionTimer::IsEnabled())
+   {
+      if (active) { RegionTimer::Begin(name); }
+   }
+
+   explicit RegionTimerScope(const std::string &name)
+      : RegionTimerScope(name.c_str()) { }
+
+   ~RegionTimerScope() { if (active) { RegionTimer::End(); } }
+
+   RegionTimerScope(const RegionTimerScope &) = delete;
+   RegionTimerScope &operator=(const RegionTimerScope &) = delete;
+};
+
+} // namespace mfem
+
+#endif // MFEM_REGION_TIMER_HPP
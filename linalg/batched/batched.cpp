@@ -11,6 +11,7 @@
 
 #include "batched.hpp"
 #include "native.hpp"
+#include "simd.hpp"
 #include "gpu_blas.hpp"
 #include "magma.hpp"
 
@@ -20,6 +21,7 @@ namespace mfem
 BatchedLinAlg::BatchedLinAlg()
 {
    backends[NATIVE].reset(new NativeBatchedLinAlg);
+   backends[SIMD].reset(new SIMDBatchedLinAlg);
 
    if (Device::Allows(mfem::Backend::CUDA_MASK | mfem::Backend::HIP_MASK))
    {
@@ -41,7 +43,7 @@ BatchedLinAlg::BatchedLinAlg()
    }
    else
    {
-      active_backend = NATIVE;
+      active_backend = SIMD;
    }
 }
 
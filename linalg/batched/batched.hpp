@@ -33,13 +33,17 @@ class BatchedLinAlg
 public:
    /// @brief Available backends for implementations of batched algorithms.
    ///
-   /// The initially active backend will be the first available backend in this
-   /// order: MAGMA, GPU_BLAS, NATIVE.
+   /// When the Device uses CUDA or HIP, the initially active backend will be
+   /// the first available backend in this order: MAGMA, GPU_BLAS, NATIVE.
+   /// Otherwise, it will be SIMD.
    enum Backend
    {
       /// @brief The standard MFEM backend, implemented using mfem::forall
       /// kernels. Not as performant as the other kernels.
       NATIVE,
+      /// @brief CPU backend, vectorized across the batch: each SIMD lane works
+      /// on a different matrix. Always available, see SIMDBatchedLinAlg.
+      SIMD,
       /// @brief Either cuBLAS or hipBLAS, depending on whether MFEM is using
       /// CUDA or HIP. Not available otherwise.
       GPU_BLAS,
@@ -0,0 +1,363 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "simd.hpp"
+#include "../simd.hpp"
+#include "../kernels.hpp"
+#include "../dtensor.hpp"
+#include "../../general/device.hpp"
+
+#include <cmath>
+#include <vector>
+
+namespace mfem
+{
+
+namespace
+{
+
+// Number of matrices processed together, one per SIMD lane. At least 4, so
+// that the generic AutoSIMD loops are also vectorized without MFEM_USE_SIMD.
+constexpr int W = (MFEM_SIMD_BYTES/sizeof(real_t) > 4) ?
+                  int(MFEM_SIMD_BYTES/sizeof(real_t)) : 4;
+
+using simd_t = AutoSIMD<real_t, W, W*sizeof(real_t)>;
+
+#ifdef MFEM_USE_OPENMP
+// The batches are processed by OpenMP threads only when the OpenMP backend is
+// enabled, as in the other host kernels.
+bool UseOpenMP() { return Device::Allows(Backend::OMP_MASK); }
+#endif
+
+// Interleave the blocks [b, b+nb) of size 'size' of the batch 'A' (with block
+// stride 'stride') into 'a'. The unused lanes are set to zero.
+void Gather(const real_t *A, int size, int stride, int b, int nb, simd_t *a)
+{
+   const real_t *A_b = A + b*stride;
+   if (nb == W)
+   {
+      for (int i = 0; i < size; i++)
+      {
+         MFEM_VECTORIZE_LOOP
+         for (int l = 0; l < W; l++) { a[i][l] = A_b[i + l*stride]; }
+      }
+      return;
+   }
+   for (int i = 0; i < size; i++)
+   {
+      a[i] = 0.0;
+      for (int l = 0; l < nb; l++) { a[i][l] = A_b[i + l*stride]; }
+   }
+}
+
+// Inverse of Gather(), y <- alpha a + beta y for the used lanes.
+void Scatter(const simd_t *a, int size, int stride, int b, int nb, real_t *A,
+             real_t alpha = 1.0, real_t beta = 0.0)
+{
+   real_t *A_b = A + b*stride;
+   for (int i = 0; i < size; i++)
+   {
+      if (beta == 0.0)
+      {
+         for (int l = 0; l < nb; l++) { A_b[i + l*stride] = alpha*a[i][l]; }
+      }
+      else
+      {
+         for (int l = 0; l < nb; l++)
+         {
+            A_b[i + l*stride] = alpha*a[i][l] + beta*A_b[i + l*stride];
+         }
+      }
+   }
+}
+
+// Set the matrices of the unused lanes to the identity.
+void PadIdentity(simd_t *a, int m, int nb)
+{
+   for (int l = nb; l < W; l++)
+   {
+      for (int i = 0; i < m; i++) { a[i + i*m][l] = 1.0; }
+   }
+}
+
+// LU factorization with partial pivoting of the interleaved m x m matrices,
+// same algorithm as kernels::LUFactor(). The 0-based pivot of column k in lane
+// l is stored in piv[l + k*W]. Return false if a pivot of a used lane is zero.
+bool Factor(simd_t *a, int m, int nb, int *piv)
+{
+   bool ok = true;
+   for (int k = 0; k < m; k++)
+   {
+      // the pivots differ between the lanes, search and swap lane by lane
+      for (int l = 0; l < W; l++)
+      {
+         int p = k;
+         real_t a_max = std::abs(a[k + k*m][l]);
+         for (int i = k+1; i < m; i++)
+         {
+            const real_t a_ik = std::abs(a[i + k*m][l]);
+            if (a_ik > a_max)
+            {
+               a_max = a_ik;
+               p = i;
+            }
+         }
+         piv[l + k*W] = p;
+         if (p != k)
+         {
+            for (int j = 0; j < m; j++)
+            {
+               std::swap(a[k + j*m][l], a[p + j*m][l]);
+            }
+         }
+         if (l < nb && a_max == 0.0) { ok = false; }
+      }
+
+      simd_t a_kk_inv;
+      a_kk_inv = 1.0;
+      a_kk_inv /= a[k + k*m];
+      for (int i = k+1; i < m; i++) { a[i + k*m] *= a_kk_inv; }
+
+      for (int j = k+1; j < m; j++)
+      {
+         const simd_t a_kj = a[k + j*m];
+         for (int i = k+1; i < m; i++) { a[i + j*m] -= a[i + k*m]*a_kj; }
+      }
+   }
+   return ok;
+}
+
+// Solve with the LU factors and pivots computed by Factor(), same algorithm as
+// kernels::LUSolve().
+void Solve(const simd_t *a, int m, const int *piv, simd_t *x)
+{
+   // x <- P x
+   for (int i = 0; i < m; i++)
+   {
+      for (int l = 0; l < W; l++)
+      {
+         std::swap(x[i][l], x[piv[l + i*W]][l]);
+      }
+   }
+   // x <- L^{-1} x
+   for (int j = 0; j < m; j++)
+   {
+      const simd_t x_j = x[j];
+      for (int i = j+1; i < m; i++) { x[i] -= a[i + j*m]*x_j; }
+   }
+   // x <- U^{-1} x
+   for (int j = m-1; j >= 0; j--)
+   {
+      x[j] /= a[j + j*m];
+      const simd_t x_j = x[j];
+      for (int i = 0; i < j; i++) { x[i] -= a[i + j*m]*x_j; }
+   }
+}
+
+} // anonymous namespace
+
+void SIMDBatchedLinAlg::AddMult(const DenseTensor &A, const Vector &x,
+                                Vector &y, real_t alpha, real_t beta,
+                                Op op) const
+{
+   const bool tr = (op == Op::T);
+
+   const int m = A.SizeI();
+   const int n = A.SizeJ();
+   const int n_mat = A.SizeK();
+   const int k = x.Size() / (tr ? m : n) / n_mat;
+   const int nx = tr ? m : n, ny = tr ? n : m;
+   const int n_groups = (n_mat + W - 1)/W;
+
+   const real_t *h_A = A.HostRead();
+   const real_t *h_x = x.HostRead();
+   real_t *h_y = (beta == 0.0) ? y.HostWrite() : y.HostReadWrite();
+
+   // With a single right-hand side each entry of A is used once, and the
+   // interleaving of A costs as much as the products, except for tiny matrices
+   if (k == 1 && m*n > 16)
+   {
+#ifdef MFEM_USE_OPENMP
+      #pragma omp parallel for schedule(static) if(UseOpenMP())
+#endif
+      for (int i = 0; i < n_mat; i++)
+      {
+         const real_t *A_i = h_A + i*m*n;
+         if (tr)
+         {
+            kernels::AddMultAtB(m, n, k, A_i, h_x + i*m, h_y + i*n, alpha,
+                                beta);
+         }
+         else
+         {
+            kernels::AddMult(m, k, n, A_i, h_x + i*n, h_y + i*m, alpha, beta);
+         }
+      }
+      return;
+   }
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel if(UseOpenMP())
+#endif
+   {
+      std::vector<simd_t> a(m*n), xv(nx), yv(ny);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (int g = 0; g < n_groups; g++)
+      {
+         const int b = g*W, nb = std::min(W, n_mat - b);
+         Gather(h_A, m*n, m*n, b, nb, a.data());
+         for (int r = 0; r < k; r++)
+         {
+            Gather(h_x + r*nx, nx, nx*k, b, nb, xv.data());
+            if (tr)
+            {
+               for (int j = 0; j < n; j++)
+               {
+                  yv[j] = 0.0;
+                  for (int i = 0; i < m; i++) { yv[j].fma(a[i + j*m], xv[i]); }
+               }
+            }
+            else
+            {
+               for (int i = 0; i < m; i++) { yv[i] = 0.0; }
+               for (int j = 0; j < n; j++)
+               {
+                  for (int i = 0; i < m; i++) { yv[i].fma(a[i + j*m], xv[j]); }
+               }
+            }
+            Scatter(yv.data(), ny, ny*k, b, nb, h_y + r*ny, alpha, beta);
+         }
+      }
+   }
+}
+
+void SIMDBatchedLinAlg::Invert(DenseTensor &A) const
+{
+   const int m = A.SizeI();
+   const int n_mat = A.SizeK();
+   const int n_groups = (n_mat + W - 1)/W;
+   real_t *h_A = A.HostReadWrite();
+   bool ok = true;
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel reduction(&&:ok) if(UseOpenMP())
+#endif
+   {
+      std::vector<simd_t> a(m*m), inv(m*m);
+      std::vector<int> piv(m*W);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (int g = 0; g < n_groups; g++)
+      {
+         const int b = g*W, nb = std::min(W, n_mat - b);
+         Gather(h_A, m*m, m*m, b, nb, a.data());
+         PadIdentity(a.data(), m, nb);
+         ok = Factor(a.data(), m, nb, piv.data()) && ok;
+
+         // solve for the columns of the identity
+         for (int j = 0; j < m; j++)
+         {
+            simd_t *x = &inv[j*m];
+            for (int i = 0; i < m; i++) { x[i] = (i == j) ? 1.0 : 0.0; }
+            Solve(a.data(), m, piv.data(), x);
+         }
+         Scatter(inv.data(), m*m, m*m, b, nb, h_A);
+      }
+   }
+
+   MFEM_VERIFY(ok, "Batch LU factorization failed");
+}
+
+void SIMDBatchedLinAlg::LUFactor(DenseTensor &A, Array<int> &P) const
+{
+   const int m = A.SizeI();
+   const int n_mat = A.SizeK();
+   const int n_groups = (n_mat + W - 1)/W;
+   P.SetSize(m*n_mat);
+
+   real_t *h_A = A.HostReadWrite();
+   int *h_P = P.HostWrite();
+   bool ok = true;
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel reduction(&&:ok) if(UseOpenMP())
+#endif
+   {
+      std::vector<simd_t> a(m*m);
+      std::vector<int> piv(m*W);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (int g = 0; g < n_groups; g++)
+      {
+         const int b = g*W, nb = std::min(W, n_mat - b);
+         Gather(h_A, m*m, m*m, b, nb, a.data());
+         PadIdentity(a.data(), m, nb);
+         ok = Factor(a.data(), m, nb, piv.data()) && ok;
+         Scatter(a.data(), m*m, m*m, b, nb, h_A);
+         for (int l = 0; l < nb; l++)
+         {
+            // pivots use 1-based indexing, as in the other backends
+            for (int i = 0; i < m; i++) { h_P[i + (b+l)*m] = piv[l + i*W] + 1; }
+         }
+      }
+   }
+
+   MFEM_VERIFY(ok, "Batch LU factorization failed");
+}
+
+void SIMDBatchedLinAlg::LUSolve(const DenseTensor &LU, const Array<int> &P,
+                                Vector &x) const
+{
+   const int m = LU.SizeI();
+   const int n_mat = LU.SizeK();
+   const int n_rhs = x.Size() / m / n_mat;
+   const int n_groups = (n_mat + W - 1)/W;
+
+   const real_t *h_LU = LU.HostRead();
+   const int *h_P = P.HostRead();
+   real_t *h_x = x.HostReadWrite();
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel if(UseOpenMP())
+#endif
+   {
+      std::vector<simd_t> a(m*m), xv(m);
+      std::vector<int> piv(m*W);
+#ifdef MFEM_USE_OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for (int g = 0; g < n_groups; g++)
+      {
+         const int b = g*W, nb = std::min(W, n_mat - b);
+         Gather(h_LU, m*m, m*m, b, nb, a.data());
+         PadIdentity(a.data(), m, nb);
+         for (int l = 0; l < W; l++)
+         {
+            for (int i = 0; i < m; i++)
+            {
+               piv[l + i*W] = (l < nb) ? h_P[i + (b+l)*m] - 1 : i;
+            }
+         }
+         for (int r = 0; r < n_rhs; r++)
+         {
+            Gather(h_x + r*m, m, m*n_rhs, b, nb, xv.data());
+            Solve(a.data(), m, piv.data(), xv.data());
+            Scatter(xv.data(), m, m*n_rhs, b, nb, h_x + r*m);
+         }
+      }
+   }
+}
+
+} // namespace mfem
@@ -0,0 +1,42 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_SIMD_LINALG
+#define MFEM_SIMD_LINALG
+
+#include "batched.hpp"
+
+namespace mfem
+{
+
+/// @brief CPU implementation of the batched linear algebra operations,
+/// vectorized across the batch.
+///
+/// The matrices are processed in groups of SIMD width (at least 4) that are
+/// interleaved, so that each SIMD lane works on a different matrix of the
+/// group, using AutoSIMD. The row exchanges of the LU factorization, which
+/// differ between the matrices, are done lane by lane. The groups are
+/// distributed among the OpenMP threads when MFEM is built with OpenMP and the
+/// Backend::OMP backend is enabled in the Device.
+class SIMDBatchedLinAlg : public BatchedLinAlgBase
+{
+public:
+   void AddMult(const DenseTensor &A, const Vector &x, Vector &y,
+                real_t alpha, real_t beta, Op op) const override;
+   void Invert(DenseTensor &A) const override;
+   void LUFactor(DenseTensor &A, Array<int> &P) const override;
+   void LUSolve(const DenseTensor &LU, const Array<int> &P,
+                Vector &x) const override;
+};
+
+} // namespace mfem
+
+#endif
@@ -2759,6 +2759,25 @@ void HypreParMatrix::PrintCommPkg(std::ostream &os) const
    MPI_Barrier(comm);
 }
 
+MemoryReport HypreParMatrix::GetMemoryReport(const std::string &name) const
+{
+   MemoryReport report(name);
+   if (!A) { return report; }
+   for (hypre_CSRMatrix *csr : {hypre_ParCSRMatrixDiag(A),
+                                hypre_ParCSRMatrixOffd(A)
+                               })
+   {
+      const std::size_t bytes =
+         (hypre_CSRMatrixNumRows(csr) + 1)*sizeof(HYPRE_Int) +
+         hypre_CSRMatrixNumNonzeros(csr)*(sizeof(HYPRE_Int) + sizeof(real_t));
+      if (HypreUsingGPU()) { report.AddBytes(0, bytes); }
+      else { report.AddBytes(bytes); }
+   }
+   report.AddBytes(hypre_CSRMatrixNumCols(hypre_ParCSRMatrixOffd(A))*
+                   sizeof(HYPRE_BigInt));
+   return report;
+}
+
 void HypreParMatrix::PrintHash(std::ostream &os) const
 {
    HashFunction hf;
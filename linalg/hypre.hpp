@@ -989,6 +989,11 @@ public:
        without the need to save the whole matrix. */
    void PrintHash(std::ostream &out) const;
 
+   /** @brief Return a report, with the given @a name, of the memory held by
+       the local diagonal and off-diagonal blocks. */
+   MemoryReport GetMemoryReport(const std::string &name = "HypreParMatrix")
+   const;
+
    /// @brief Return the Frobenius norm of the matrix (or 0 if the underlying
    /// hypre matrix is NULL)
    real_t FNorm() const;
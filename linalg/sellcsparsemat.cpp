@@ -0,0 +1,198 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+// Implementation of class SellCSparseMatrix
+
+#include "sellcsparsemat.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+
+namespace mfem
+{
+
+SellCSparseMatrix::SellCSparseMatrix(const SparseMatrix &A, int C, int sigma_)
+   : Operator(A.Height(), A.Width()),
+     chunk(C),
+     sigma(((sigma_ + C - 1)/C)*C)
+{
+   MFEM_VERIFY(A.Finalized(), "the matrix must be finalized");
+   MFEM_VERIFY(C == 1 || C == 2 || C == 4 || C == 8 || C == 16,
+               "unsupported slice height: " << C);
+   MFEM_VERIFY(sigma_ > 0, "invalid sorting scope: " << sigma_);
+
+   const int *I = A.HostReadI();
+   const int *J = A.HostReadJ();
+   const real_t *V = A.HostReadData();
+   nnz = I[height];
+
+   // Sort the rows by decreasing length within each window of sigma rows
+   perm.SetSize(height);
+   for (int i = 0; i < height; i++) { perm[i] = i; }
+   auto longer = [I](int i, int j) { return I[i+1] - I[i] > I[j+1] - I[j]; };
+   for (int w = 0; w < height; w += sigma)
+   {
+      std::stable_sort(perm.GetData() + w,
+                       perm.GetData() + std::min(w + sigma, height), longer);
+   }
+
+   const int num_slices = (height + C - 1)/C;
+   slice_ptr.SetSize(num_slices + 1);
+   slice_len.SetSize(num_slices);
+   slice_ptr[0] = 0;
+   for (int s = 0; s < num_slices; s++)
+   {
+      int len = 0;
+      for (int k = s*C; k < std::min((s + 1)*C, height); k++)
+      {
+         len = std::max(len, I[perm[k]+1] - I[perm[k]]);
+      }
+      slice_len[s] = len;
+      slice_ptr[s+1] = slice_ptr[s] + C*len;
+   }
+
+   // The padding entries are zeros in the last column of their row (or in
+   // column 0 for empty rows and for the rows past the end of the matrix).
+   col.SetSize(slice_ptr[num_slices]);
+   val.SetSize(slice_ptr[num_slices]);
+   col = 0;
+   val = 0.0;
+   for (int s = 0; s < num_slices; s++)
+   {
+      for (int r = 0; r < C && s*C + r < height; r++)
+      {
+         const int i = perm[s*C + r];
+         for (int k = 0; k < slice_len[s]; k++)
+         {
+            const int pos = slice_ptr[s] + k*C + r;
+            const int j = I[i] + k;
+            if (j < I[i+1])
+            {
+               col[pos] = J[j];
+               val(pos) = V[j];
+            }
+            else if (k > 0)
+            {
+               col[pos] = col[pos - C];
+            }
+         }
+      }
+   }
+}
+
+template <int C>
+void SellCSparseMatrix::AddMult_(const Vector &x, Vector &y,
+                                 const real_t a) const
+{
+   using simd_t = AutoSIMD<real_t, C, C*sizeof(real_t)>;
+
+   const int num_slices = slice_len.Size();
+   const int n = height;
+   const int *h_perm = perm.HostRead();
+   const int *h_ptr = slice_ptr.HostRead();
+   const int *h_len = slice_len.HostRead();
+   const int *h_col = col.HostRead();
+   const real_t *h_val = val.HostRead();
+   const real_t *xp = x.HostRead();
+   real_t *yp = y.HostReadWrite();
+
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for schedule(static)
+#endif
+   for (int s = 0; s < num_slices; s++)
+   {
+      const int *s_col = h_col + h_ptr[s];
+      const real_t *s_val = h_val + h_ptr[s];
+      simd_t sum, xv, av;
+      sum = 0.0;
+      for (int j = 0; j < h_len[s]; j++)
+      {
+         for (int r = 0; r < C; r++)
+         {
+            av[r] = s_val[j*C + r];
+            xv[r] = xp[s_col[j*C + r]];
+         }
+         sum.fma(av, xv);
+      }
+      const int nr = std::min(C, n - s*C);
+      for (int r = 0; r < nr; r++)
+      {
+         yp[h_perm[s*C + r]] += a*sum[r];
+      }
+   }
+}
+
+void SellCSparseMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void SellCSparseMatrix::AddMult(const Vector &x, Vector &y,
+                                const real_t a) const
+{
+   MFEM_ASSERT(width == x.Size(), "Input vector size (" << x.Size()
+               << ") must match matrix width (" << width << ")");
+   MFEM_ASSERT(height == y.Size(), "Output vector size (" << y.Size()
+               << ") must match matrix height (" << height << ")");
+
+   switch (chunk)
+   {
+      case 1: AddMult_<1>(x, y, a); break;
+      case 2: AddMult_<2>(x, y, a); break;
+      case 4: AddMult_<4>(x, y, a); break;
+      case 8: AddMult_<8>(x, y, a); break;
+      case 16: AddMult_<16>(x, y, a); break;
+      default: MFEM_ABORT("unsupported slice height: " << chunk);
+   }
+}
+
+void SellCSparseMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void SellCSparseMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                         const real_t a) const
+{
+   MFEM_ASSERT(height == x.Size(), "Input vector size (" << x.Size()
+               << ") must match matrix height (" << height << ")");
+   MFEM_ASSERT(width == y.Size(), "Output vector size (" << y.Size()
+               << ") must match matrix width (" << width << ")");
+
+   const int C = chunk;
+   const int num_slices = slice_len.Size();
+   const int *h_perm = perm.HostRead();
+   const int *h_ptr = slice_ptr.HostRead();
+   const int *h_len = slice_len.HostRead();
+   const int *h_col = col.HostRead();
+   const real_t *h_val = val.HostRead();
+   const real_t *xp = x.HostRead();
+   real_t *yp = y.HostReadWrite();
+
+   // The padding entries are zeros, so they can be processed as well
+   for (int s = 0; s < num_slices; s++)
+   {
+      const int nr = std::min(C, height - s*C);
+      for (int j = 0; j < h_len[s]; j++)
+      {
+         const int *s_col = h_col + h_ptr[s] + j*C;
+         const real_t *s_val = h_val + h_ptr[s] + j*C;
+         for (int r = 0; r < nr; r++)
+         {
+            yp[s_col[r]] += s_val[r]*(a*xp[h_perm[s*C + r]]);
+         }
+      }
+   }
+}
+
+} // namespace mfem
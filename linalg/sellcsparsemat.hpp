@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_SELLC_SPARSEMAT
+#define MFEM_SELLC_SPARSEMAT
+
+#include "../config/config.hpp"
+#include "../general/array.hpp"
+#include "operator.hpp"
+#include "sparsemat.hpp"
+
+namespace mfem
+{
+
+/** @brief Sparse matrix stored in the sliced ELLPACK (SELL-C-sigma) format,
+    optimized for the matrix-vector product on CPUs.
+
+    The rows of the matrix are grouped in slices (chunks) of C consecutive
+    rows; each slice is stored in column-major order and padded with zeros to
+    the length of its longest row, so that the products for the C rows of a
+    slice can be computed with SIMD instructions. To reduce the padding, before
+    slicing, the rows within each window of sigma consecutive rows are sorted
+    by decreasing length; sigma is a multiple of C and sigma = C is equivalent
+    to no sorting.
+
+    The format is well suited for matrices with nearly uniform row lengths,
+    like the ones from high-order H1 discretizations. The object is a
+    read-only copy of a finalized SparseMatrix and it operates on host memory.
+    Only Mult() and AddMult() use OpenMP threads, when available. */
+class SellCSparseMatrix : public Operator
+{
+protected:
+   int chunk;   ///< The slice height, C
+   int sigma;   ///< The size of the row sorting windows
+   int nnz;     ///< Number of nonzero entries (without the padding)
+
+   /// The row permutation: slice row k corresponds to the matrix row perm[k].
+   Array<int> perm;
+   /// Offsets of the slices in #col and #val, size: number of slices + 1.
+   Array<int> slice_ptr;
+   /// Length (number of stored columns) of each slice.
+   Array<int> slice_len;
+   /// The column indices and values of the slices, padding included.
+   Array<int> col;
+   Vector val;
+
+   template <int C>
+   void AddMult_(const Vector &x, Vector &y, const real_t a) const;
+
+public:
+   /// Default slice height: a multiple of the SIMD width, see simd.hpp.
+   static constexpr int DEFAULT_CHUNK = 8;
+   /// Default size of the row sorting windows.
+   static constexpr int DEFAULT_SIGMA = 256;
+
+   /** @brief Construct a copy of the finalized matrix @a A in SELL-C-sigma
+       format with slices of @a C rows and sorting windows of @a sigma rows.
+
+       The value of @a sigma is rounded up to a multiple of @a C. */
+   SellCSparseMatrix(const SparseMatrix &A, int C = DEFAULT_CHUNK,
+                     int sigma = DEFAULT_SIGMA);
+
+   /// Return the slice height C.
+   int GetChunkSize() const { return chunk; }
+
+   /// Return the size of the row sorting windows, sigma.
+   int GetSortingScope() const { return sigma; }
+
+   /// Return the number of nonzero entries of the original matrix.
+   int NumNonZeroElems() const { return nnz; }
+
+   /// Return the number of stored entries, including the zero padding.
+   int NumStoredElems() const { return col.Size(); }
+
+   /// Matrix vector multiplication: y = A x.
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// y += a * A x
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   /// Multiply the transpose of the matrix by a vector: y = A^T x.
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   /// y += a * A^T x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+} // namespace mfem
+
+#endif // MFEM_SELLC_SPARSEMAT
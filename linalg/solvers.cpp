@@ -668,6 +668,7 @@ void SLISolver::UpdateVectors()
 
 void SLISolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("SLISolver::Mult");
    const bool zero_b = (b.Size() == 0);
    int i;
 
@@ -754,6 +755,7 @@ void SLISolver::Mult(const Vector &b, Vector &x) const
    final_iter = max_iter;
    for (i = 1; true; )
    {
+      MFEM_PERF_SCOPE("SLISolver::Iteration");
       if (prec)
       {
          if (!zero_b) { x += z; }  // x = x + B (b - A x)
@@ -868,6 +870,7 @@ void CGSolver::UpdateVectors()
 
 void CGSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("CGSolver::Mult");
    int i;
    real_t r0, den, nom, nom0, betanom, alpha, beta;
 
@@ -953,6 +956,7 @@ void CGSolver::Mult(const Vector &b, Vector &x) const
    final_iter = max_iter;
    for (i = 1; true; )
    {
+      MFEM_PERF_SCOPE("CGSolver::Iteration");
       alpha = nom/den;
       add(x,  alpha, d, x);     //  x = x + alpha d
       add(r, -alpha, z, r);     //  r = r - alpha A d
@@ -1081,6 +1085,204 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
 }
 
 
+void PipelinedCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &u, &w, &m, &n, &p, &s, &q, &z})
+   {
+      v->SetSize(width, mt);
+      v->UseDevice(true);
+   }
+}
+
+void PipelinedCGSolver::StartDots() const
+{
+#ifdef MFEM_USE_MPI
+   const MPI_Comm comm = GetComm();
+   if (!dot_oper && comm != MPI_COMM_NULL)
+   {
+      dots[0] = r * u;
+      dots[1] = w * u;
+      MPI_Iallreduce(MPI_IN_PLACE, dots, 2, MPITypeMap<real_t>::mpi_type,
+                     MPI_SUM, comm, &dots_request);
+      return;
+   }
+#endif
+   dots[0] = Dot(r, u);
+   dots[1] = Dot(w, u);
+}
+
+void PipelinedCGSolver::FinishDots() const
+{
+#ifdef MFEM_USE_MPI
+   if (dots_request != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&dots_request, MPI_STATUS_IGNORE);
+   }
+#endif
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_PERF_SCOPE("PipelinedCGSolver::Mult");
+   real_t r0 = 0.0, nom0 = 0.0, nom = 0.0, nom_old = 0.0, den;
+   real_t alpha = 0.0, beta;
+
+   x.UseDevice(true);
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
+   }
+   else
+   {
+      r = b;
+      x = 0.0;
+   }
+
+   if (prec)
+   {
+      prec->Mult(r, u); // u = B r
+   }
+   else
+   {
+      u = r;
+   }
+   oper->Mult(u, w);    // w = A u
+
+   converged = false;
+   final_iter = max_iter;
+   for (int i = 0; true; i++)
+   {
+      // Overlap the global reduction with the preconditioner and the operator
+      StartDots();
+      if (prec)
+      {
+         prec->Mult(w, m); // m = B w
+      }
+      else
+      {
+         m = w;
+      }
+      oper->Mult(m, n);    // n = A m
+      FinishDots();
+
+      nom = dots[0];       // (B r, r)
+      den = dots[1];       // (A u, u)
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      if (i == 0)
+      {
+         nom0 = nom;
+         if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+         if (print_options.iterations || print_options.first_and_last)
+         {
+            mfem::out << "   Iteration : " << setw(3) << 0 << "  (B r, r) = "
+                      << nom << (print_options.first_and_last ? " ...\n" : "\n");
+         }
+      }
+      else if (print_options.iterations)
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << nom << std::endl;
+      }
+
+      if (nom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The preconditioner is not positive "
+                      "definite. (Br, r) = " << nom << '\n';
+         }
+         converged = false;
+         final_iter = i;
+         if (i == 0)
+         {
+            initial_norm = nom;
+            final_norm = nom;
+
+            Monitor(0, nom, r, x, true);
+            return;
+         }
+         break;
+      }
+
+      if (i == 0) { r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol); }
+      if (Monitor(i, nom, r, x) || nom <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      beta = (i > 0) ? nom/nom_old : 0.0;
+      if (i > 0) { den -= beta*nom/alpha; } // den = (A p, p)
+      MFEM_VERIFY(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PipelinedCG: The operator is not positive definite. "
+                      "(Ap, p) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      alpha = nom/den;
+
+      if (i == 0)
+      {
+         z = n;
+         q = m;
+         s = w;
+         p = u;
+      }
+      else
+      {
+         add(n, beta, z, z);   //  z = n + beta z
+         add(m, beta, q, q);   //  q = m + beta q
+         add(w, beta, s, s);   //  s = w + beta s
+         add(u, beta, p, p);   //  p = u + beta p
+      }
+      x.Add(alpha, p);         //  x = x + alpha p
+      r.Add(-alpha, s);        //  r = r - alpha A p
+      u.Add(-alpha, q);        //  u = u - alpha B A p
+      w.Add(-alpha, z);        //  w = w - alpha A B A p
+      nom_old = nom;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PipelinedCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.summary || print_options.iterations ||
+       print_options.first_and_last)
+   {
+      const auto arf = pow (nom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PipelinedCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(nom);
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
 inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
                                   real_t &cs, real_t &sn)
 {
@@ -1133,6 +1335,7 @@ inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
 
 void GMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("GMRESSolver::Mult");
    // Generalized Minimum Residual method following the algorithm
    // on p. 20 of the SIAM Templates book.
 
@@ -1342,6 +1545,7 @@ finish:
 
 void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("FGMRESSolver::Mult");
    DenseMatrix H(m+1,m);
    Vector s(m+1), cs(m+1), sn(m+1);
    Vector r(b.Size()), x_monitor;
@@ -1550,6 +1754,376 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
 }
 
 
+void SStepGMRESSolver::BlockDot(const Array<Vector*> &X, int x0, int nx,
+                                const Array<Vector*> &Y, int y0, int ny,
+                                DenseMatrix &G) const
+{
+   MFEM_PERF_SCOPE("SStepGMRESSolver::BlockDot");
+   G.SetSize(nx, ny);
+   if (dot_oper)
+   {
+      for (int j = 0; j < ny; j++)
+      {
+         for (int i = 0; i < nx; i++)
+         {
+            G(i,j) = Dot(*X[x0+i], *Y[y0+j]);
+         }
+      }
+      return;
+   }
+   for (int j = 0; j < ny; j++)
+   {
+      for (int i = 0; i < nx; i++)
+      {
+         G(i,j) = (*X[x0+i]) * (*Y[y0+j]);
+      }
+   }
+#ifdef MFEM_USE_MPI
+   const MPI_Comm comm = GetComm();
+   if (comm != MPI_COMM_NULL)
+   {
+      MPI_Allreduce(MPI_IN_PLACE, G.Data(), nx*ny,
+                    MPITypeMap<real_t>::mpi_type, MPI_SUM, comm);
+   }
+#endif
+}
+
+// Cholesky factorization, G = L L^t, of the symmetric positive semi-definite
+// matrix G, overwriting the lower triangular part of G with L. Returns the
+// number of leading columns that were factored: the factorization stops at
+// the first pivot that is not larger than tol times the corresponding diagonal
+// entry of G.
+static int CholQRFactor(DenseMatrix &G, real_t tol)
+{
+   const int n = G.Height();
+   for (int j = 0; j < n; j++)
+   {
+      real_t a = G(j,j);
+      for (int k = 0; k < j; k++) { a -= G(j,k)*G(j,k); }
+      if (!(a > tol*G(j,j))) { return j; }
+      G(j,j) = sqrt(a);
+      for (int i = j+1; i < n; i++)
+      {
+         a = G(i,j);
+         for (int k = 0; k < j; k++) { a -= G(i,k)*G(j,k); }
+         G(i,j) = a/G(j,j);
+      }
+   }
+   return n;
+}
+
+void SStepGMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   MFEM_PERF_SCOPE("SStepGMRESSolver::Mult");
+   MFEM_VERIFY(m > 0 && s > 0, "invalid parameters: m = " << m << ", s = " << s);
+
+   // Thresholds for the reorthogonalization and for the rank detection. A
+   // block vector is reorthogonalized when the projection removes more than
+   // half of its squared norm ("twice is enough" criterion).
+   const real_t reorth_tol = 0.5, rank_tol = 1e-12;
+
+   int n = width;
+
+   DenseMatrix H(m+1, m), Hrot(m+1, m), G, Gw, Vc, Y;
+   Vector g(m+1), cs(m+1), sn(m+1);
+   Vector r(n), w(n), x_monitor;
+   Array<Vector *> v;
+
+   b.UseDevice(true);
+   x.UseDevice(true);
+   r.UseDevice(true);
+   w.UseDevice(true);
+
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(n);
+      x_monitor.UseDevice(true);
+   }
+   else
+   {
+      x_monitor.MakeRef(x, 0, n);
+   }
+
+   int i, j, k;
+   real_t sigma = 1.0; // scaling of the monomial basis
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+   }
+   else
+   {
+      x = 0.0;
+   }
+
+   if (prec)
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         prec->Mult(b, r);
+      }
+   }
+   else
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, r);
+      }
+      else
+      {
+         r = b;
+      }
+   }
+   real_t beta = initial_norm = Norm(r);  // beta = ||r||
+   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+
+   final_norm = std::max(rel_tol*beta, abs_tol);
+
+   if (Monitor(0, beta, r, x) || beta <= final_norm)
+   {
+      final_norm = beta;
+      final_iter = 0;
+      converged = true;
+      j = 0;
+      goto finish;
+   }
+
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << 1
+                << "   Iteration : " << setw(3) << 0
+                << "  ||B r|| = " << beta
+                << (print_options.first_and_last ? " ...\n" : "\n");
+   }
+
+   v.SetSize(m+1, NULL);
+
+   for (j = 1; j <= max_iter; )
+   {
+      if (v[0] == NULL)
+      {
+         v[0] = new Vector(n);
+         v[0]->UseDevice(true);
+      }
+      v[0]->Set(1.0/beta, r);
+      g = 0.0; g(0) = beta;
+      H = 0.0;
+
+      bool breakdown = false;
+      for (i = 0; i < m && j <= max_iter && !breakdown; )
+      {
+         // Generate the block v[i+1..i+sb] = (M A / sigma)^k v[i], k = 1..sb
+         const int sb = std::min(s, m - i);
+         for (k = 0; k < sb; k++)
+         {
+            if (v[i+1+k] == NULL)
+            {
+               v[i+1+k] = new Vector(n);
+               v[i+1+k]->UseDevice(true);
+            }
+            if (prec)
+            {
+               oper->Mult(*v[i+k], w);
+               prec->Mult(w, *v[i+1+k]);  // v[i+1+k] = M A v[i+k]
+            }
+            else
+            {
+               oper->Mult(*v[i+k], *v[i+1+k]);
+            }
+            *v[i+1+k] *= 1.0/sigma;
+         }
+
+         // Block classical Gram-Schmidt against v[0..i], followed by CholQR.
+         // The coefficients of the block vectors in the orthonormal basis are
+         // accumulated in Vc.
+         Vc.SetSize(i+1+sb, sb);
+         Vc = 0.0;
+         int nk = 0;
+         for (int pass = 0; pass < 2; pass++)
+         {
+            BlockDot(v, 0, i+1+sb, v, i+1, sb, G); // one global reduction
+            Gw.SetSize(sb);
+            bool reorth = false;
+            for (int c = 0; c < sb; c++)
+            {
+               for (int l = 0; l <= i; l++)
+               {
+                  v[i+1+c]->Add(-G(l,c), *v[l]);
+                  Vc(l,c) += G(l,c);
+               }
+               for (int d = 0; d < sb; d++)
+               {
+                  real_t gw = G(i+1+d,c);
+                  for (int l = 0; l <= i; l++) { gw -= G(l,d)*G(l,c); }
+                  Gw(d,c) = gw;
+               }
+               reorth = reorth || (Gw(c,c) < reorth_tol*G(i+1+c,c));
+            }
+            if (pass == 0 && reorth) { continue; }
+            nk = CholQRFactor(Gw, rank_tol);
+            if (pass == 0 && nk < sb) { continue; }
+            break;
+         }
+         for (int c = 0; c < nk; c++)
+         {
+            for (int l = 0; l < c; l++)
+            {
+               v[i+1+c]->Add(-Gw(c,l), *v[i+1+l]);
+               Vc(i+1+l,c) = Gw(c,l);
+            }
+            *v[i+1+c] *= 1.0/Gw(c,c);
+            Vc(i+1+c,c) = Gw(c,c);
+         }
+         // In case of (numerical) rank deficiency, only the first nk vectors
+         // of the block are used; if nk = 0, M A v[i] is in the span of
+         // v[0..i] and the next column of H has a zero subdiagonal entry.
+         breakdown = (nk < sb);
+         const int nb = std::max(nk, 1);
+
+         // Change of basis: M A [v[i], block] = sigma [block], where the block
+         // vectors are given by their coefficients Vc in the basis v[0..i+nb].
+         // Solve for the new columns of the Hessenberg matrix, H(:,i..i+nb-1).
+         auto Bc = [&](int row, int c)
+         {
+            return (c == 0) ? real_t(row == i) : Vc(row, c-1);
+         };
+         Y.SetSize(i+1+nb, nb);
+         for (int c = 0; c < nb; c++)
+         {
+            for (int row = 0; row < i+1+nb; row++)
+            {
+               real_t y = sigma*Vc(row,c);
+               for (int l = std::max(row-1, 0); l < i; l++)
+               {
+                  y -= H(row,l)*Bc(l,c);
+               }
+               Y(row,c) = y;
+            }
+            for (int d = 0; d < c; d++)
+            {
+               for (int row = 0; row < i+1+nb; row++)
+               {
+                  Y(row,c) -= H(row,i+d)*Bc(i+d,c);
+               }
+            }
+            for (int row = 0; row <= std::min(i+c+1, m); row++)
+            {
+               H(row,i+c) = Y(row,c)/Bc(i+c,c);
+            }
+            if (c == nb-1 && nk == 0) { H(i+1,i) = 0.0; }
+         }
+         for (int c = 0; c < nb; c++)
+         {
+            real_t col_norm = 0.0;
+            for (int row = 0; row <= i+c+1; row++)
+            {
+               col_norm += H(row,i+c)*H(row,i+c);
+            }
+            sigma = (c == 0) ? sqrt(col_norm) : std::max(sigma, sqrt(col_norm));
+         }
+         if (!(sigma > 0.0)) { sigma = 1.0; }
+
+         // Apply the Givens rotations to the new columns
+         for (int c = 0; c < nb && j <= max_iter; c++, i++, j++)
+         {
+            for (int row = 0; row <= i+1; row++) { Hrot(row,i) = H(row,i); }
+            for (k = 0; k < i; k++)
+            {
+               ApplyPlaneRotation(Hrot(k,i), Hrot(k+1,i), cs(k), sn(k));
+            }
+
+            GeneratePlaneRotation(Hrot(i,i), Hrot(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(Hrot(i,i), Hrot(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(g(i), g(i+1), cs(i), sn(i));
+
+            const real_t resid = fabs(g(i+1));
+            MFEM_VERIFY(IsFinite(resid), "resid = " << resid);
+
+            if (ControllerRequiresUpdate())
+            {
+               x_monitor = x;
+               Update(x_monitor, i, Hrot, g, v);
+            }
+
+            if (Monitor(j, resid, r, x_monitor) || resid <= final_norm)
+            {
+               Update(x, i, Hrot, g, v);
+               final_norm = resid;
+               final_iter = j;
+               converged = true;
+               goto finish;
+            }
+
+            if (print_options.iterations)
+            {
+               mfem::out << "   Pass : " << setw(2) << (j-1)/m+1
+                         << "   Iteration : " << setw(3) << j
+                         << "  ||B r|| = " << resid << '\n';
+            }
+         }
+      }
+
+      if (print_options.iterations && j <= max_iter)
+      {
+         mfem::out << "Restarting..." << '\n';
+      }
+
+      Update(x, i-1, Hrot, g, v);
+
+      oper->Mult(x, r);
+      if (prec)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         subtract(b, r, r);
+      }
+      beta = Norm(r);         // beta = ||r||
+      MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+      if (beta <= final_norm)
+      {
+         final_norm = beta;
+         final_iter = j;
+         converged = true;
+         goto finish;
+      }
+   }
+
+   final_norm = beta;
+   final_iter = max_iter;
+   converged = false;
+
+finish:
+   if ((print_options.iterations && converged) || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << (j-1)/m+1
+                << "   Iteration : " << setw(3) << final_iter
+                << "  ||B r|| = " << final_norm << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepGMRES: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepGMRES: No convergence!\n";
+   }
+
+   Monitor(final_iter, final_norm, r, x, true);
+
+   for (i = 0; i < v.Size(); i++)
+   {
+      delete v[i];
+   }
+}
+
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, real_t &tol, real_t atol, int printit)
 {
@@ -1605,6 +2179,7 @@ void BiCGSTABSolver::UpdateVectors()
 
 void BiCGSTABSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("BiCGSTABSolver::Mult");
    // BiConjugate Gradient Stabilized method following the algorithm
    // on p. 27 of the SIAM Templates book.
 
@@ -1649,6 +2224,7 @@ void BiCGSTABSolver::Mult(const Vector &b, Vector &x) const
 
    for (i = 1; i <= max_iter; i++)
    {
+      MFEM_PERF_SCOPE("BiCGSTABSolver::Iteration");
       rho_1 = Dot(rtilde, r);
       if (rho_1 == 0)
       {
@@ -1854,6 +2430,7 @@ void MINRESSolver::SetOperator(const Operator &op)
 
 void MINRESSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("MINRESSolver::Mult");
    // Based on the MINRES algorithm on p. 86, Fig. 6.9 in
    // "Iterative Krylov Methods for Large Linear Systems",
    // by Henk A. van der Vorst, 2003.
@@ -2061,6 +2638,7 @@ void NewtonSolver::SetOperator(const Operator &op)
 
 void NewtonSolver::Mult(const Vector &b, Vector &x) const
 {
+   MFEM_PERF_SCOPE("NewtonSolver::Mult");
    MFEM_VERIFY(oper != NULL, "the Operator is not set (use SetOperator).");
    MFEM_VERIFY(prec != NULL, "the Solver is not set (use SetSolver).");
 
@@ -656,6 +656,53 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
          real_t RTOLERANCE = 1e-12, real_t ATOLERANCE = 1e-24);
 
 
+/** @brief Pipelined conjugate gradient method (Ghysels and Vanroose, 2014).
+
+    This variant of the (preconditioned) conjugate gradient method performs a
+    single global reduction per iteration, combining the two inner products of
+    the standard method. In parallel, the reduction is non-blocking and it is
+    overlapped with the application of the preconditioner and the operator.
+
+    Compared to CGSolver, each iteration requires more vector updates and the
+    residual is computed with a recurrence, which can result in a somewhat
+    lower attainable accuracy. The convergence criterion, the reporting and
+    the monitoring are the same as in CGSolver. When a custom inner product is
+    set with SetInnerProduct(), the inner products are computed separately. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, m, n, p, s, q, z;
+
+   void UpdateVectors();
+
+   /// The inner products (r, u) and (w, u) computed by StartDots().
+   mutable real_t dots[2];
+#ifdef MFEM_USE_MPI
+   mutable MPI_Request dots_request = MPI_REQUEST_NULL;
+#endif
+
+   /** @brief Start the computation of the inner products (r, u) and (w, u)
+       with one (non-blocking) global reduction; the result is stored in
+       #dots after the call to FinishDots(). */
+   void StartDots() const;
+   void FinishDots() const;
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the pipelined
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+
 /// GMRES method
 class GMRESSolver : public IterativeSolver
 {
@@ -695,6 +742,54 @@ public:
    void Mult(const Vector &b, Vector &x) const override;
 };
 
+/** @brief s-step (communication-avoiding) GMRES method.
+
+    Each block of @a s Krylov vectors is generated with @a s consecutive
+    applications of the (preconditioned) operator, and orthogonalized against
+    the previous basis vectors and among themselves with block classical
+    Gram-Schmidt followed by a Cholesky QR factorization (CholQR). All the
+    inner products of a block are computed with a single global reduction. A
+    second orthogonalization pass, with one more reduction, is performed when
+    the projection removes more than half of the squared norm of a block
+    vector ("twice is enough" criterion); with the monomial basis this is the
+    case for most blocks, so typically two reductions are used per block of
+    @a s vectors. In comparison, GMRESSolver requires one reduction per Krylov
+    vector.
+
+    The method is mathematically equivalent to GMRESSolver (with left
+    preconditioning) and reports the same residual norm ||B r||. Since the
+    block vectors form a monomial basis of the Krylov space, whose condition
+    number grows quickly with @a s, small values of @a s (the default is 4)
+    are recommended. */
+class SStepGMRESSolver : public IterativeSolver
+{
+protected:
+   int m; // see SetKDim()
+   int s; // see SetStepSize()
+
+   /** @brief Compute G(i,j) = (X[i], Y[j]), 0 <= i < nx, 0 <= j < ny, with a
+       single global reduction (unless a custom inner product is used). */
+   void BlockDot(const Array<Vector*> &X, int x0, int nx,
+                 const Array<Vector*> &Y, int y0, int ny,
+                 DenseMatrix &G) const;
+
+public:
+   SStepGMRESSolver() { m = 48; s = 4; }
+
+#ifdef MFEM_USE_MPI
+   SStepGMRESSolver(MPI_Comm comm_) : IterativeSolver(comm_) { m = 48; s = 4; }
+#endif
+
+   /// Set the number of iteration to perform between restarts, default is 48.
+   void SetKDim(int dim) { m = dim; }
+
+   /// Set the number of Krylov vectors generated per block, default is 4.
+   void SetStepSize(int s_) { s = s_; }
+
+   /// Iterative solution of the linear system using the s-step GMRES method
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 /// GMRES method. (tolerances are squared)
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, real_t &tol, real_t atol, int printit);
@@ -3543,6 +3543,29 @@ void SparseMatrix::PrintCSR2(std::ostream & os) const
    }
 }
 
+MemoryReport SparseMatrix::GetMemoryReport(const std::string &name) const
+{
+   MemoryReport report(name);
+   report.Add(I).Add(J).Add(A);
+   if (Rows)
+   {
+      report.AddBytes(height*sizeof(RowNode*));
+#ifdef MFEM_USE_MEMALLOC
+      report.AddBytes(NodesMem->MemoryUsage());
+#else
+      for (int i = 0; i < height; i++)
+      {
+         for (RowNode *np = Rows[i]; np != NULL; np = np->Prev)
+         {
+            report.AddBytes(sizeof(RowNode));
+         }
+      }
+#endif
+   }
+   if (At) { report.AddChild(At->GetMemoryReport("transpose")); }
+   return report;
+}
+
 void SparseMatrix::PrintInfo(std::ostream &os) const
 {
    const real_t MiB = 1024.*1024;
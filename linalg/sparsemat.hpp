@@ -17,6 +17,7 @@
 #include "../general/backends.hpp"
 #include "../general/mem_alloc.hpp"
 #include "../general/mem_manager.hpp"
+#include "../general/mem_report.hpp"
 #include "../general/device.hpp"
 #include "../general/table.hpp"
 #include "../general/globals.hpp"
@@ -701,6 +702,10 @@ public:
    /// Print various sparse matrix statistics.
    void PrintInfo(std::ostream &out) const;
 
+   /** @brief Return a report, with the given @a name, of the memory held by
+       the CSR or the linked list storage and the cached transpose. */
+   MemoryReport GetMemoryReport(const std::string &name = "SparseMatrix") const;
+
    /// Returns max_{i,j} |(i,j)-(j,i)| for a finalized matrix
    real_t IsSymmetric() const;
 
@@ -55,11 +55,12 @@ void FaceNeighborGeometricFactors::ExchangeFaceNbrQVectors(
 {
 #ifdef MFEM_USE_MPI
 
+   const ParMesh *mesh = dynamic_cast<const ParMesh*>(geom.mesh);
+   if (mesh == nullptr) { return; }
+
    const int nq = geom.IntRule->Size();
    const int ndof_per_el = vdim * nq;
 
-   const ParMesh *mesh = static_cast<const ParMesh*>(geom.mesh);
-
    const int n_face_nbr = mesh->GetNFaceNeighbors();
    if (n_face_nbr == 0) { return; }
 
@@ -42,6 +42,16 @@ public:
    /// Communicate (if needed) to gather the face neighbor geometric factors.
    FaceNeighborGeometricFactors(const GeometricFactors &geom_);
 
+   /// @brief Given a Q-vector @a x_local with @a vdim components, fill the
+   /// face-neighbor Q-vector @a x_shared by communicating with neighboring MPI
+   /// partitions.
+   ///
+   /// The Q-vectors use the quadrature rule of the GeometricFactors. This can
+   /// be used to gather other quadrature data (e.g. coefficient values) of the
+   /// face neighbor elements.
+   void ExchangeFaceNbrQVectors(const Vector &x_local, Vector &x_shared,
+                                const int vdim);
+
 protected:
    const GeometricFactors &geom; ///< The GeometricFactors of the Mesh.
 
@@ -52,12 +62,6 @@ protected:
    Array<int> send_offsets, recv_offsets;
 
    ///@}
-
-   /// @brief Given a Q-vector @a x_local with @a vdim components, fill the
-   /// face-neighbor Q-vector @a x_shared by communicating with neighboring MPI
-   /// partitions.
-   void ExchangeFaceNbrQVectors(const Vector &x_local, Vector &x_shared,
-                                const int vdim);
 };
 
 } // namespace mfem
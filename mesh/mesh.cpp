@@ -14,6 +14,8 @@
 #include "mesh_headers.hpp"
 #include "vtkhdf.hpp"
 #include "../fem/fem.hpp"
+#include "../general/annotation.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/binaryio.hpp"
 #include "../general/text.hpp"
@@ -29,6 +31,7 @@
 #include <fstream>
 #include <limits>
 #include <cmath>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <functional>
@@ -337,6 +340,78 @@ void Mesh::PrintCharacteristics(Vector *Vh, Vector *Vk, std::ostream &os)
    os << '\n' << std::flush;
 }
 
+// Size of the concrete Element object, which stores its vertex indices
+static std::size_t ElementBytes(const Element &el)
+{
+   switch (el.GetType())
+   {
+      case Element::POINT: return sizeof(Point);
+      case Element::SEGMENT: return sizeof(Segment);
+      case Element::TRIANGLE: return sizeof(Triangle);
+      case Element::QUADRILATERAL: return sizeof(Quadrilateral);
+      case Element::TETRAHEDRON: return sizeof(Tetrahedron);
+      case Element::HEXAHEDRON: return sizeof(Hexahedron);
+      case Element::WEDGE: return sizeof(Wedge);
+      case Element::PYRAMID: return sizeof(Pyramid);
+   }
+   return sizeof(Element);
+}
+
+static MemoryReport ElementsMemoryReport(const std::string &name,
+                                         const Array<Element*> &elems)
+{
+   MemoryReport report(name);
+   report.Add(elems.GetMemory());
+   for (const Element *el : elems)
+   {
+      if (el) { report.AddBytes(ElementBytes(*el)); }
+   }
+   return report;
+}
+
+MemoryReport Mesh::GetMemoryReport() const
+{
+   MemoryReport report("Mesh");
+   report.Add("vertices", vertices.GetMemory());
+   report.AddChild(ElementsMemoryReport("elements", elements));
+   report.AddChild(ElementsMemoryReport("boundary", boundary));
+   report.AddChild(ElementsMemoryReport("faces", faces));
+
+   MemoryReport topology("topology");
+   topology.Add(faces_info.GetMemory()).Add(nc_faces_info.GetMemory());
+   topology.Add(be_to_face.GetMemory());
+   topology.Add(attributes.GetMemory()).Add(bdr_attributes.GetMemory());
+   if (el_to_edge) { topology.Add("el_to_edge", *el_to_edge); }
+   if (el_to_face) { topology.Add("el_to_face", *el_to_face); }
+   if (el_to_el) { topology.Add("el_to_el", *el_to_el); }
+   if (bel_to_edge) { topology.Add("bel_to_edge", *bel_to_edge); }
+   if (face_to_elem) { topology.Add("face_to_elem", *face_to_elem); }
+   if (face_edge) { topology.Add("face_edge", *face_edge); }
+   if (edge_vertex) { topology.Add("edge_vertex", *edge_vertex); }
+   report.AddChild(topology);
+
+   if (Nodes && own_nodes)
+   {
+      MemoryReport nodes("nodes");
+      nodes.Add(Nodes->GetMemory());
+      nodes.AddChild(Nodes->FESpace()->GetMemoryReport());
+      report.AddChild(nodes);
+   }
+   if (ncmesh)
+   {
+      report.AddChild(MemoryReport("NCMesh").AddBytes(ncmesh->MemoryUsage()));
+   }
+   for (const GeometricFactors *gf : geom_factors)
+   {
+      report.AddChild(gf->GetMemoryReport());
+   }
+   for (const FaceGeometricFactors *gf : face_geom_factors)
+   {
+      report.AddChild(gf->GetMemoryReport());
+   }
+   return report;
+}
+
 FiniteElement *Mesh::GetTransformationFEforElementType(Element::Type ElemType)
 {
    switch (ElemType)
@@ -2810,6 +2885,51 @@ void Mesh::GetHilbertElementOrdering(Array<int> &ordering)
    }
 }
 
+// Spread the lower 21 bits of x, leaving two zero bits between consecutive
+// bits, as needed by 3D Morton codes
+static std::uint64_t MortonSpread(std::uint64_t x)
+{
+   x &= 0x1fffff;
+   x = (x | x << 32) & 0x1f00000000ffffULL;
+   x = (x | x << 16) & 0x1f0000ff0000ffULL;
+   x = (x | x << 8)  & 0x100f00f00f00f00fULL;
+   x = (x | x << 4)  & 0x10c30c30c30c30c3ULL;
+   x = (x | x << 2)  & 0x1249249249249249ULL;
+   return x;
+}
+
+void Mesh::GetMortonElementOrdering(Array<int> &ordering)
+{
+   MFEM_VERIFY(spaceDim <= 3, "");
+
+   Vector min, max, center;
+   GetBoundingBox(min, max);
+
+   // Morton codes of the element centers, quantized to 21 bits per coordinate
+   std::vector<std::pair<std::uint64_t, int>> codes(GetNE());
+   for (int i = 0; i < GetNE(); i++)
+   {
+      GetElementCenter(i, center);
+      std::uint64_t code = 0;
+      for (int j = 0; j < spaceDim; j++)
+      {
+         const real_t h = max(j) - min(j);
+         real_t t = (h > 0.0) ? (center(j) - min(j))/h : 0.0;
+         t = std::min(std::max(t, real_t(0)), real_t(1));
+         code |= MortonSpread(std::uint64_t(t*0x1fffff)) << j;
+      }
+      codes[i] = std::make_pair(code, i);
+   }
+   std::sort(codes.begin(), codes.end());
+
+   // return ordering in the format required by ReorderElements
+   ordering.SetSize(GetNE());
+   for (int i = 0; i < GetNE(); i++)
+   {
+      ordering[codes[i].second] = i;
+   }
+}
+
 
 void Mesh::ReorderElements(const Array<int> &ordering, bool reorder_vertices)
 {
@@ -4673,6 +4793,18 @@ Mesh Mesh::LoadFromFile(const std::string &filename, int generate_edges,
    return mesh;
 }
 
+Mesh Mesh::LoadFromBinaryFile(const std::string &filename, int refine,
+                              bool fix_orientation)
+{
+   Mesh mesh;
+   BinarySectionReader input(filename);
+   MFEM_VERIFY(input.GetType() == "MFEM binary mesh v1.0",
+               "not a binary mesh file: " << filename);
+   mesh.ReadBinaryMesh(input);
+   mesh.Finalize(refine, fix_orientation);
+   return mesh;
+}
+
 Mesh Mesh::MakeCartesian1D(int n, real_t sx)
 {
    Mesh mesh;
@@ -5011,6 +5143,7 @@ void Mesh::SetMeshGen()
 void Mesh::Loader(std::istream &input, int generate_edges,
                   std::string parse_tag)
 {
+   MFEM_PERF_SCOPE("Mesh::Load");
    int curved = 0, read_gf = 1;
    bool finalize_topo = true;
 
@@ -5127,6 +5260,16 @@ void Mesh::Loader(std::istream &input, int generate_edges,
    {
       ReadNURBSMesh(input, curved, read_gf, true);
    }
+   else if (mesh_type == "MFEM binary mesh v1.0")
+   {
+#ifdef MFEM_USE_MPI
+      MFEM_VERIFY(dynamic_cast<ParMesh*>(this) == NULL,
+                  "the binary mesh format is not supported for ParMesh");
+#endif
+      BinarySectionReader bin_input(input, mesh_type);
+      ReadBinaryMesh(bin_input);
+      return; // the topology and the nodes are complete
+   }
    else if (mesh_type == "MFEM INLINE mesh v1.0")
    {
       ReadInlineMesh(input, generate_edges);
@@ -9121,6 +9264,22 @@ void FindPartitioningComponents(Table &elem_elem,
 
 int *Mesh::GeneratePartitioning(int nparts, int part_method)
 {
+   if (part_method == 6 || part_method == 7)
+   {
+      // space-filling curve partitioning: split the sequence of elements along
+      // the curve into parts of equal size
+      Array<int> ordering;
+      if (part_method == 6) { GetHilbertElementOrdering(ordering); }
+      else { GetMortonElementOrdering(ordering); }
+
+      int *partitioning = new int[NumOfElements];
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         partitioning[i] = int((long long)ordering[i]*nparts/NumOfElements);
+      }
+      return partitioning;
+   }
+
 #ifdef MFEM_USE_METIS
 
    int print_messages = 1;
@@ -11223,6 +11382,10 @@ void Mesh::NonconformingRefinement(const Array<Refinement> &refinements,
    MFEM_VERIFY(!NURBSext, "Nonconforming refinement of NURBS meshes is "
                "not supported. Project the NURBS to Nodes first.");
 
+   // keep the geometric factors, they are updated below
+   Array<GeometricFactors*> old_geom_factors;
+   mfem::Swap(old_geom_factors, geom_factors);
+
    ResetLazyData();
 
    if (!ncmesh)
@@ -11233,6 +11396,7 @@ void Mesh::NonconformingRefinement(const Array<Refinement> &refinements,
 
    if (!refinements.Size())
    {
+      mfem::Swap(geom_factors, old_geom_factors);
       last_operation = Mesh::NONE;
       return;
    }
@@ -11261,6 +11425,18 @@ void Mesh::NonconformingRefinement(const Array<Refinement> &refinements,
    sequence++;
 
    UpdateNodes();
+
+   UpdateGeometricFactors(old_geom_factors);
+}
+
+void Mesh::UpdateGeometricFactors(const Array<GeometricFactors*> &old_factors)
+{
+   const CoarseFineTransformations &cf = ncmesh->GetRefinementTransforms();
+   for (GeometricFactors *gf : old_factors)
+   {
+      gf->Update(cf);
+      geom_factors.Append(gf);
+   }
 }
 
 real_t Mesh::AggregateError(const Array<real_t> &elem_error,
@@ -12353,6 +12529,7 @@ void Mesh::PrintXG(std::ostream &os) const
 void Mesh::Printer(std::ostream &os, std::string section_delimiter,
                    const std::string &comments) const
 {
+   MFEM_PERF_SCOPE("Mesh::Print");
    int i, j;
 
    if (NURBSext)
@@ -12587,6 +12764,73 @@ void Mesh::Save(const std::string &fname, int precision) const
    Print(ofs);
 }
 
+void Mesh::PrintBinary(std::ostream &os) const
+{
+   MFEM_VERIFY(NURBSext == NULL,
+               "NURBS meshes are not supported by the binary format");
+   MFEM_VERIFY(!attribute_sets.SetsExist() && !bdr_attribute_sets.SetsExist(),
+               "attribute sets are not supported by the binary format");
+
+   BinarySectionWriter out;
+   out.AddValue("dimension", Dim);
+
+   if (Nonconforming())
+   {
+      // Workaround for the Mesh::SwapNodes() state, see Mesh::Printer()
+      Array<real_t> coords_save;
+      if (Nodes) { mfem::Swap(coords_save, ncmesh->coordinates); }
+      ncmesh->PrintBinary(out);
+      if (Nodes) { mfem::Swap(coords_save, ncmesh->coordinates); }
+   }
+   else
+   {
+      auto add_elements = [&out](const std::string &prefix,
+                                 const Array<Element*> &elems, int num_elems)
+      {
+         Array<int> geom(num_elems), attr(num_elems), v;
+         for (int i = 0; i < num_elems; i++)
+         {
+            geom[i] = elems[i]->GetGeometryType();
+            attr[i] = elems[i]->GetAttribute();
+            v.Append(elems[i]->GetVertices(), elems[i]->GetNVertices());
+         }
+         out.AddCopy(prefix + "_geometry", geom.GetData(), geom.Size());
+         out.AddCopy(prefix + "_attributes", attr.GetData(), attr.Size());
+         out.AddCopy(prefix + "_vertices", v.GetData(), v.Size());
+      };
+      add_elements("element", elements, NumOfElements);
+      add_elements("boundary", boundary, NumOfBdrElements);
+
+      out.AddValue("space_dimension", spaceDim);
+      out.AddValue("num_vertices", NumOfVertices);
+      if (Nodes == NULL)
+      {
+         static_assert(sizeof(Vertex) == 3*sizeof(real_t), "");
+         const real_t *coords =
+            reinterpret_cast<const real_t*>(vertices.GetData());
+         out.Add("vertices", coords, 3*std::size_t(NumOfVertices));
+      }
+   }
+
+   if (Nodes)
+   {
+      const FiniteElementSpace *fes = Nodes->FESpace();
+      out.AddString("nodes_fec", fes->FEColl()->Name());
+      out.AddValue("nodes_vdim", fes->GetVDim());
+      out.AddValue("nodes_ordering", int(fes->GetOrdering()));
+      out.Add("nodes", Nodes->HostRead(), std::size_t(Nodes->Size()));
+   }
+
+   out.Write(os, "MFEM binary mesh v1.0");
+}
+
+void Mesh::SaveBinary(const std::string &fname) const
+{
+   ofstream ofs(fname, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << fname);
+   PrintBinary(ofs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void Mesh::Print(adios2stream &os) const
 {
@@ -15386,6 +15630,83 @@ void GeometricFactors::Compute(const GridFunction &nodes,
    }
 }
 
+void GeometricFactors::Update(const CoarseFineTransformations &cf)
+{
+   const int NE = mesh->GetNE();
+   const int NQ = IntRule->GetNPoints();
+   const int dim = mesh->Dimension();
+   const int sdim = mesh->SpaceDimension();
+   MFEM_VERIFY(cf.embeddings.Size() == NE, "invalid refinement transforms");
+
+   // Resize the factors, copying the blocks of the elements that were not
+   // refined, i.e., whose embedding in their parent is the identity (matrix 0).
+   auto update_unrefined = [&](Vector &v, int block_size) -> real_t*
+   {
+      const MemoryType v_mt = v.GetMemory().GetDeviceMemoryType();
+      Vector new_v(block_size*NE, (v_mt != MemoryType::DEFAULT) ? v_mt :
+                   Device::GetDeviceMemoryType());
+      const real_t *h_old = v.HostRead();
+      real_t *h_new = new_v.HostWrite();
+      for (int e = 0; e < NE; e++)
+      {
+         const Embedding &emb = cf.embeddings[e];
+         if (emb.matrix != 0) { continue; }
+         std::copy(h_old + block_size*emb.parent,
+                   h_old + block_size*(emb.parent + 1), h_new + block_size*e);
+      }
+      v.Swap(new_v);
+      return h_new;
+   };
+
+   real_t *h_X = nullptr, *h_J = nullptr, *h_detJ = nullptr;
+   if (computed_factors & COORDINATES)
+   {
+      h_X = update_unrefined(X, NQ*sdim);
+   }
+   if (computed_factors & JACOBIANS)
+   {
+      h_J = update_unrefined(J, NQ*sdim*dim);
+   }
+   if (computed_factors & DETERMINANTS)
+   {
+      h_detJ = update_unrefined(detJ, NQ);
+   }
+
+   // Compute the factors of the new elements.
+   IsoparametricTransformation T;
+   Vector x;
+   for (int e = 0; e < NE; e++)
+   {
+      if (cf.embeddings[e].matrix == 0) { continue; }
+      mesh->GetElementTransformation(e, &T);
+      for (int q = 0; q < NQ; q++)
+      {
+         const IntegrationPoint &ip = IntRule->IntPoint(q);
+         T.SetIntPoint(&ip);
+         if (h_X)
+         {
+            T.Transform(ip, x);
+            for (int i = 0; i < sdim; i++)
+            {
+               h_X[q + NQ*(i + sdim*e)] = x(i);
+            }
+         }
+         if (h_J)
+         {
+            const DenseMatrix &Jq = T.Jacobian();
+            for (int j = 0; j < dim; j++)
+            {
+               for (int i = 0; i < sdim; i++)
+               {
+                  h_J[q + NQ*(i + sdim*(j + dim*e))] = Jq(i, j);
+               }
+            }
+         }
+         if (h_detJ) { h_detJ[q + NQ*e] = T.Weight(); }
+      }
+   }
+}
+
 FaceGeometricFactors::FaceGeometricFactors(const Mesh *mesh,
                                            const IntegrationRule &ir,
                                            int flags, FaceType type,
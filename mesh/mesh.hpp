@@ -15,6 +15,7 @@
 #include "../config/config.hpp"
 #include "../general/stable3d.hpp"
 #include "../general/globals.hpp"
+#include "../general/mem_report.hpp"
 #include "attribute_sets.hpp"
 #include "triangle.hpp"
 #include "tetrahedron.hpp"
@@ -44,6 +45,8 @@ class NURBSExtension;
 class FiniteElementSpace;
 class GridFunction;
 struct Refinement;
+class BinarySectionWriter;
+class BinarySectionReader;
 
 /** An enum type to specify if interior or boundary faces are desired. */
 enum class FaceType : bool {Interior, Boundary};
@@ -366,6 +369,7 @@ protected:
                       bool spacing=false, bool nc=false);
    void ReadInlineMesh(std::istream &input, bool generate_edges = false);
    void ReadGmshMesh(std::istream &input);
+   void ReadBinaryMesh(const BinarySectionReader &input);
 
    /* Note NetCDF (optional library) is used for reading cubit files */
 #ifdef MFEM_USE_NETCDF
@@ -460,6 +464,10 @@ protected:
    */
    void UpdateNodes();
 
+   /** @brief Update the geometric factors @a old_factors, which were cached
+       before a nonconforming refinement, and add them back to #geom_factors. */
+   void UpdateGeometricFactors(const Array<GeometricFactors*> &old_factors);
+
    /// Helper to set vertex coordinates given a high-order curvature function.
    void SetVerticesFromNodes(const GridFunction *nodes);
 
@@ -879,6 +887,14 @@ public:
                             int generate_edges = 0, int refine = 1,
                             bool fix_orientation = true);
 
+   /** @brief Creates mesh by memory mapping a file written by SaveBinary().
+
+       The file is parsed directly from the mapping, without the text
+       conversions of LoadFromFile(). Binary files can also be read with
+       LoadFromFile() and the other stream based constructors. */
+   static Mesh LoadFromBinaryFile(const std::string &filename, int refine = 1,
+                                  bool fix_orientation = true);
+
    /// Creates 1D mesh, divided into n equal intervals.
    static Mesh MakeCartesian1D(int n, real_t sx = 1.0);
 
@@ -1256,6 +1272,13 @@ public:
        ReorderElements. This is a cheap alternative to GetGeckoElementOrdering.*/
    void GetHilbertElementOrdering(Array<int> &ordering);
 
+   /** Return an ordering of the elements that follows the Morton (Z-order)
+       curve. The element centers are quantized in the bounding box of the mesh
+       and sorted by their interleaved bits. The result can be passed to
+       ReorderElements. The Morton curve has a lower locality than the Hilbert
+       curve, see GetHilbertElementOrdering, but is cheaper to compute. */
+   void GetMortonElementOrdering(Array<int> &ordering);
+
    /** Rebuilds the mesh with a different order of elements. For each element i,
        the array ordering[i] contains its desired new index. Note that the method
        reorders vertices, edges and faces along with the elements. */
@@ -2277,7 +2300,18 @@ public:
 
    /// @note The returned array should be deleted by the caller.
    int *CartesianPartitioning(int nxyz[]);
-   /// @note The returned array should be deleted by the caller.
+   /** @brief Partition the elements of the mesh into @a nparts parts,
+       returning the part of each element.
+
+       The @a part_method values 0 to 5 use METIS: 0 and 3 call
+       METIS_PartGraphRecursive, 1 and 4 call METIS_PartGraphKway, 2 and 5 call
+       METIS_PartGraphVKway (methods 0 to 2 first sort the neighbor lists).
+       The values 6 and 7 split the sequence of elements along the Hilbert
+       (see GetHilbertElementOrdering) and Morton (see
+       GetMortonElementOrdering) space-filling curves, respectively, into
+       contiguous parts of equal size; these do not require METIS.
+
+       @note The returned array should be deleted by the caller. */
    int *GeneratePartitioning(int nparts, int part_method = 1);
    /// @todo This method needs a proper description
    void CheckPartitioning(int *partitioning_);
@@ -2604,6 +2638,18 @@ public:
    /// used for ASCII output.
    virtual void Save(const std::string &fname, int precision=16) const;
 
+   /** @brief Print the mesh to the given stream using the "MFEM binary mesh
+       v1.0" format.
+
+       The element, boundary and vertex arrays (or the NCMesh refinement tree)
+       and the nodes are stored as raw arrays in the native byte order, see
+       BinarySectionWriter. NURBS meshes and attribute sets are not supported.
+       The stream must be opened in binary mode. */
+   void PrintBinary(std::ostream &os) const;
+
+   /// Save the mesh to a file using Mesh::PrintBinary.
+   void SaveBinary(const std::string &fname) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &os) const;
@@ -2690,6 +2736,11 @@ public:
       PrintCharacteristics(NULL, NULL, os);
    }
 
+   /** @brief Return a report of the memory held by the mesh: vertices,
+       elements, connectivity tables, owned nodes, NCMesh and the cached
+       geometric factors. */
+   virtual MemoryReport GetMemoryReport() const;
+
 #ifdef MFEM_DEBUG
    /// Output an NCMesh-compatible debug dump.
    void DebugDump(std::ostream &os) const;
@@ -3129,6 +3180,14 @@ public:
                     int flags,
                     MemoryType d_mt = MemoryType::DEFAULT);
 
+   /** @brief Update the factors after a nonconforming refinement of the mesh,
+       described by the refinement transformations @a cf. */
+   /** The factors of the elements that were not refined are copied from their
+       old location, only the factors of the new elements are computed. This is
+       called by Mesh::GeneralRefinement() for the factors cached in the mesh,
+       see Mesh::GetGeometricFactors(). */
+   void Update(const CoarseFineTransformations &cf);
+
    /// Mapped (physical) coordinates of all quadrature points.
    /** This array uses a column-major layout with dimensions (NQ x SDIM x NE)
        where
@@ -3151,6 +3210,13 @@ public:
        - NQ = number of quadrature points per element, and
        - NE = number of elements in the mesh. */
    Vector detJ;
+
+   /// Return a report of the memory held by the geometric factors.
+   MemoryReport GetMemoryReport() const
+   {
+      return MemoryReport("GeometricFactors").Add("X", X.GetMemory())
+             .Add("J", J.GetMemory()).Add("detJ", detJ.GetMemory());
+   }
 };
 
 
@@ -3206,6 +3272,14 @@ public:
        - SDIM = space dimension of the mesh = mesh.SpaceDimension(), and
        - NF = number of faces in the mesh. */
    Vector normal;
+
+   /// Return a report of the memory held by the face geometric factors.
+   MemoryReport GetMemoryReport() const
+   {
+      return MemoryReport("FaceGeometricFactors").Add("X", X.GetMemory())
+             .Add("J", J.GetMemory()).Add("detJ", detJ.GetMemory())
+             .Add("normal", normal.GetMemory());
+   }
 };
 
 
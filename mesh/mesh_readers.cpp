@@ -13,6 +13,7 @@
 #include "ncnurbs.hpp"
 #include "../fem/fem.hpp"
 #include "../general/binaryio.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/text.hpp"
 #include "../general/tinyxml2.h"
 
@@ -130,6 +131,94 @@ void Mesh::ReadMFEMMesh(std::istream &input, int version, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+void Mesh::ReadBinaryMesh(const BinarySectionReader &input)
+{
+   // Read the "MFEM binary mesh v1.0" format, see Mesh::PrintBinary()
+   Dim = input.GetValue<int>("dimension");
+
+   int curved = 0;
+   if (input.Has("nc_elements"))
+   {
+      ncmesh = new NCMesh(input, curved);
+      InitFromNCMesh(*ncmesh);
+   }
+   else
+   {
+      auto read_elements = [&](const std::string &prefix,
+                               Array<Element*> &elems)
+      {
+         std::size_t ne, nattr, nv;
+         const int *geom = input.GetData<int>(prefix + "_geometry", ne);
+         const int *attr = input.GetData<int>(prefix + "_attributes", nattr);
+         const int *v = input.GetData<int>(prefix + "_vertices", nv);
+         MFEM_VERIFY(nattr == ne, "invalid binary mesh: " << prefix);
+         elems.SetSize(int(ne));
+         for (std::size_t i = 0; i < ne; i++)
+         {
+            elems[i] = NewElement(geom[i]);
+            MFEM_VERIFY(std::size_t(elems[i]->GetNVertices()) <= nv,
+                        "invalid binary mesh: " << prefix);
+            elems[i]->SetVertices(v);
+            elems[i]->SetAttribute(attr[i]);
+            v += elems[i]->GetNVertices();
+            nv -= elems[i]->GetNVertices();
+         }
+         return int(ne);
+      };
+      NumOfElements = read_elements("element", elements);
+      NumOfBdrElements = read_elements("boundary", boundary);
+
+      spaceDim = input.GetValue<int>("space_dimension");
+      NumOfVertices = input.GetValue<int>("num_vertices");
+      vertices.SetSize(NumOfVertices);
+      if (input.Has("vertices"))
+      {
+         std::size_t size;
+         const real_t *coords = input.GetData<real_t>("vertices", size);
+         MFEM_VERIFY(size == 3*std::size_t(NumOfVertices),
+                     "invalid binary mesh: vertices");
+         for (int i = 0; i < NumOfVertices; i++)
+         {
+            vertices[i].SetCoords(3, coords + 3*i);
+         }
+      }
+      else
+      {
+         curved = 1;
+      }
+   }
+
+   // don't generate any boundary elements, see Mesh::Loader()
+   FinalizeTopology(false);
+
+   if (curved)
+   {
+      const std::string fec_name = input.GetString("nodes_fec");
+      FiniteElementCollection *fec =
+         FiniteElementCollection::New(fec_name.c_str());
+      const int vdim = input.GetValue<int>("nodes_vdim");
+      const auto ordering =
+         static_cast<Ordering::Type>(input.GetValue<int>("nodes_ordering"));
+      FiniteElementSpace *fes =
+         new FiniteElementSpace(this, fec, vdim, ordering);
+      Nodes = new GridFunction(fes);
+      Nodes->MakeOwner(fec);
+
+      std::size_t size;
+      const real_t *data = input.GetData<real_t>("nodes", size);
+      MFEM_VERIFY(size == std::size_t(Nodes->Size()),
+                  "invalid binary mesh: nodes");
+      std::copy(data, data + size, Nodes->HostWrite());
+
+      own_nodes = 1;
+      spaceDim = Nodes->VectorDim();
+      if (ncmesh) { ncmesh->spaceDim = spaceDim; }
+
+      // Set vertex coordinates from the 'Nodes'
+      SetVerticesFromNodes(Nodes);
+   }
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
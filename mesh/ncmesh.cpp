@@ -10,12 +10,19 @@
 // CONTRIBUTING.md for details.
 
 #include "mesh_headers.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/text.hpp"
+#include "../general/device.hpp"
 
 #include <string>
 #include <cmath>
 #include <map>
+#include <vector>
+
+#ifdef MFEM_USE_OPENMP
+#include <omp.h>
+#endif
 
 #include "ncmesh_tables.hpp"
 
@@ -3407,6 +3414,22 @@ struct MatrixMap
       }
    }
 
+   /** Add the matrices of @a other, in the order of their indices, and return
+       their indices in this map in @a remap. */
+   void Merge(const MatrixMap &other, Array<int> &remap)
+   {
+      std::vector<const NCMesh::PointMatrix*> matrices(other.map.size());
+      for (const auto &pair : other.map)
+      {
+         matrices[pair.second - 1] = &pair.first;
+      }
+      remap.SetSize(static_cast<int>(matrices.size()));
+      for (int i = 0; i < remap.Size(); i++)
+      {
+         remap[i] = GetIndex(*matrices[i]);
+      }
+   }
+
    void DumpBucketSizes() const
    {
       for (unsigned i = 0; i < map.bucket_count(); i++)
@@ -3419,6 +3442,68 @@ private:
    std::unordered_map<NCMesh::PointMatrix, int, PointMatrixHash> map;
 };
 
+/** Part of a face or edge list, built by one thread from a contiguous range of
+ *  the faces/edges visited by BuildFaceList() or BuildEdgeList().
+ */
+struct NCListPart
+{
+   Array<NCMesh::MeshId> conforming;
+   Array<NCMesh::Master> masters;
+   Array<NCMesh::Slave> slaves;
+   Array<int> boundary_faces;
+   MatrixMap matrix_maps[Geometry::NumGeom];
+};
+
+/** Append the @a parts, in order, to @a list and @a boundary_faces. The result
+ *  is the same as if the parts were built one after the other by one thread.
+ */
+static void MergeNCListParts(std::vector<NCListPart> &parts,
+                             NCMesh::NCList &list, Array<int> &boundary_faces)
+{
+   MatrixMap matrix_maps[Geometry::NumGeom];
+   Array<int> remap[Geometry::NumGeom];
+   for (NCListPart &part : parts)
+   {
+      for (int g = 0; g < Geometry::NumGeom; g++)
+      {
+         matrix_maps[g].Merge(part.matrix_maps[g], remap[g]);
+      }
+
+      const int offset = list.slaves.Size();
+      for (NCMesh::Slave &sl : part.slaves)
+      {
+         sl.matrix = remap[sl.Geom()][sl.matrix];
+         list.slaves.Append(sl);
+      }
+      for (NCMesh::Master &master : part.masters)
+      {
+         master.slaves_begin += offset;
+         master.slaves_end += offset;
+         list.masters.Append(master);
+      }
+      list.conforming.Append(part.conforming);
+      boundary_faces.Append(part.boundary_faces);
+   }
+
+   // export unique point matrices
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      matrix_maps[g].ExportMatrices(list.point_matrices[g]);
+   }
+}
+
+/** Number of threads used by BuildFaceList() and BuildEdgeList(): the face
+ *  and edge lookups and the traversals are done concurrently when MFEM is
+ *  built with OpenMP and the OpenMP backend is enabled in the Device.
+ */
+static int NCListThreads()
+{
+#ifdef MFEM_USE_OPENMP
+   if (Device::Allows(Backend::OMP_MASK)) { return omp_get_max_threads(); }
+#endif
+   return 1;
+}
+
 
 int NCMesh::ReorderFacePointMat(int v0, int v1, int v2, int v3,
                                 int elem, const PointMatrix &pm,
@@ -3453,7 +3538,8 @@ int NCMesh::ReorderFacePointMat(int v0, int v1, int v2, int v3,
 
 void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
                               const PointMatrix& pm, int level,
-                              Face* eface[4], MatrixMap &matrix_map)
+                              Face* eface[4], MatrixMap &matrix_map,
+                              Array<Slave> &slaves)
 {
    if (level > 0)
    {
@@ -3463,9 +3549,9 @@ void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
       {
          // we have a slave face, add it to the list
          int elem = fa->GetSingleElement();
-         face_list.slaves.Append(
+         slaves.Append(
             Slave(fa->index, elem, -1, Geometry::SQUARE));
-         Slave &sl = face_list.slaves.Last();
+         Slave &sl = slaves.Last();
 
          // reorder the point matrix according to slave face orientation
          PointMatrix pm_r;
@@ -3491,11 +3577,11 @@ void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
 
       TraverseQuadFace(vn0, mid[0], mid[2], vn3,
                        PointMatrix(pm(0), pmid0, pmid2, pm(3)),
-                       level+1, ef[0], matrix_map);
+                       level+1, ef[0], matrix_map, slaves);
 
       TraverseQuadFace(mid[0], vn1, vn2, mid[2],
                        PointMatrix(pmid0, pm(1), pm(2), pmid2),
-                       level+1, ef[1], matrix_map);
+                       level+1, ef[1], matrix_map, slaves);
 
       eface[1] = ef[1][1];
       eface[3] = ef[0][3];
@@ -3507,11 +3593,11 @@ void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
 
       TraverseQuadFace(vn0, vn1, mid[1], mid[3],
                        PointMatrix(pm(0), pm(1), pmid1, pmid3),
-                       level+1, ef[0], matrix_map);
+                       level+1, ef[0], matrix_map, slaves);
 
       TraverseQuadFace(mid[3], mid[1], vn2, vn3,
                        PointMatrix(pmid3, pmid1, pm(2), pm(3)),
-                       level+1, ef[1], matrix_map);
+                       level+1, ef[1], matrix_map, slaves);
 
       eface[0] = ef[0][0];
       eface[2] = ef[1][2];
@@ -3541,10 +3627,10 @@ void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
             MFEM_ASSERT(eid.Size() < 2, "non-unique edge prism");
 
             // create a slave face record with a degenerate point matrix
-            face_list.slaves.Append(
+            slaves.Append(
                Slave(FlipIndexSign(enode.edge_index),
                      eid[0].element, eid[0].local, Geometry::SQUARE));
-            Slave &sl = face_list.slaves.Last();
+            Slave &sl = slaves.Last();
 
             if (split == 1)
             {
@@ -3572,7 +3658,7 @@ void NCMesh::TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
 }
 
 void NCMesh::TraverseTetEdge(int vn0, int vn1, const Point &p0, const Point &p1,
-                             MatrixMap &matrix_map)
+                             MatrixMap &matrix_map, Array<Slave> &slaves)
 {
    int mid = nodes.FindId(vn0, vn1);
    if (mid < 0) { return; }
@@ -3588,13 +3674,13 @@ void NCMesh::TraverseTetEdge(int vn0, int vn1, const Point &p0, const Point &p1,
          // in this case we need to add an edge-face constraint, because the
          // non-slave edge is really a (face-)slave itself.
          const MeshId &eid = *eid_and_type.id;
-         face_list.slaves.Append(
+         slaves.Append(
             Slave(FlipIndexSign(eid.index), eid.element, eid.local, Geometry::TRIANGLE));
 
          int v0index = nodes[vn0].vert_index;
          int v1index = nodes[vn1].vert_index;
 
-         face_list.slaves.Last().matrix =
+         slaves.Last().matrix =
             matrix_map.GetIndex((v0index < v1index) ? PointMatrix(p0, p1, p0)
                                 /*               */ : PointMatrix(p1, p0, p1));
 
@@ -3604,14 +3690,15 @@ void NCMesh::TraverseTetEdge(int vn0, int vn1, const Point &p0, const Point &p1,
 
    // recurse deeper
    Point pmid(p0, p1);
-   TraverseTetEdge(vn0, mid, p0, pmid, matrix_map);
-   TraverseTetEdge(mid, vn1, pmid, p1, matrix_map);
+   TraverseTetEdge(vn0, mid, p0, pmid, matrix_map, slaves);
+   TraverseTetEdge(mid, vn1, pmid, p1, matrix_map, slaves);
 }
 
 NCMesh::TriFaceTraverseResults NCMesh::TraverseTriFace(int vn0, int vn1,
                                                        int vn2,
                                                        const PointMatrix& pm, int level,
-                                                       MatrixMap &matrix_map)
+                                                       MatrixMap &matrix_map,
+                                                       Array<Slave> &slaves)
 {
    if (level > 0)
    {
@@ -3621,9 +3708,9 @@ NCMesh::TriFaceTraverseResults NCMesh::TraverseTriFace(int vn0, int vn1,
       {
          // we have a slave face, add it to the list
          int elem = fa->GetSingleElement();
-         face_list.slaves.Append(
+         slaves.Append(
             Slave(fa->index, elem, -1, Geometry::TRIANGLE));
-         Slave &sl = face_list.slaves.Last();
+         Slave &sl = slaves.Last();
 
          // reorder the point matrix according to slave face orientation
          PointMatrix pm_r;
@@ -3642,19 +3729,19 @@ NCMesh::TriFaceTraverseResults NCMesh::TraverseTriFace(int vn0, int vn1,
 
       b[0] = TraverseTriFace(vn0, mid[0], mid[2],
                              PointMatrix(pm(0), pmid0, pmid2),
-                             level+1, matrix_map);
+                             level+1, matrix_map, slaves);
 
       b[1] = TraverseTriFace(mid[0], vn1, mid[1],
                              PointMatrix(pmid0, pm(1), pmid1),
-                             level+1, matrix_map);
+                             level+1, matrix_map, slaves);
 
       b[2] = TraverseTriFace(mid[2], mid[1], vn2,
                              PointMatrix(pmid2, pmid1, pm(2)),
-                             level+1, matrix_map);
+                             level+1, matrix_map, slaves);
 
       b[3] = TraverseTriFace(mid[1], mid[2], mid[0],
                              PointMatrix(pmid1, pmid2, pmid0),
-                             level+1, matrix_map);
+                             level+1, matrix_map, slaves);
 
       // Traverse possible tet edges constrained by the master face. This needs
       // to occur if none of these first NC level faces are split further, OR if
@@ -3666,9 +3753,18 @@ NCMesh::TriFaceTraverseResults NCMesh::TraverseTriFace(int vn0, int vn1,
       {
          // If the faces have no further splits, so would not be captured by
          // normal face relations, add possible edge constraints.
-         if (!b[1].unsplit || b[1].ghost_neighbor) { TraverseTetEdge(mid[0],mid[1], pmid0,pmid1, matrix_map); }
-         if (!b[2].unsplit || b[2].ghost_neighbor) { TraverseTetEdge(mid[1],mid[2], pmid1,pmid2, matrix_map); }
-         if (!b[0].unsplit || b[0].ghost_neighbor) { TraverseTetEdge(mid[2],mid[0], pmid2,pmid0, matrix_map); }
+         if (!b[1].unsplit || b[1].ghost_neighbor)
+         {
+            TraverseTetEdge(mid[0], mid[1], pmid0, pmid1, matrix_map, slaves);
+         }
+         if (!b[2].unsplit || b[2].ghost_neighbor)
+         {
+            TraverseTetEdge(mid[1], mid[2], pmid1, pmid2, matrix_map, slaves);
+         }
+         if (!b[0].unsplit || b[0].ghost_neighbor)
+         {
+            TraverseTetEdge(mid[2], mid[0], pmid2, pmid0, matrix_map, slaves);
+         }
       }
    }
    return {false, false};
@@ -3679,34 +3775,50 @@ void NCMesh::BuildFaceList()
    face_list.Clear();
    if (Dim < 3) { return; }
 
-   if (HaveTets()) { GetEdgeList(); } // needed by TraverseTetEdge()
+   if (HaveTets())
+   {
+      GetEdgeList(); // needed by TraverseTetEdge()
+      edge_list.BuildIndex(); // looked up concurrently by TraverseTetEdge()
+   }
 
    boundary_faces.SetSize(0);
 
-   Array<char> processed_faces(faces.NumIds());
-   processed_faces = 0;
-
-   MatrixMap matrix_maps[Geometry::NumGeom];
+   const int nthreads = NCListThreads();
+   const int nleaves = leaf_elements.Size();
 
-   // visit faces of leaf elements
-   for (int i = 0; i < leaf_elements.Size(); i++)
+   // find the faces of leaf elements
+   Array<int> leaf_faces(nleaves*MaxElemFaces);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+   for (int i = 0; i < nleaves; i++)
    {
-      int elem = leaf_elements[i];
-      Element &el = elements[elem];
+      const Element &el = elements[leaf_elements[i]];
       MFEM_ASSERT(!el.ref_type, "not a leaf element.");
 
-      GeomInfo& gi = GI[el.Geom()];
+      const GeomInfo &gi = GI[el.Geom()];
       for (int j = 0; j < gi.nf; j++)
       {
-         // get nodes for this face
-         int node[4];
-         for (int k = 0; k < 4; k++)
-         {
-            node[k] = el.node[gi.faces[j][k]];
-         }
-
-         int face = faces.FindId(node[0], node[1], node[2], node[3]);
+         const int *fv = gi.faces[j];
+         int face = faces.FindId(el.node[fv[0]], el.node[fv[1]],
+                                 el.node[fv[2]], el.node[fv[3]]);
          MFEM_ASSERT(face >= 0, "face not found!");
+         leaf_faces[i*MaxElemFaces + j] = face;
+      }
+   }
+
+   // visit faces of leaf elements, keep the first visit of each face; this is
+   // sequential so that the lists do not depend on the number of threads
+   Array<char> processed_faces(faces.NumIds());
+   processed_faces = 0;
+
+   Array<int> visits;
+   for (int i = 0; i < nleaves; i++)
+   {
+      int elem = leaf_elements[i];
+      for (int j = 0; j < GI[elements[elem].Geom()].nf; j++)
+      {
+         int face = leaf_faces[i*MaxElemFaces + j];
 
          // tell ParNCMesh about the face
          ElementSharesFace(elem, j, face);
@@ -3715,6 +3827,34 @@ void NCMesh::BuildFaceList()
          if (processed_faces[face]) { continue; }
          processed_faces[face] = 1;
 
+         visits.Append(i*MaxElemFaces + j);
+      }
+   }
+
+   // classify the visited faces, each thread handling a range of them
+   std::vector<NCListPart> parts(nthreads);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+   for (int p = 0; p < nthreads; p++)
+   {
+      NCListPart &part = parts[p];
+      const int begin = int((long long) visits.Size()*p/nthreads);
+      const int end = int((long long) visits.Size()*(p+1)/nthreads);
+      for (int k = begin; k < end; k++)
+      {
+         const int i = visits[k] / MaxElemFaces, j = visits[k] % MaxElemFaces;
+         int elem = leaf_elements[i];
+         Element &el = elements[elem];
+
+         // get nodes for this face
+         int node[4];
+         for (int m = 0; m < 4; m++)
+         {
+            node[m] = el.node[GI[el.Geom()].faces[j][m]];
+         }
+
+         int face = leaf_faces[visits[k]];
          int fgeom = (node[3] >= 0) ? Geometry::SQUARE : Geometry::TRIANGLE;
 
          Face &fa = faces[face];
@@ -3722,55 +3862,52 @@ void NCMesh::BuildFaceList()
          if (fa.elem[0] >= 0 && fa.elem[1] >= 0)
          {
             // this is a conforming face, add it to the list
-            face_list.conforming.Append(MeshId(fa.index, elem, j, fgeom));
+            part.conforming.Append(MeshId(fa.index, elem, j, fgeom));
          }
          else
          {
             // this is either a master face or a slave face, but we can't tell
             // until we traverse the face refinement 'tree'...
-            int sb = face_list.slaves.Size();
+            int sb = part.slaves.Size();
             if (fgeom == Geometry::SQUARE)
             {
                Face* dummy[4];
                TraverseQuadFace(node[0], node[1], node[2], node[3],
-                                pm_quad_identity, 0, dummy, matrix_maps[fgeom]);
+                                pm_quad_identity, 0, dummy,
+                                part.matrix_maps[fgeom], part.slaves);
             }
             else
             {
-               TraverseTriFace(node[0], node[1], node[2],
-                               pm_tri_identity, 0, matrix_maps[fgeom]);
+               TraverseTriFace(node[0], node[1], node[2], pm_tri_identity, 0,
+                               part.matrix_maps[fgeom], part.slaves);
             }
 
-            int se = face_list.slaves.Size();
+            int se = part.slaves.Size();
             if (sb < se)
             {
                // found slaves, so this is a master face; add it to the list
                is_master = true;
-               face_list.masters.Append(
-                  Master(fa.index, elem, j, fgeom, sb, se));
+               part.masters.Append(Master(fa.index, elem, j, fgeom, sb, se));
 
                // also, set the master index for the slaves
                for (int ii = sb; ii < se; ii++)
                {
-                  face_list.slaves[ii].master = fa.index;
+                  part.slaves[ii].master = fa.index;
                }
             }
          }
 
          // To support internal boundaries can only insert non-master faces.
-         if (fa.Boundary() && !is_master) { boundary_faces.Append(face); }
+         if (fa.Boundary() && !is_master) { part.boundary_faces.Append(face); }
       }
    }
 
-   // export unique point matrices
-   for (int i = 0; i < Geometry::NumGeom; i++)
-   {
-      matrix_maps[i].ExportMatrices(face_list.point_matrices[i]);
-   }
+   MergeNCListParts(parts, face_list, boundary_faces);
 }
 
 void NCMesh::TraverseEdge(int vn0, int vn1, real_t t0, real_t t1, int flags,
-                          int level, MatrixMap &matrix_map)
+                          int level, MatrixMap &matrix_map,
+                          Array<Slave> &slaves)
 {
    int mid = nodes.FindId(vn0, vn1);
    if (mid < 0) { return; }
@@ -3779,9 +3916,9 @@ void NCMesh::TraverseEdge(int vn0, int vn1, real_t t0, real_t t1, int flags,
    if (nd.HasEdge() && level > 0)
    {
       // we have a slave edge, add it to the list
-      edge_list.slaves.Append(Slave(nd.edge_index, -1, -1, Geometry::SEGMENT));
+      slaves.Append(Slave(nd.edge_index, -1, -1, Geometry::SEGMENT));
 
-      Slave &sl = edge_list.slaves.Last();
+      Slave &sl = slaves.Last();
       sl.matrix = matrix_map.GetIndex(PointMatrix(Point(t0), Point(t1)));
 
       // handle slave edge orientation
@@ -3795,8 +3932,8 @@ void NCMesh::TraverseEdge(int vn0, int vn1, real_t t0, real_t t1, int flags,
    const real_t scale = GetScale(nd.GetScale(), vn0 > vn1);
 
    const real_t tmid = ((1.0 - scale) * t0) + (scale * t1);
-   TraverseEdge(vn0, mid, t0, tmid, flags, level+1, matrix_map);
-   TraverseEdge(mid, vn1, tmid, t1, flags, level+1, matrix_map);
+   TraverseEdge(vn0, mid, t0, tmid, flags, level+1, matrix_map, slaves);
+   TraverseEdge(mid, vn1, tmid, t1, flags, level+1, matrix_map, slaves);
 }
 
 void NCMesh::BuildEdgeList()
@@ -3804,6 +3941,33 @@ void NCMesh::BuildEdgeList()
    edge_list.Clear();
    if (Dim < 3) { boundary_faces.SetSize(0); }
 
+   const int nthreads = NCListThreads();
+   const int nleaves = leaf_elements.Size();
+
+   // find the edge nodes of leaf elements, and whether the edges are slaves
+   Array<int> leaf_edges(nleaves*MaxElemEdges);
+   Array<char> leaf_edge_slave(nleaves*MaxElemEdges);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for num_threads(nthreads) schedule(static)
+#endif
+   for (int i = 0; i < nleaves; i++)
+   {
+      const Element &el = elements[leaf_elements[i]];
+      MFEM_ASSERT(!el.ref_type, "not a leaf element.");
+
+      const GeomInfo &gi = GI[el.Geom()];
+      for (int j = 0; j < gi.ne; j++)
+      {
+         const int* ev = gi.edges[j];
+         int enode = nodes.FindId(el.node[ev[0]], el.node[ev[1]]);
+         MFEM_ASSERT(enode >= 0, "edge node not found!");
+         MFEM_ASSERT(nodes[enode].HasEdge(), "edge not found!");
+         leaf_edges[i*MaxElemEdges + j] = enode;
+         leaf_edge_slave[i*MaxElemEdges + j] = (GetEdgeMaster(enode) >= 0);
+      }
+   }
+
+   // visit edges of leaf elements, sequentially (see BuildFaceList)
    Array<char> processed_edges(nodes.NumIds());
    processed_edges = 0;
 
@@ -3811,27 +3975,14 @@ void NCMesh::BuildEdgeList()
    Array<signed char> edge_local(nodes.NumIds());
    edge_local = -1;
 
-   MatrixMap matrix_map;
-
-   // visit edges of leaf elements
-   for (int i = 0; i < leaf_elements.Size(); i++)
+   Array<int> visits;
+   for (int i = 0; i < nleaves; i++)
    {
       int elem = leaf_elements[i];
-      Element &el = elements[elem];
-      MFEM_ASSERT(!el.ref_type, "not a leaf element.");
-
-      GeomInfo& gi = GI[el.Geom()];
-      for (int j = 0; j < gi.ne; j++)
+      for (int j = 0; j < GI[elements[elem].Geom()].ne; j++)
       {
-         // get nodes for this edge
-         const int* ev = gi.edges[j];
-         int node[2] = { el.node[ev[0]], el.node[ev[1]] };
-
-         int enode = nodes.FindId(node[0], node[1]);
-         MFEM_ASSERT(enode >= 0, "edge node not found!");
-
+         int enode = leaf_edges[i*MaxElemEdges + j];
          Node &nd = nodes[enode];
-         MFEM_ASSERT(nd.HasEdge(), "edge not found!");
 
          // tell ParNCMesh about the edge
          ElementSharesEdge(elem, j, enode);
@@ -3841,15 +3992,10 @@ void NCMesh::BuildEdgeList()
          edge_local[nd.edge_index] = j;
 
          // skip slave edges here, they will be reached from their masters
-         if (GetEdgeMaster(enode) >= 0)
+         // (2D only: visit them to store internal boundary faces)
+         if (leaf_edge_slave[i*MaxElemEdges + j])
          {
-            // (2D only, store internal boundary faces)
-            if (Dim <= 2)
-            {
-               int face = faces.FindId(node[0], node[0], node[1], node[1]);
-               MFEM_ASSERT(face >= 0, "face not found!");
-               if (faces[face].Boundary()) { boundary_faces.Append(face); }
-            }
+            if (Dim <= 2) { visits.Append(i*MaxElemEdges + j); }
             continue;
          }
 
@@ -3857,6 +4003,42 @@ void NCMesh::BuildEdgeList()
          if (processed_edges[enode]) { continue; }
          processed_edges[enode] = 1;
 
+         visits.Append(i*MaxElemEdges + j);
+      }
+   }
+
+   // classify the visited edges, each thread handling a range of them
+   std::vector<NCListPart> parts(nthreads);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for num_threads(nthreads) schedule(static, 1)
+#endif
+   for (int p = 0; p < nthreads; p++)
+   {
+      NCListPart &part = parts[p];
+      MatrixMap &matrix_map = part.matrix_maps[Geometry::SEGMENT];
+      const int begin = int((long long) visits.Size()*p/nthreads);
+      const int end = int((long long) visits.Size()*(p+1)/nthreads);
+      for (int k = begin; k < end; k++)
+      {
+         const int i = visits[k] / MaxElemEdges, j = visits[k] % MaxElemEdges;
+         int elem = leaf_elements[i];
+         Element &el = elements[elem];
+
+         // get nodes for this edge
+         const int* ev = GI[el.Geom()].edges[j];
+         int node[2] = { el.node[ev[0]], el.node[ev[1]] };
+
+         if (leaf_edge_slave[visits[k]])
+         {
+            // (2D only, store internal boundary faces)
+            int face = faces.FindId(node[0], node[0], node[1], node[1]);
+            MFEM_ASSERT(face >= 0, "face not found!");
+            if (faces[face].Boundary()) { part.boundary_faces.Append(face); }
+            continue;
+         }
+
+         Node &nd = nodes[leaf_edges[visits[k]]];
+
          // prepare edge interval for slave traversal, handle orientation
          real_t t0 = 0.0, t1 = 1.0;
          int v0index = nodes[node[0]].vert_index;
@@ -3864,37 +4046,40 @@ void NCMesh::BuildEdgeList()
          int flags = (v0index > v1index) ? 1 : 0;
 
          // try traversing the edge to find slave edges
-         int sb = edge_list.slaves.Size();
-         TraverseEdge(node[0], node[1], t0, t1, flags, 0, matrix_map);
+         int sb = part.slaves.Size();
+         TraverseEdge(node[0], node[1], t0, t1, flags, 0, matrix_map,
+                      part.slaves);
 
-         int se = edge_list.slaves.Size();
+         int se = part.slaves.Size();
          if (sb < se)
          {
             // found slaves, this is a master face; add it to the list
-            edge_list.masters.Append(
+            part.masters.Append(
                Master(nd.edge_index, elem, j, Geometry::SEGMENT, sb, se));
 
             // also, set the master index for the slaves
             for (int ii = sb; ii < se; ii++)
             {
-               edge_list.slaves[ii].master = nd.edge_index;
+               part.slaves[ii].master = nd.edge_index;
             }
          }
          else
          {
             // no slaves, this is a conforming edge
-            edge_list.conforming.Append(MeshId(nd.edge_index, elem, j));
+            part.conforming.Append(MeshId(nd.edge_index, elem, j));
             // (2D only, store boundary faces)
             if (Dim <= 2)
             {
                int face = faces.FindId(node[0], node[0], node[1], node[1]);
                MFEM_ASSERT(face >= 0, "face not found!");
-               if (faces[face].Boundary()) { boundary_faces.Append(face); }
+               if (faces[face].Boundary()) { part.boundary_faces.Append(face); }
             }
          }
       }
    }
 
+   MergeNCListParts(parts, edge_list, boundary_faces);
+
    // fix up slave edge element/local
    for (int i = 0; i < edge_list.slaves.Size(); i++)
    {
@@ -3906,9 +4091,6 @@ void NCMesh::BuildEdgeList()
          sl.element = edge_element[sl.index];
       }
    }
-
-   // export unique point matrices
-   matrix_map.ExportMatrices(edge_list.point_matrices[Geometry::SEGMENT]);
 }
 
 void NCMesh::BuildVertexList()
@@ -6689,6 +6871,255 @@ NCMesh::NCMesh(std::istream &input, int version, int &curved, int &is_nc)
    Update();
 }
 
+void NCMesh::PrintBinary(BinarySectionWriter &out) const
+{
+   MFEM_VERIFY(vertex_to_knotspan.Size() == 0,
+               "NC-patch NURBS meshes are not supported by the binary format");
+
+   out.AddValue("nc_version", using_scaling ? 11 : 10);
+   out.AddValue("nc_rank", MyRank);
+
+   // rank, attr, geom, ref_type and nodes/children of all elements
+   constexpr int stride = 4 + MaxElemChildren;
+   Array<int> elem_data(stride*elements.Size());
+   elem_data = -1;
+   for (int i = 0; i < elements.Size(); i++)
+   {
+      const Element &el = elements[i];
+      int *data = elem_data.GetData() + stride*i;
+      data[0] = el.rank;
+      data[1] = el.attribute;
+      if (el.parent == -2) { continue; } // unused element
+
+      data[2] = int(el.geom);
+      data[3] = int(el.ref_type);
+      if (el.ref_type)
+      {
+         for (int j = 0; j < ref_type_num_children[int(el.ref_type)]; j++)
+         {
+            data[4 + j] = el.child[j];
+         }
+      }
+      else
+      {
+         for (int j = 0; j < GI[el.Geom()].nv; j++)
+         {
+            data[4 + j] = el.node[j];
+         }
+      }
+   }
+   out.AddCopy("nc_elements", elem_data.GetData(), elem_data.Size());
+
+   // attr, geom and nodes of the boundary faces, see PrintBoundary()
+   static const int nfv2geom[5] =
+   {
+      Geometry::INVALID, Geometry::POINT, Geometry::SEGMENT,
+      Geometry::TRIANGLE, Geometry::SQUARE
+   };
+   const int deg = (Dim == 2) ? 2 : 1; // for degenerate faces in 2D
+   Array<int> bdr_data;
+   for (int i = 0; i < elements.Size(); i++)
+   {
+      const Element &el = elements[i];
+      if (!el.IsLeaf()) { continue; }
+
+      const GeomInfo &gi = GI[el.Geom()];
+      for (int k = 0; k < gi.nf; k++)
+      {
+         const int *fv = gi.faces[k];
+         const int nfv = gi.nfv[k];
+         const Face *face = faces.Find(el.node[fv[0]], el.node[fv[1]],
+                                       el.node[fv[2]], el.node[fv[3]]);
+         MFEM_ASSERT(face != NULL, "face not found");
+         if (!face->Boundary()) { continue; }
+
+         bdr_data.Append(face->attribute);
+         bdr_data.Append(nfv2geom[nfv]);
+         for (int j = 0; j < MaxFaceNodes; j++)
+         {
+            bdr_data.Append(j < nfv ? el.node[fv[j*deg]] : -1);
+         }
+      }
+   }
+   out.AddCopy("nc_boundary", bdr_data.GetData(), bdr_data.Size());
+
+   // vertex parents (id, p1, p2) and scales, see PrintVertexParents()
+   Array<int> parents;
+   Array<real_t> scales;
+   for (auto node = nodes.cbegin(); node != nodes.cend(); ++node)
+   {
+      if (node->HasVertex() && node->p1 != node->p2)
+      {
+         parents.Append(node.index());
+         parents.Append(node->p1);
+         parents.Append(node->p2);
+         scales.Append(node->GetScale());
+         MFEM_VERIFY(using_scaling || node->GetScale() == 0.5,
+                     "NCMesh has nonuniform scaling. Call "
+                     "Mesh::SetScaledNCMesh first.");
+      }
+   }
+   out.AddCopy("nc_vertex_parents", parents.GetData(), parents.Size());
+   if (using_scaling)
+   {
+      out.AddCopy("nc_vertex_scales", scales.GetData(), scales.Size());
+   }
+
+   if (!ZeroRootStates())
+   {
+      out.Add("nc_root_state", root_state);
+   }
+
+   // an empty 'nc_coordinates' section means that the mesh is curved
+   out.AddValue("nc_space_dimension", spaceDim);
+   out.Add("nc_coordinates", coordinates);
+}
+
+NCMesh::NCMesh(const BinarySectionReader &input, int &curved)
+   : spaceDim(0), MyRank(0), Iso(true), Legacy(false)
+{
+   const int version = input.GetValue<int>("nc_version");
+   MFEM_VERIFY(version == 10 || version == 11,
+               "unsupported NC mesh version " << version);
+   using_scaling = (version == 11);
+   Dim = input.GetValue<int>("dimension");
+   MyRank = input.GetValue<int>("nc_rank");
+
+   // load elements
+   constexpr int stride = 4 + MaxElemChildren;
+   std::size_t size;
+   const int *elem_data = input.GetData<int>("nc_elements", size);
+   MFEM_VERIFY(size % stride == 0, "invalid binary mesh: nc_elements");
+   const int count = int(size/stride);
+   for (int i = 0; i < count; i++)
+   {
+      const int *data = elem_data + stride*i;
+      const int geom = data[2];
+
+      Geometry::Type type = Geometry::Type(geom);
+      elements.Append(Element(type, data[1]));
+      Element &el = elements[i];
+      el.rank = data[0];
+
+      if (geom >= 0)
+      {
+         CheckSupportedGeom(type);
+         GI[geom].InitGeom(type);
+
+         const int ref_type = data[3];
+         MFEM_VERIFY(ref_type >= 0 && ref_type < 8, "");
+         el.ref_type = ref_type;
+
+         if (ref_type) // refined element
+         {
+            for (int j = 0; j < ref_type_num_children[ref_type]; j++)
+            {
+               el.child[j] = data[4 + j];
+            }
+            if (Dim == 3 && ref_type != 7) { Iso = false; }
+         }
+         else // leaf element
+         {
+            for (int j = 0; j < GI[geom].nv; j++)
+            {
+               const int id = data[4 + j];
+               el.node[j] = id;
+               nodes.Alloc(id, id, id);
+            }
+         }
+      }
+      else
+      {
+         el.parent = -2; // mark as unused
+         free_element_ids.Append(i);
+      }
+   }
+
+   InitRootElements();
+   InitGeomFlags();
+
+   // load boundary, see LoadBoundary()
+   const int *bdr_data = input.GetData<int>("nc_boundary", size);
+   for (std::size_t i = 0; i < size; i += 2 + MaxFaceNodes)
+   {
+      const int attr = bdr_data[i], geom = bdr_data[i+1];
+      const int *v = bdr_data + i + 2;
+      Face *face = NULL;
+      if (geom == Geometry::SQUARE)
+      {
+         face = faces.Get(v[0], v[1], v[2], v[3]);
+      }
+      else if (geom == Geometry::TRIANGLE)
+      {
+         face = faces.Get(v[0], v[1], v[2]);
+      }
+      else if (geom == Geometry::SEGMENT)
+      {
+         face = faces.Get(v[0], v[0], v[1], v[1]);
+      }
+      else if (geom == Geometry::POINT)
+      {
+         face = faces.Get(v[0], v[0], v[0], v[0]);
+      }
+      else
+      {
+         MFEM_ABORT("unsupported boundary element geometry: " << geom);
+      }
+      face->attribute = attr;
+   }
+
+   // load vertex hierarchy, see LoadVertexParents()
+   const int *parents = input.GetData<int>("nc_vertex_parents", size);
+   const int nvp = int(size/3);
+   const real_t *scales = NULL;
+   if (using_scaling)
+   {
+      scales = input.GetData<real_t>("nc_vertex_scales", size);
+      MFEM_VERIFY(int(size) == nvp, "invalid binary mesh: nc_vertex_scales");
+   }
+   for (int i = 0; i < nvp; i++)
+   {
+      const int id = parents[3*i], p1 = parents[3*i+1], p2 = parents[3*i+2];
+      MFEM_VERIFY(nodes.IdExists(id), "vertex " << id << " not found.");
+      MFEM_VERIFY(nodes.IdExists(p1), "parent " << p1 << " not found.");
+      MFEM_VERIFY(nodes.IdExists(p2), "parent " << p2 << " not found.");
+
+      nodes.Reparent(id, p1, p2);
+      nodes[id].SetScale(scales ? scales[i] : real_t(0.5));
+   }
+
+   // load root states
+   if (input.Has("nc_root_state"))
+   {
+      const int *states = input.GetData<int>("nc_root_state", size);
+      MFEM_VERIFY(int(size) <= root_state.Size(), "Too many root states");
+      for (std::size_t i = 0; i < size; i++) { root_state[i] = states[i]; }
+   }
+
+   // load coordinates, or leave them empty if the mesh is curved
+   spaceDim = input.GetValue<int>("nc_space_dimension");
+   const real_t *coords = input.GetData<real_t>("nc_coordinates", size);
+   coordinates.SetSize(int(size));
+   std::copy(coords, coords + size, coordinates.GetData());
+   MFEM_VERIFY(size == 0 || coordinates.Size() >= 3*CountTopLevelNodes(),
+               "Invalid binary mesh: not all top-level nodes are covered by "
+               "the 'nc_coordinates' section");
+   curved = (size == 0);
+
+   // create edge nodes and faces
+   nodes.UpdateUnused();
+   for (int i = 0; i < elements.Size(); i++)
+   {
+      if (elements[i].IsLeaf())
+      {
+         ReferenceElement(i);
+         RegisterFaces(i);
+      }
+   }
+
+   Update();
+}
+
 void NCMesh::CopyElements(int elem,
                           const BlockArray<Element> &tmp_elements)
 {
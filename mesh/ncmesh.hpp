@@ -113,6 +113,8 @@ struct CoarseFineTransformations
 void Swap(CoarseFineTransformations &a, CoarseFineTransformations &b);
 
 struct MatrixMap; // for internal use
+class BinarySectionWriter;
+class BinarySectionReader;
 
 /** @brief For a NURBS mesh with nonconforming patch topology, this struct
     provides a map from hanging vertices in the patch topology to the knotvector
@@ -202,6 +204,10 @@ public:
        defines a conforming mesh. See Mesh::Loader for details. */
    NCMesh(std::istream &input, int version, int &curved, int &is_nc);
 
+   /** Load from the sections written by PrintBinary(). \param[out] curved is
+       set to 1 if the mesh has no vertex coordinates, i.e. it is curved. */
+   NCMesh(const BinarySectionReader &input, int &curved);
+
    /// Deep copy of another instance.
    NCMesh(const NCMesh &other);
 
@@ -352,10 +358,11 @@ public:
       /// inverse index.
       long MemoryUsage() const;
       ~NCList() { Clear(); }
-   private:
       // Check for existence or construct the inv_index list map if necessary.
-      // const because only modifies the mutable member inv_index.
+      // const because only modifies the mutable member inv_index. Must be
+      // called before the lookup methods above are used concurrently.
       void BuildIndex() const;
+   private:
 
       /// A lazily constructed map from index to MeshId. Built whenever
       /// GetMeshIdAndType, GetMeshIdType or CheckMeshIdType is called for the
@@ -530,6 +537,10 @@ public:
    void Print(std::ostream &out, const std::string &comments = "",
               bool nurbs=false) const;
 
+   /** I/O: Add the refinement tree, boundary, vertex hierarchy and coordinates
+       of the mesh as sections of a binary file, see Mesh::PrintBinary(). */
+   void PrintBinary(BinarySectionWriter &out) const;
+
    /// I/O: Return true if the mesh was loaded from the legacy v1.1 format.
    bool IsLegacyLoaded() const { return Legacy; }
 
@@ -1053,9 +1064,11 @@ protected:
                            int elem, const PointMatrix &pm,
                            PointMatrix &reordered) const;
 
+   // The traversals below append the slave faces/edges they find to 'slaves',
+   // so that they can be used by several threads, see BuildFaceList().
    void TraverseQuadFace(int vn0, int vn1, int vn2, int vn3,
                          const PointMatrix& pm, int level, Face* eface[4],
-                         MatrixMap &matrix_map);
+                         MatrixMap &matrix_map, Array<Slave> &slaves);
    struct TriFaceTraverseResults
    {
       bool unsplit; ///< Whether this face has no further splits.
@@ -1063,11 +1076,12 @@ protected:
    };
    TriFaceTraverseResults TraverseTriFace(int vn0, int vn1, int vn2,
                                           const PointMatrix& pm, int level,
-                                          MatrixMap &matrix_map);
+                                          MatrixMap &matrix_map,
+                                          Array<Slave> &slaves);
    void TraverseTetEdge(int vn0, int vn1, const Point &p0, const Point &p1,
-                        MatrixMap &matrix_map);
+                        MatrixMap &matrix_map, Array<Slave> &slaves);
    void TraverseEdge(int vn0, int vn1, real_t t0, real_t t1, int flags,
-                     int level, MatrixMap &matrix_map);
+                     int level, MatrixMap &matrix_map, Array<Slave> &slaves);
 
    virtual void BuildFaceList();
    virtual void BuildEdgeList();
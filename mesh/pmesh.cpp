@@ -15,13 +15,21 @@
 
 #include "mesh_headers.hpp"
 #include "../fem/fem.hpp"
+#include "../general/annotation.hpp"
+#include "../general/binary_sections.hpp"
 #include "../general/sets.hpp"
 #include "../general/sort_pairs.hpp"
 #include "../general/text.hpp"
 #include "../general/globals.hpp"
 
+#include <array>
 #include <iostream>
 #include <fstream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <tuple>
+#include <unordered_map>
 
 using namespace std;
 
@@ -949,6 +957,7 @@ ParMesh::ParMesh(MPI_Comm comm, istream &input, bool refine, int generate_edges,
 void ParMesh::Load(istream &input, int generate_edges, int refine,
                    bool fix_orientation)
 {
+   MFEM_PERF_SCOPE("ParMesh::Load");
    ParMesh::Destroy();
 
    // Tell Loader() to read up to 'mfem_serial_mesh_end' instead of
@@ -3947,6 +3956,10 @@ void ParMesh::NonconformingRefinement(const Array<Refinement> &refinements,
                  "serial Mesh)");
    }
 
+   // keep the geometric factors, they are updated below
+   Array<GeometricFactors*> old_geom_factors;
+   mfem::Swap(old_geom_factors, geom_factors);
+
    ResetLazyData();
 
    DeleteFaceNbrData();
@@ -3987,6 +4000,8 @@ void ParMesh::NonconformingRefinement(const Array<Refinement> &refinements,
    sequence++;
 
    UpdateNodes();
+
+   UpdateGeometricFactors(old_geom_factors);
 }
 
 bool ParMesh::NonconformingDerefinement(Array<real_t> &elem_error,
@@ -4853,6 +4868,7 @@ bool ParMesh::WantSkipSharedMaster(const NCMesh::Master &master) const
 
 void ParMesh::Print(std::ostream &os, const std::string &comments) const
 {
+   MFEM_PERF_SCOPE("ParMesh::Print");
    int shared_bdr_attr;
    Array<int> nc_shared_faces;
    Array<int> interface_faces;
@@ -6444,6 +6460,31 @@ void ParMesh::GetCharacteristics(real_t &gh_min, real_t &gh_max,
                  MyComm);
 }
 
+MemoryReport ParMesh::GetMemoryReport() const
+{
+   MemoryReport report("ParMesh");
+   report.AddChild(Mesh::GetMemoryReport());
+
+   MemoryReport shared("shared entities");
+   shared.Add(shared_edges.GetMemory()).Add(shared_trias.GetMemory())
+   .Add(shared_quads.GetMemory());
+   shared.Add(svert_lvert.GetMemory()).Add(sedge_ledge.GetMemory())
+   .Add(sface_lface.GetMemory());
+   shared.Add("group_svert", group_svert).Add("group_sedge", group_sedge)
+   .Add("group_stria", group_stria).Add("group_squad", group_squad);
+   report.AddChild(shared);
+
+   MemoryReport face_nbr("face neighbors");
+   face_nbr.Add(face_nbr_group.GetMemory())
+   .Add(face_nbr_elements_offset.GetMemory())
+   .Add(face_nbr_vertices_offset.GetMemory())
+   .Add(face_nbr_elements.GetMemory()).Add(face_nbr_vertices.GetMemory());
+   face_nbr.Add("send_face_nbr_elements", send_face_nbr_elements)
+   .Add("send_face_nbr_vertices", send_face_nbr_vertices);
+   report.AddChild(face_nbr);
+   return report;
+}
+
 void ParMesh::PrintInfo(std::ostream &os)
 {
    int i;
@@ -6567,6 +6608,469 @@ long long ParMesh::ReduceInt(int value) const
    return global;
 }
 
+namespace
+{
+
+// Global vertex numbers of a shared entity candidate, padded with -1
+using RestartKey = std::array<long long, 4>;
+
+// For each of the @a keys present on this rank, return in the row of
+// @a key_ranks the sorted list of all ranks in @a comm that have the same key.
+// The keys are gathered by the "directory" ranks key[0] % nranks which return
+// the rank lists, so that no rank needs to know all keys.
+void FindKeyRanks(MPI_Comm comm, const std::vector<RestartKey> &keys,
+                  Table &key_ranks)
+{
+   int nranks;
+   MPI_Comm_size(comm, &nranks);
+   auto directory = [nranks](const RestartKey &k)
+   { return int(k[0] % nranks); };
+
+   // send the keys to their directory ranks
+   std::vector<int> send_cnt(nranks, 0), send_off(nranks + 1, 0);
+   for (const RestartKey &k : keys) { send_cnt[directory(k)] += 4; }
+   std::partial_sum(send_cnt.begin(), send_cnt.end(), send_off.begin() + 1);
+   std::vector<long long> send_buf(send_off[nranks]);
+   std::vector<int> pos(send_off.begin(), send_off.end() - 1);
+   for (const RestartKey &k : keys)
+   {
+      const int d = directory(k);
+      std::copy(k.begin(), k.end(), send_buf.begin() + pos[d]);
+      pos[d] += 4;
+   }
+
+   std::vector<int> recv_cnt(nranks), recv_off(nranks + 1, 0);
+   MPI_Alltoall(send_cnt.data(), 1, MPI_INT, recv_cnt.data(), 1, MPI_INT,
+                comm);
+   std::partial_sum(recv_cnt.begin(), recv_cnt.end(), recv_off.begin() + 1);
+   std::vector<long long> recv_buf(recv_off[nranks]);
+   MPI_Alltoallv(send_buf.data(), send_cnt.data(), send_off.data(),
+                 MPI_LONG_LONG, recv_buf.data(), recv_cnt.data(),
+                 recv_off.data(), MPI_LONG_LONG, comm);
+
+   // collect the ranks of each key; the sources are visited in rank order, so
+   // the lists are sorted
+   std::map<RestartKey, std::vector<int>> dir;
+   for (int r = 0; r < nranks; r++)
+   {
+      for (int i = recv_off[r]; i < recv_off[r+1]; i += 4)
+      {
+         RestartKey k;
+         std::copy(&recv_buf[i], &recv_buf[i] + 4, k.begin());
+         dir[k].push_back(r);
+      }
+   }
+
+   // reply with [n, rank_1, ..., rank_n] for each received key
+   std::vector<int> reply_cnt(nranks, 0), reply_off(nranks + 1, 0);
+   std::vector<int> reply_buf;
+   for (int r = 0; r < nranks; r++)
+   {
+      for (int i = recv_off[r]; i < recv_off[r+1]; i += 4)
+      {
+         RestartKey k;
+         std::copy(&recv_buf[i], &recv_buf[i] + 4, k.begin());
+         const std::vector<int> &ranks = dir[k];
+         reply_buf.push_back(int(ranks.size()));
+         reply_buf.insert(reply_buf.end(), ranks.begin(), ranks.end());
+         reply_cnt[r] += 1 + int(ranks.size());
+      }
+   }
+   std::partial_sum(reply_cnt.begin(), reply_cnt.end(), reply_off.begin() + 1);
+
+   std::vector<int> answer_cnt(nranks), answer_off(nranks + 1, 0);
+   MPI_Alltoall(reply_cnt.data(), 1, MPI_INT, answer_cnt.data(), 1, MPI_INT,
+                comm);
+   std::partial_sum(answer_cnt.begin(), answer_cnt.end(),
+                    answer_off.begin() + 1);
+   std::vector<int> answer_buf(answer_off[nranks]);
+   MPI_Alltoallv(reply_buf.data(), reply_cnt.data(), reply_off.data(),
+                 MPI_INT, answer_buf.data(), answer_cnt.data(),
+                 answer_off.data(), MPI_INT, comm);
+
+   // the answers of each directory rank come in the order the keys were sent
+   const int nkeys = int(keys.size());
+   std::vector<int> key_pos(nkeys);
+   std::copy(answer_off.begin(), answer_off.end() - 1, pos.begin());
+   for (int i = 0; i < nkeys; i++)
+   {
+      const int d = directory(keys[i]);
+      key_pos[i] = pos[d];
+      pos[d] += 1 + answer_buf[pos[d]];
+   }
+
+   key_ranks.MakeI(nkeys);
+   for (int i = 0; i < nkeys; i++)
+   {
+      key_ranks.AddColumnsInRow(i, answer_buf[key_pos[i]]);
+   }
+   key_ranks.MakeJ();
+   for (int i = 0; i < nkeys; i++)
+   {
+      const int *ranks = &answer_buf[key_pos[i]];
+      key_ranks.AddConnections(i, ranks + 1, ranks[0]);
+   }
+   key_ranks.ShiftUpI();
+}
+
+// Shared entity with its group, global key and local index
+struct RestartSharedEntity
+{
+   int group;
+   RestartKey key;
+   int local;
+   bool operator<(const RestartSharedEntity &other) const
+   {
+      return std::tie(group, key) < std::tie(other.group, other.key);
+   }
+};
+
+} // anonymous namespace
+
+void ParMesh::SaveRestart(const std::string &fname) const
+{
+   MFEM_VERIFY(Conforming() && NURBSext == NULL,
+               "only conforming, non-NURBS meshes are supported");
+
+   Array<HYPRE_BigInt> gvi;
+   GetGlobalVertexIndices(gvi);
+
+   // offsets of the global element numbers of all ranks
+   Array<long long> offsets(NRanks + 1);
+   const long long ne = NumOfElements;
+   offsets[0] = 0;
+   MPI_Allgather(&ne, 1, MPI_LONG_LONG, offsets.GetData() + 1, 1,
+                 MPI_LONG_LONG, MyComm);
+   offsets.PartialSum();
+
+   BinarySectionWriter out;
+   out.AddValue("dimension", Dim);
+   out.AddValue("space_dimension", spaceDim);
+   out.AddValue("curved", Nodes ? 1 : 0);
+   out.Add("element_offsets", offsets);
+
+   Array<int> geom(NumOfElements), attr(NumOfElements), v;
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      geom[i] = elements[i]->GetGeometryType();
+      attr[i] = elements[i]->GetAttribute();
+      v.Append(elements[i]->GetVertices(), elements[i]->GetNVertices());
+   }
+   out.Add("element_geometry", geom);
+   out.Add("element_attributes", attr);
+   out.Add("element_vertices", v);
+
+   // each boundary element is attached to its adjacent local element(s)
+   Array<long long> bdr_owner;
+   Array<int> bdr_geom, bdr_attr, bdr_v;
+   for (int i = 0; i < NumOfBdrElements; i++)
+   {
+      int e1, e2;
+      GetFaceElements(GetBdrElementFaceIndex(i), &e1, &e2);
+      for (int e : {e1, e2})
+      {
+         if (e < 0) { continue; }
+         bdr_owner.Append(offsets[MyRank] + e);
+         bdr_geom.Append(boundary[i]->GetGeometryType());
+         bdr_attr.Append(boundary[i]->GetAttribute());
+         bdr_v.Append(boundary[i]->GetVertices(), boundary[i]->GetNVertices());
+      }
+   }
+   out.Add("boundary_owners", bdr_owner);
+   out.Add("boundary_geometry", bdr_geom);
+   out.Add("boundary_attributes", bdr_attr);
+   out.Add("boundary_vertices", bdr_v);
+
+   Array<long long> vertex_ids(NumOfVertices);
+   for (int i = 0; i < NumOfVertices; i++) { vertex_ids[i] = gvi[i]; }
+   out.Add("vertex_ids", vertex_ids);
+   static_assert(sizeof(Vertex) == 3*sizeof(real_t), "");
+   out.Add("vertex_coordinates",
+           reinterpret_cast<const real_t*>(vertices.GetData()),
+           3*std::size_t(NumOfVertices));
+
+   const std::string name = MakeParFilename(fname + ".", MyRank);
+   ofstream ofs(name, std::ios::binary);
+   MFEM_VERIFY(ofs, "cannot open file " << name);
+   out.Write(ofs, "MFEM restart mesh v1.0");
+   ofs.close();
+
+   if (Nodes)
+   {
+      const ParGridFunction *pnodes = dynamic_cast<ParGridFunction*>(Nodes);
+      MFEM_VERIFY(pnodes, "the mesh nodes must be a ParGridFunction");
+      pnodes->SaveRestart(fname + "_nodes");
+   }
+}
+
+ParMesh ParMesh::LoadRestart(MPI_Comm comm, const std::string &fname)
+{
+   ParMesh mesh;
+   mesh.MyComm = comm;
+   MPI_Comm_size(comm, &mesh.NRanks);
+   MPI_Comm_rank(comm, &mesh.MyRank);
+   mesh.gtopo.SetComm(comm);
+
+   Array<long long> offsets;
+   int curved;
+   {
+      BinarySectionReader input(MakeParFilename(fname + ".", 0));
+      MFEM_VERIFY(input.GetType() == "MFEM restart mesh v1.0",
+                  "invalid restart mesh file: " << fname);
+      mesh.Dim = input.GetValue<int>("dimension");
+      mesh.spaceDim = input.GetValue<int>("space_dimension");
+      curved = input.GetValue<int>("curved");
+      std::size_t size;
+      const long long *off = input.GetData<long long>("element_offsets", size);
+      offsets.SetSize(int(size));
+      std::copy(off, off + size, offsets.GetData());
+   }
+
+   // this rank reads the global elements [first,last)
+   const int num_files = offsets.Size() - 1;
+   const long long num_elems = offsets[num_files];
+   const long long first = num_elems*mesh.MyRank/mesh.NRanks;
+   const long long last = num_elems*(mesh.MyRank + 1)/mesh.NRanks;
+
+   std::unordered_map<long long, int> vert_local;
+   Array<long long> vert_global;
+   auto local_vertex = [&](long long gv, const real_t *x)
+   {
+      auto it = vert_local.emplace(gv, vert_global.Size());
+      if (it.second)
+      {
+         mesh.vertices.Append(Vertex());
+         mesh.vertices.Last().SetCoords(3, x);
+         vert_global.Append(gv);
+      }
+      return it.first->second;
+   };
+
+   std::set<RestartKey> bdr_keys;
+   Array<int> lv;
+   for (int f = 0; f < num_files; f++)
+   {
+      if (offsets[f+1] <= first || offsets[f] >= last) { continue; }
+
+      BinarySectionReader input(MakeParFilename(fname + ".", f));
+      std::size_t ne, nv, size;
+      const int *geom = input.GetData<int>("element_geometry", ne);
+      const int *attr = input.GetData<int>("element_attributes", size);
+      const int *v = input.GetData<int>("element_vertices", size);
+      const long long *vid = input.GetData<long long>("vertex_ids", nv);
+      const real_t *x = input.GetData<real_t>("vertex_coordinates", size);
+      MFEM_VERIFY(offsets[f] + (long long)ne == offsets[f+1],
+                  "inconsistent restart mesh file " << f);
+
+      for (std::size_t k = 0; k < ne; v += Geometry::NumVerts[geom[k]], k++)
+      {
+         const long long e = offsets[f] + (long long)k;
+         if (e < first || e >= last) { continue; }
+
+         Element *el = mesh.NewElement(geom[k]);
+         lv.SetSize(el->GetNVertices());
+         for (int j = 0; j < lv.Size(); j++)
+         {
+            lv[j] = local_vertex(vid[v[j]], x + 3*v[j]);
+         }
+         el->SetVertices(lv);
+         el->SetAttribute(attr[k]);
+         mesh.elements.Append(el);
+      }
+
+      // the boundary elements of the elements read from this file, skipping
+      // the second copy of interior boundary elements
+      std::size_t nb;
+      const long long *owner = input.GetData<long long>("boundary_owners", nb);
+      const int *bgeom = input.GetData<int>("boundary_geometry", size);
+      const int *battr = input.GetData<int>("boundary_attributes", size);
+      const int *bv = input.GetData<int>("boundary_vertices", size);
+      for (std::size_t k = 0; k < nb; bv += Geometry::NumVerts[bgeom[k]], k++)
+      {
+         if (owner[k] < first || owner[k] >= last) { continue; }
+
+         const int bnv = Geometry::NumVerts[bgeom[k]];
+         RestartKey key = {-1, -1, -1, -1};
+         for (int j = 0; j < bnv; j++) { key[j] = vid[bv[j]]; }
+         std::sort(key.begin(), key.begin() + bnv);
+         if (!bdr_keys.insert(key).second) { continue; }
+
+         Element *be = mesh.NewElement(bgeom[k]);
+         lv.SetSize(bnv);
+         for (int j = 0; j < bnv; j++)
+         {
+            lv[j] = local_vertex(vid[bv[j]], x + 3*bv[j]);
+         }
+         be->SetVertices(lv);
+         be->SetAttribute(battr[k]);
+         mesh.boundary.Append(be);
+      }
+   }
+   mesh.NumOfVertices = mesh.vertices.Size();
+   mesh.NumOfElements = mesh.elements.Size();
+   mesh.NumOfBdrElements = mesh.boundary.Size();
+
+   // don't generate any boundary elements, see Mesh::Loader()
+   mesh.FinalizeTopology(false);
+   mesh.ReduceMeshGen();
+
+   // find the ranks sharing each vertex
+   std::vector<RestartKey> keys(mesh.NumOfVertices);
+   for (int i = 0; i < mesh.NumOfVertices; i++)
+   {
+      keys[i] = {vert_global[i], -1, -1, -1};
+   }
+   Table vert_ranks;
+   FindKeyRanks(comm, keys, vert_ranks);
+
+   // edges and faces can only be shared if all their vertices are shared
+   auto all_shared = [&](const Array<int> &verts, RestartKey &key)
+   {
+      key = {-1, -1, -1, -1};
+      for (int j = 0; j < verts.Size(); j++)
+      {
+         if (vert_ranks.RowSize(verts[j]) < 2) { return false; }
+         key[j] = vert_global[verts[j]];
+      }
+      std::sort(key.begin(), key.begin() + verts.Size());
+      return true;
+   };
+   keys.clear();
+   std::vector<int> cand_edges, cand_faces;
+   Array<int> verts;
+   RestartKey key;
+   if (mesh.Dim >= 2)
+   {
+      for (int i = 0; i < mesh.GetNEdges(); i++)
+      {
+         mesh.GetEdgeVertices(i, verts);
+         if (!all_shared(verts, key)) { continue; }
+         keys.push_back(key);
+         cand_edges.push_back(i);
+      }
+   }
+   if (mesh.Dim == 3)
+   {
+      for (int i = 0; i < mesh.GetNFaces(); i++)
+      {
+         mesh.GetFaceVertices(i, verts);
+         if (!all_shared(verts, key)) { continue; }
+         keys.push_back(key);
+         cand_faces.push_back(i);
+      }
+   }
+   Table cand_ranks;
+   FindKeyRanks(comm, keys, cand_ranks);
+
+   // build the groups and sort the shared entities of each group by their
+   // global keys, which gives the same order on all ranks of the group
+   ListOfIntegerSets groups;
+   IntegerSet group;
+   group.Recreate(1, &mesh.MyRank);
+   groups.Insert(group);
+
+   std::vector<RestartSharedEntity> sverts, sedges, sfaces;
+   for (int i = 0; i < mesh.NumOfVertices; i++)
+   {
+      if (vert_ranks.RowSize(i) < 2) { continue; }
+      group.Recreate(vert_ranks.RowSize(i), vert_ranks.GetRow(i));
+      sverts.push_back({groups.Insert(group), {vert_global[i], -1, -1, -1}, i});
+   }
+   const int nce = int(cand_edges.size());
+   for (int i = 0; i < int(keys.size()); i++)
+   {
+      if (cand_ranks.RowSize(i) < 2) { continue; }
+      group.Recreate(cand_ranks.RowSize(i), cand_ranks.GetRow(i));
+      auto &list = (i < nce) ? sedges : sfaces;
+      const int local = (i < nce) ? cand_edges[i] : cand_faces[i - nce];
+      list.push_back({groups.Insert(group), keys[i], local});
+   }
+   std::sort(sverts.begin(), sverts.end());
+   std::sort(sedges.begin(), sedges.end());
+   std::sort(sfaces.begin(), sfaces.end());
+
+   mesh.gtopo.Create(groups, 822);
+   const int ngroups = groups.Size() - 1;
+
+   mesh.group_svert.MakeI(ngroups);
+   for (const auto &s : sverts) { mesh.group_svert.AddAColumnInRow(s.group-1); }
+   mesh.group_svert.MakeJ();
+   mesh.svert_lvert.SetSize(int(sverts.size()));
+   for (int i = 0; i < int(sverts.size()); i++)
+   {
+      mesh.group_svert.AddConnection(sverts[i].group-1, i);
+      mesh.svert_lvert[i] = sverts[i].local;
+   }
+   mesh.group_svert.ShiftUpI();
+
+   // shared edges are oriented by increasing global vertex numbers
+   mesh.group_sedge.MakeI(ngroups);
+   for (const auto &s : sedges) { mesh.group_sedge.AddAColumnInRow(s.group-1); }
+   mesh.group_sedge.MakeJ();
+   for (int i = 0; i < int(sedges.size()); i++)
+   {
+      mesh.group_sedge.AddConnection(sedges[i].group-1, i);
+      mesh.GetEdgeVertices(sedges[i].local, verts);
+      if (vert_global[verts[0]] > vert_global[verts[1]])
+      {
+         std::swap(verts[0], verts[1]);
+      }
+      mesh.shared_edges.Append(new Segment(verts[0], verts[1], 1));
+   }
+   mesh.group_sedge.ShiftUpI();
+
+   // shared faces start at their smallest global vertex and continue towards
+   // the smaller of its two neighbors
+   mesh.group_stria.MakeI(ngroups);
+   mesh.group_squad.MakeI(ngroups);
+   for (const auto &s : sfaces)
+   {
+      const bool tri = (s.key[3] < 0);
+      (tri ? mesh.group_stria : mesh.group_squad).AddAColumnInRow(s.group-1);
+   }
+   mesh.group_stria.MakeJ();
+   mesh.group_squad.MakeJ();
+   for (const auto &s : sfaces)
+   {
+      mesh.GetFaceVertices(s.local, verts);
+      const int n = verts.Size();
+      int p = 0;
+      for (int j = 1; j < n; j++)
+      {
+         if (vert_global[verts[j]] < vert_global[verts[p]]) { p = j; }
+      }
+      const long long next = vert_global[verts[(p+1)%n]];
+      const long long prev = vert_global[verts[(p+n-1)%n]];
+      const int dir = (next < prev) ? 1 : n-1;
+      int fv[4];
+      for (int j = 0; j < n; j++) { fv[j] = verts[(p + j*dir)%n]; }
+      if (n == 3)
+      {
+         mesh.group_stria.AddConnection(s.group-1, mesh.shared_trias.Size());
+         mesh.shared_trias.Append(Vert3(fv[0], fv[1], fv[2]));
+      }
+      else
+      {
+         mesh.group_squad.AddConnection(s.group-1, mesh.shared_quads.Size());
+         mesh.shared_quads.Append(Vert4(fv[0], fv[1], fv[2], fv[3]));
+      }
+   }
+   mesh.group_stria.ShiftUpI();
+   mesh.group_squad.ShiftUpI();
+
+   // keep the element vertex order, the element-wise dof values of the grid
+   // functions depend on it
+   mesh.Finalize(false, false);
+
+   if (curved)
+   {
+      auto nodes = ParGridFunction::LoadRestart(&mesh, fname + "_nodes");
+      mesh.NewNodes(*nodes.release(), true);
+   }
+
+   return mesh;
+}
+
 void ParMesh::ParPrint(ostream &os, const std::string &comments) const
 {
    if (NURBSext)
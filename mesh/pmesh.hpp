@@ -392,6 +392,22 @@ public:
        See @a Mesh::MakeSimplicial for more details. */
    static ParMesh MakeSimplicial(ParMesh &orig_mesh);
 
+   /** @brief Load a mesh saved with SaveRestart() on any number of MPI ranks,
+       possibly different from the number of ranks in @a comm.
+
+       Each rank reads a contiguous range of the global elements, in the order
+       of the saved ranks, from the files that contain it, and the shared
+       vertices, edges and faces are determined from the global vertex numbers
+       of the saved mesh. The files are read directly, without a serial mesh.
+       If the mesh was curved, its nodes are restored as well.
+
+       The elements are not repartitioned: the ranges balance the number of
+       elements, but the parts are only as compact as the saved element order,
+       i.e. the concatenation of the saved parts. When the number of ranks
+       changes, the new parts may therefore span several saved parts and have
+       larger interfaces than a partitioning of the mesh would give. */
+   static ParMesh LoadRestart(MPI_Comm comm, const std::string &fname);
+
    void Finalize(bool refine = false, bool fix_orientation = false) override;
 
    void SetAttributes(bool elem_attrs_changed = true,
@@ -728,6 +744,16 @@ public:
        begin with '#'. */
    void ParPrint(std::ostream &out, const std::string &comments = "") const;
 
+   /** @brief Save the mesh for a restart with LoadRestart(), possibly on a
+       different number of MPI ranks.
+
+       Each rank writes the binary file "<fname>.<rank>", see MakeParFilename(),
+       with its elements, boundary elements and the global numbers of its
+       vertices. The nodes of a curved mesh are saved with
+       ParGridFunction::SaveRestart() as "<fname>_nodes". Only conforming
+       meshes are supported and the attribute sets are not saved. */
+   void SaveRestart(const std::string &fname) const;
+
    /** @brief Enable Print() and PrintAsOne() to add the parallel interface as
        boundary (typically used for visualization purposes).
 
@@ -838,6 +864,10 @@ public:
    /// Print various parallel mesh stats
    void PrintInfo(std::ostream &out = mfem::out) override;
 
+   /** @brief Return a report of the memory held by the local mesh and by the
+       shared entities and face-neighbor data. */
+   MemoryReport GetMemoryReport() const override;
+
    int FindPoints(DenseMatrix& point_mat, Array<int>& elem_ids,
                   Array<IntegrationPoint>& ips, bool warn = true,
                   InverseElementTransformation *inv_trans = NULL) override;
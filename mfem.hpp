@@ -22,11 +22,13 @@
 #include "general/sets.hpp"
 #include "general/hash.hpp"
 #include "general/mem_alloc.hpp"
+#include "general/mem_report.hpp"
 #include "general/sort_pairs.hpp"
 #include "general/stable3d.hpp"
 #include "general/table.hpp"
 #include "general/tic_toc.hpp"
 #include "general/annotation.hpp"
+#include "general/region_timer.hpp"
 #ifdef MFEM_USE_ADIOS2
 #include "general/adios2stream.hpp"
 #endif // MFEM_USE_ADIOS2
@@ -35,6 +37,7 @@
 #include "general/socketstream.hpp"
 #include "general/optparser.hpp"
 #include "general/zstr.hpp"
+#include "general/binary_sections.hpp"
 #include "general/version.hpp"
 #include "general/globals.hpp"
 #include "general/kdtree.hpp"
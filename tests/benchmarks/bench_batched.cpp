@@ -0,0 +1,115 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+/*
+  This benchmark compares the NATIVE and SIMD backends of BatchedLinAlg on a
+  batch of small dense matrices, of the sizes of the element matrices of low
+  order H1 and L2 spaces:
+
+   * Mult:     y = A x, with one right-hand side,
+   * LUFactor: LU factorization with partial pivoting,
+   * LUSolve:  solve with the LU factors, with one right-hand side,
+   * Invert:   A <- A^{-1}.
+
+   * --benchmark_filter=[Mult/LUFactor/LUSolve/Invert]_[Native/SIMD]/[size]
+*/
+
+// The total number of matrix entries in the batch
+const int batch_entries = 1024*1024;
+
+struct Batch
+{
+   const int m, n_mat;
+   const BatchedLinAlgBase &backend;
+   DenseTensor A, A0, LU;
+   Array<int> P;
+   Vector x, y;
+
+   Batch(int m, BatchedLinAlg::Backend b):
+      m(m),
+      n_mat(batch_entries/(m*m)),
+      backend(BatchedLinAlg::Get(b)),
+      A(m, m, n_mat),
+      x(m*n_mat),
+      y(m*n_mat)
+   {
+      Vector A_vec(A.Data(), A.TotalSize());
+      A_vec.Randomize(1);
+      A_vec -= 0.5;
+      x.Randomize(2);
+      A0 = A;
+      LU = A;
+      backend.LUFactor(LU, P);
+   }
+
+   void Mult() { backend.Mult(A, x, y); }
+
+   void LUFactor()
+   {
+      A = A0;
+      backend.LUFactor(A, P);
+   }
+
+   void LUSolve()
+   {
+      y = x;
+      backend.LUSolve(LU, P, y);
+   }
+
+   void Invert()
+   {
+      A = A0;
+      backend.Invert(A);
+   }
+};
+
+/// The sizes of the matrices
+#define SIZES {{3, 4, 8, 9, 16, 27}}
+
+/// Kernels definitions and registrations
+#define Benchmark(Op, Name, Backend)\
+static void Op##_##Name(bm::State &state){\
+   Batch batch(state.range(0), Backend);\
+   while (state.KeepRunning()) { batch.Op(); }\
+   bm::Counter::Flags invrt_rate = bm::Counter::kIsIterationInvariantRate;\
+   state.counters["Mmat/s"] = bm::Counter(1e-6*batch.n_mat, invrt_rate);\
+}\
+BENCHMARK(Op##_##Name)\
+            -> ArgsProduct(SIZES)\
+            -> Unit(bm::kMicrosecond);
+
+Benchmark(Mult, Native, BatchedLinAlg::NATIVE)
+Benchmark(Mult, SIMD, BatchedLinAlg::SIMD)
+Benchmark(LUFactor, Native, BatchedLinAlg::NATIVE)
+Benchmark(LUFactor, SIMD, BatchedLinAlg::SIMD)
+Benchmark(LUSolve, Native, BatchedLinAlg::NATIVE)
+Benchmark(LUSolve, SIMD, BatchedLinAlg::SIMD)
+Benchmark(Invert, Native, BatchedLinAlg::NATIVE)
+Benchmark(Invert, SIMD, BatchedLinAlg::SIMD)
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=LUFactor_SIMD/8
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
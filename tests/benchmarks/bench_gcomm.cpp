@@ -0,0 +1,132 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#if defined(MFEM_USE_BENCHMARK) && defined(MFEM_USE_MPI)
+
+/*
+  This benchmark measures the latency of one exchange of the GroupCommunicator
+  of an H1 ParFiniteElementSpace on a Cartesian hex mesh, for the different
+  communication modes:
+
+   * Group:       GroupCommunicator::byGroup,
+   * Neighbor:    GroupCommunicator::byNeighbor,
+   * Persistent:  GroupCommunicator::byNeighborPersistent,
+   * Collective:  GroupCommunicator::byNeighborCollective.
+
+  The exchanges are Bcast (as in the prolongation P) and Reduce (as in P^T).
+  All the ranks run the same number of iterations, the reported time is the
+  time of one exchange on the root rank. Run with e.g.:
+
+   mpirun -np 8 bench_gcomm
+
+   * --benchmark_filter=[Bcast/Reduce]_[Group/Neighbor/Persistent/Collective]
+                        /[order]/[side]
+*/
+
+/// The number of exchanges of each measurement, identical on all the ranks
+const int num_exchanges = 1000;
+
+struct Exchange
+{
+   const int p, N, dim = 3;
+   Mesh mesh;
+   ParMesh pmesh;
+   H1_FECollection fec;
+   ParFiniteElementSpace pfes;
+   GroupCommunicator &gc;
+   Vector x;
+
+   Exchange(int p, int N, GroupCommunicator::Mode mode):
+      p(p),
+      N(N),
+      mesh(Mesh::MakeCartesian3D(N, N, N, Element::HEXAHEDRON)),
+      pmesh(MPI_COMM_WORLD, mesh),
+      fec(p, dim),
+      pfes(&pmesh, &fec),
+      gc(pfes.GroupComm()),
+      x(pfes.GetVSize())
+   {
+      gc.SetMode(mode);
+      x.Randomize(1);
+      // the persistent requests and the neighbor communicator are created at
+      // the first exchange, which is not measured
+      Bcast();
+      Reduce();
+   }
+
+   void Bcast() { gc.Bcast<real_t>(x.HostReadWrite()); }
+
+   // Max gives the same messages as Sum, without growing the values
+   void Reduce()
+   {
+      gc.Reduce<real_t>(x.HostReadWrite(), GroupCommunicator::Max);
+   }
+};
+
+/// The different orders the tests can run
+#define P_ORDERS {1,2,3}
+
+/// The different sides of the cartesian 3D mesh
+#define N_SIDES {8,16}
+
+/// Kernels definitions and registrations
+#define Benchmark(Op, Name, Mode)\
+static void Op##_##Name(bm::State &state){\
+   const int p = state.range(0);\
+   const int side = state.range(1);\
+   Exchange ex(p, side, Mode);\
+   MPI_Barrier(MPI_COMM_WORLD);\
+   while (state.KeepRunning()) { ex.Op(); }\
+   state.counters["dofs"] = bm::Counter(ex.pfes.GlobalVSize());\
+   state.counters["p"] = bm::Counter(p);\
+}\
+BENCHMARK(Op##_##Name)\
+            -> ArgsProduct({P_ORDERS, N_SIDES})\
+            -> Iterations(num_exchanges)\
+            -> UseRealTime()\
+            -> Unit(bm::kMicrosecond);
+
+Benchmark(Bcast, Group, GroupCommunicator::byGroup)
+Benchmark(Bcast, Neighbor, GroupCommunicator::byNeighbor)
+Benchmark(Bcast, Persistent, GroupCommunicator::byNeighborPersistent)
+Benchmark(Bcast, Collective, GroupCommunicator::byNeighborCollective)
+Benchmark(Reduce, Group, GroupCommunicator::byGroup)
+Benchmark(Reduce, Neighbor, GroupCommunicator::byNeighbor)
+Benchmark(Reduce, Persistent, GroupCommunicator::byNeighborPersistent)
+Benchmark(Reduce, Collective, GroupCommunicator::byNeighborCollective)
+
+/// Reporter of the non-root ranks
+class NullReporter : public bm::BenchmarkReporter
+{
+public:
+   bool ReportContext(const Context &) override { return true; }
+   void ReportRuns(const std::vector<Run> &) override { }
+};
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=Bcast_Persistent/2/16
+ */
+int main(int argc, char *argv[])
+{
+   Mpi::Init(argc, argv);
+   bm::ConsoleReporter CR;
+   NullReporter NR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   if (Mpi::Root()) { bm::RunSpecifiedBenchmarks(&CR); }
+   else { bm::RunSpecifiedBenchmarks(&NR); }
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK && MFEM_USE_MPI
@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+#include <thread>
+#include <vector>
+
+/*
+  This benchmark measures the find-or-insert rate of the hash tables used by
+  NCMesh for its nodes and faces, when inserting the faces of a structured grid
+  of hexahedra, each face being requested twice as in NCMesh:
+
+   * Serial:     HashTable::GetId() on one thread,
+   * Concurrent: ConcurrentHashTable::GetId() on the given number of threads,
+                 each thread inserting the faces of a slab of the grid.
+
+   * --benchmark_filter=[Serial/Concurrent]/[side]/[threads]
+*/
+
+struct Face : public Hashed4 { };
+
+// Insert the faces of the hexahedra of the slabs [k0, k1) of the side^3 grid.
+template <typename Table>
+static void InsertFaces(Table &table, int side, int k0, int k1)
+{
+   const int n = side + 1;
+   auto v = [n](int i, int j, int k) { return i + n*(j + n*k); };
+   for (int k = k0; k < k1; k++)
+   {
+      for (int j = 0; j < side; j++)
+      {
+         for (int i = 0; i < side; i++)
+         {
+            for (int d = 0; d < 2; d++)
+            {
+               table.GetId(v(i+d, j, k), v(i+d, j+1, k),
+                           v(i+d, j+1, k+1), v(i+d, j, k+1));
+               table.GetId(v(i, j+d, k), v(i+1, j+d, k),
+                           v(i+1, j+d, k+1), v(i, j+d, k+1));
+               table.GetId(v(i, j, k+d), v(i+1, j, k+d),
+                           v(i+1, j+1, k+d), v(i, j+1, k+d));
+            }
+         }
+      }
+   }
+}
+
+static void Serial(bm::State &state)
+{
+   const int side = state.range(0);
+   while (state.KeepRunning())
+   {
+      HashTable<Face> table;
+      InsertFaces(table, side, 0, side);
+   }
+   const double lookups = 6.0*side*side*side;
+   bm::Counter::Flags invrt_rate = bm::Counter::kIsIterationInvariantRate;
+   state.counters["Mlookups/s"] = bm::Counter(1e-6*lookups, invrt_rate);
+}
+BENCHMARK(Serial)
+            -> Args({32, 1})
+            -> Args({64, 1})
+            -> Unit(bm::kMillisecond);
+
+static void Concurrent(bm::State &state)
+{
+   const int side = state.range(0);
+   const int num_threads = state.range(1);
+   while (state.KeepRunning())
+   {
+      ConcurrentHashTable<Face> table;
+      std::vector<std::thread> threads;
+      for (int t = 0; t < num_threads; t++)
+      {
+         threads.emplace_back([&, t]()
+         {
+            InsertFaces(table, side, t*side/num_threads,
+                        (t+1)*side/num_threads);
+         });
+      }
+      for (std::thread &th : threads) { th.join(); }
+   }
+   const double lookups = 6.0*side*side*side;
+   bm::Counter::Flags invrt_rate = bm::Counter::kIsIterationInvariantRate;
+   state.counters["Mlookups/s"] = bm::Counter(1e-6*lookups, invrt_rate);
+}
+BENCHMARK(Concurrent)
+            -> ArgsProduct({{32, 64}, {1, 2, 4}})
+            -> Unit(bm::kMillisecond)
+            -> UseRealTime();
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=Concurrent/64/4
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -0,0 +1,140 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+/*
+  This benchmark measures the effect of the element and dof ordering on the
+  memory bandwidth of ElementRestriction::Mult and MultTranspose, for an H1
+  space on a Cartesian hex mesh whose elements are first shuffled, to mimic the
+  ordering of an unstructured mesh generator:
+
+   * Random:      the shuffled elements, with the natural dof numbering,
+   * Morton:      the elements reordered along the Morton curve,
+   * Hilbert:     the elements reordered along the Hilbert curve,
+   * HilbertDofs: as Hilbert, with the dofs renumbered in element order by
+                  FiniteElementSpace::ReorderElementToDofTable().
+
+   * --benchmark_filter=[Random/Morton/Hilbert/HilbertDofs]/[order]/[side]
+*/
+
+// The maximum number of dofs for benchmarking
+const int max_dofs = 4*1024*1024;
+
+enum class SFCOrdering { RANDOM, MORTON, HILBERT, HILBERT_DOFS };
+
+struct Restriction
+{
+   const int p, N, dim = 3;
+   Mesh mesh;
+   H1_FECollection fec;
+   std::unique_ptr<FiniteElementSpace> fes;
+   const Operator *R = nullptr;
+   Vector x, y;
+   double bytes = 0.0;
+
+   Restriction(int p, int N, SFCOrdering type):
+      p(p),
+      N(N),
+      mesh(Mesh::MakeCartesian3D(N, N, N, Element::HEXAHEDRON)),
+      fec(p, dim)
+   {
+      Array<int> ordering(mesh.GetNE());
+      std::iota(ordering.begin(), ordering.end(), 0);
+      std::shuffle(ordering.begin(), ordering.end(), std::mt19937(1));
+      mesh.ReorderElements(ordering);
+
+      if (type == SFCOrdering::MORTON)
+      {
+         mesh.GetMortonElementOrdering(ordering);
+         mesh.ReorderElements(ordering);
+      }
+      else if (type != SFCOrdering::RANDOM)
+      {
+         mesh.GetHilbertElementOrdering(ordering);
+         mesh.ReorderElements(ordering);
+      }
+
+      fes.reset(new FiniteElementSpace(&mesh, &fec));
+      if (fes->GetVSize() > max_dofs) { return; }
+      if (type == SFCOrdering::HILBERT_DOFS)
+      {
+         fes->ReorderElementToDofTable();
+      }
+
+      R = fes->GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
+      x.SetSize(R->Width());
+      y.SetSize(R->Height());
+      x.Randomize(1);
+
+      // the L-vector and the E-vector are read and written once by each of
+      // Mult and MultTranspose, which also read the E-vector indices
+      bytes = 2.0*(sizeof(real_t)*(R->Width() + R->Height()) +
+                   sizeof(int)*R->Height());
+   }
+
+   int Dofs() const { return fes->GetVSize(); }
+
+   void Apply()
+   {
+      R->Mult(x, y);
+      R->MultTranspose(y, x);
+   }
+};
+
+/// The different orders the tests can run
+#define P_ORDERS bm::CreateDenseRange(1,4,1)
+
+/// The different sides of the cartesian 3D mesh
+#define N_SIDES bm::CreateDenseRange(8,32,8)
+
+/// Kernels definitions and registrations
+#define Benchmark(Name, Type)\
+static void Name(bm::State &state){\
+   const int p = state.range(0);\
+   const int side = state.range(1);\
+   Restriction r(p, side, Type);\
+   if (r.Dofs() > max_dofs) { state.SkipWithError("max_dofs"); return; }\
+   while (state.KeepRunning()) { r.Apply(); }\
+   bm::Counter::Flags invrt_rate = bm::Counter::kIsIterationInvariantRate;\
+   state.counters["GB/s"] = bm::Counter(1e-9*r.bytes, invrt_rate);\
+   state.counters["dofs"] = bm::Counter(r.Dofs());\
+   state.counters["p"] = bm::Counter(p);\
+}\
+BENCHMARK(Name)\
+            -> ArgsProduct({P_ORDERS, N_SIDES})\
+            -> Unit(bm::kMicrosecond);
+
+Benchmark(Random, SFCOrdering::RANDOM)
+Benchmark(Morton, SFCOrdering::MORTON)
+Benchmark(Hilbert, SFCOrdering::HILBERT)
+Benchmark(HilbertDofs, SFCOrdering::HILBERT_DOFS)
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=HilbertDofs/3/16
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -0,0 +1,104 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+/*
+  This benchmark compares the sparse matrix-vector product with the CSR format
+  of SparseMatrix and with the SELL-C-sigma format of SellCSparseMatrix, for
+  the assembled H1 diffusion matrix on a Cartesian hex mesh.
+
+   * --benchmark_filter=[CSR/SELLC]/[order]/[mesh side]
+*/
+
+// The maximum number of dofs for benchmarking
+const int max_dofs = 4*1024*1024;
+
+struct SpMV
+{
+   const int p, N, dim = 3;
+   Mesh mesh;
+   H1_FECollection fec;
+   FiniteElementSpace fes;
+   const int dofs;
+   BilinearForm a;
+   std::unique_ptr<SellCSparseMatrix> S;
+   Vector x, y;
+   double mdofs;
+
+   SpMV(int p, int N):
+      p(p),
+      N(N),
+      mesh(Mesh::MakeCartesian3D(N, N, N, Element::HEXAHEDRON)),
+      fec(p, dim),
+      fes(&mesh, &fec),
+      dofs(fes.GetVSize()),
+      a(&fes),
+      x(dofs),
+      y(dofs),
+      mdofs(0.0)
+   {
+      if (dofs > max_dofs) { return; }
+      a.AddDomainIntegrator(new DiffusionIntegrator);
+      a.UsePrecomputedSparsity();
+      a.Assemble();
+      a.Finalize();
+      S.reset(new SellCSparseMatrix(a.SpMat()));
+      x.Randomize(1);
+   }
+
+   void CSR() { a.SpMat().Mult(x, y); mdofs += 1e-6*dofs; }
+
+   void SELLC() { S->Mult(x, y); mdofs += 1e-6*dofs; }
+};
+
+/// The different orders the tests can run
+#define P_ORDERS bm::CreateDenseRange(1,4,1)
+
+/// The different sides of the cartesian 3D mesh
+#define N_SIDES bm::CreateDenseRange(4,24,4)
+
+/// Kernels definitions and registrations
+#define Benchmark(Format)\
+static void Format(bm::State &state){\
+   const int p = state.range(0);\
+   const int side = state.range(1);\
+   SpMV spmv(p, side);\
+   if (spmv.dofs > max_dofs) { state.SkipWithError("max_dofs"); return; }\
+   while (state.KeepRunning()) { spmv.Format(); }\
+   bm::Counter::Flags invrt_rate = bm::Counter::kIsIterationInvariantRate;\
+   state.counters["MDof"] = bm::Counter(1e-6*spmv.dofs, invrt_rate);\
+   state.counters["dofs"] = bm::Counter(spmv.dofs);\
+   state.counters["p"] = bm::Counter(p);\
+}\
+BENCHMARK(Format)\
+            -> ArgsProduct({P_ORDERS, N_SIDES})\
+            -> Unit(bm::kMicrosecond);
+
+Benchmark(CSR)
+Benchmark(SELLC)
+
+/**
+ * @brief main entry point
+ * --benchmark_filter=SELLC/3/16
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -33,6 +33,7 @@ using DOperator = DifferentiableOperator;
 template <int DIM> struct Diffusion
 {
    using dvecd_t = tensor<dscalar_t, DIM>;
+   using vecd_t = tensor<real_t, DIM>;
    using matd_t = tensor<real_t, DIM, DIM>;
 
    struct MFApply
@@ -47,6 +48,44 @@ template <int DIM> struct Diffusion
       }
    };
 
+   // Same as MFApply, differentiable with respect to rho
+   struct MFApplyRho
+   {
+      MFEM_HOST_DEVICE inline auto operator()(const vecd_t &dudxi,
+                                              const dscalar_t &rho,
+                                              const matd_t &J,
+                                              const real_t &w) const
+      {
+         const auto invJ = inv(J), TinJ = transpose(invJ);
+         return tuple{ (dudxi * invJ) * TinJ * det(J) * w * rho };
+      }
+   };
+
+   // Nonlinear diffusion (1 + u^2) grad(u), with a non-symmetric Jacobian
+   struct MFApplyNonlinear
+   {
+      MFEM_HOST_DEVICE inline auto operator()(const dscalar_t &u,
+                                              const dvecd_t &dudxi,
+                                              const matd_t &J,
+                                              const real_t &w) const
+      {
+         const auto invJ = inv(J), TinJ = transpose(invJ);
+         return tuple{ (1.0 + u * u) * ((dudxi * invJ) * TinJ * det(J) * w) };
+      }
+   };
+
+   // Scalar quantity of interest 1/2 int rho u^2, with gradient M_rho u
+   struct MFEnergy
+   {
+      MFEM_HOST_DEVICE inline auto operator()(const dscalar_t &u,
+                                              const real_t &rho,
+                                              const matd_t &J,
+                                              const real_t &w) const
+      {
+         return tuple{ 0.5 * rho * u * u * det(J) * w };
+      }
+   };
+
    struct PASetup
    {
       MFEM_HOST_DEVICE inline auto operator()(const real_t u,
@@ -227,6 +266,133 @@ void diffusion(const char *filename, int p)
       MPI_Barrier(MPI_COMM_WORLD);
    }
 
+   SECTION("action linearized transpose")
+   {
+      DOperator dop_mf(sol, {{Rho, &rho_ps}, {Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFApply mf_apply_qf;
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop_mf.AddDomainIntegrator(mf_apply_qf,
+                                 tuple{ Gradient<U>{}, Identity<Rho>{},
+                                        Gradient<Coords>{}, Weight{} },
+                                 tuple{ Gradient<U>{} }, *ir,
+                                 all_domain_attr, derivatives);
+      dop_mf.SetParameters({ &rho_coeff_cv, nodes });
+
+      blf_fa.Mult(x, y);
+      pfes.GetProlongationMatrix()->MultTranspose(y, Y);
+      pfes.GetRestrictionMatrix()->Mult(x, X);
+
+      real_t norm_global = 0.0, norm_local = 0.0;
+
+      auto dRdU = dop_mf.GetDerivative(U, {&x}, {&rho_coeff_cv, nodes});
+      dRdU->MultTranspose(X, Z);
+      Z -= Y;
+      norm_local = Z.Normlinf();
+      MPI_Allreduce(&norm_local, &norm_global, 1, MPI_DOUBLE, MPI_MAX,
+                    pmesh.GetComm());
+      REQUIRE(norm_global == MFEM_Approx(0.0));
+
+      dop_mf.MultTransposeDerivative(U, {&x}, {&rho_coeff_cv, nodes}, X, Z);
+      Z -= Y;
+      norm_local = Z.Normlinf();
+      MPI_Allreduce(&norm_local, &norm_global, 1, MPI_DOUBLE, MPI_MAX,
+                    pmesh.GetComm());
+      REQUIRE(norm_global == MFEM_Approx(0.0));
+      MPI_Barrier(MPI_COMM_WORLD);
+   }
+
+   SECTION("action linearized transpose nonsymmetric")
+   {
+      DOperator dop_mf(sol, {{Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFApplyNonlinear mf_nonlinear_qf;
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop_mf.AddDomainIntegrator(mf_nonlinear_qf,
+                                 tuple{ Value<U>{}, Gradient<U>{},
+                                        Gradient<Coords>{}, Weight{} },
+                                 tuple{ Gradient<U>{} }, *ir,
+                                 all_domain_attr, derivatives);
+      dop_mf.SetParameters({ nodes });
+
+      // Check (Y, dR/du X) = ((dR/du)^T Y, X) for random X and Y
+      Vector W(pfes.GetTrueVSize());
+      Y.Randomize(2);
+      W.Randomize(3);
+      auto dRdU = dop_mf.GetDerivative(U, {&x}, {nodes});
+      dRdU->Mult(W, Z);
+      const real_t ytjw = InnerProduct(pmesh.GetComm(), Y, Z);
+
+      dRdU->MultTranspose(Y, Z);
+      REQUIRE(InnerProduct(pmesh.GetComm(), Z, W) == MFEM_Approx(ytjw));
+
+      dop_mf.MultTransposeDerivative(U, {&x}, {nodes}, Y, Z);
+      REQUIRE(InnerProduct(pmesh.GetComm(), Z, W) == MFEM_Approx(ytjw));
+
+      // The Jacobian is not symmetric: (W, dR/du Y) differs
+      dRdU->Mult(Y, Z);
+      REQUIRE(InnerProduct(pmesh.GetComm(), W, Z) != MFEM_Approx(ytjw));
+      MPI_Barrier(MPI_COMM_WORLD);
+   }
+
+   SECTION("action linearized transpose parameter")
+   {
+      DOperator dop_mf(sol, {{Rho, &rho_ps}, {Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFApplyRho mf_apply_rho_qf;
+      auto derivatives = std::integer_sequence<size_t, Rho> {};
+      dop_mf.AddDomainIntegrator(mf_apply_rho_qf,
+                                 tuple{ Gradient<U>{}, Identity<Rho>{},
+                                        Gradient<Coords>{}, Weight{} },
+                                 tuple{ Gradient<U>{} }, *ir,
+                                 all_domain_attr, derivatives);
+      dop_mf.SetParameters({ &rho_coeff_cv, nodes });
+
+      // Check (Y, dR/drho D) = ((dR/drho)^T Y, D) for random Y and D
+      Vector D(rho_ps.GetTrueVSize()), G(rho_ps.GetTrueVSize());
+      Y.Randomize(2);
+      D.Randomize(3);
+      auto dRdRho = dop_mf.GetDerivative(Rho, {&x}, {&rho_coeff_cv, nodes});
+      dRdRho->Mult(D, Z);
+      const real_t ytjd = InnerProduct(pmesh.GetComm(), Y, Z);
+
+      dRdRho->MultTranspose(Y, G);
+      REQUIRE(InnerProduct(pmesh.GetComm(), G, D) == MFEM_Approx(ytjd));
+
+      dop_mf.MultTransposeDerivative(Rho, {&x}, {&rho_coeff_cv, nodes}, Y, G);
+      REQUIRE(InnerProduct(pmesh.GetComm(), G, D) == MFEM_Approx(ytjd));
+      MPI_Barrier(MPI_COMM_WORLD);
+   }
+
+   SECTION("gradient of a scalar quantity of interest")
+   {
+      DOperator dop_qoi(sol, {{Rho, &rho_ps}, {Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFEnergy mf_energy_qf;
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop_qoi.AddDomainIntegrator(mf_energy_qf,
+                                  tuple{ Value<U>{}, Identity<Rho>{},
+                                         Gradient<Coords>{}, Weight{} },
+                                  tuple{ Sum<U>{} }, *ir,
+                                  all_domain_attr, derivatives);
+      dop_qoi.SetParameters({ &rho_coeff_cv, nodes });
+
+      ParBilinearForm mass(&pfes);
+      mass.AddDomainIntegrator(new MassIntegrator(rho_coeff, ir));
+      mass.SetAssemblyLevel(AssemblyLevel::FULL);
+      mass.Assemble();
+      mass.Finalize();
+      mass.Mult(x, y);
+      pfes.GetProlongationMatrix()->MultTranspose(y, Y);
+
+      // The gradient of the quantity of interest is M_rho u
+      Vector one(1);
+      one = 1.0;
+      dop_qoi.MultTransposeDerivative(U, {&x}, {&rho_coeff_cv, nodes}, one, Z);
+      Z -= Y;
+      real_t norm_global = 0.0, norm_local = Z.Normlinf();
+      MPI_Allreduce(&norm_local, &norm_global, 1, MPI_DOUBLE, MPI_MAX,
+                    pmesh.GetComm());
+      REQUIRE(norm_global == MFEM_Approx(0.0));
+      MPI_Barrier(MPI_COMM_WORLD);
+   }
+
    SECTION("action vector")
    {
       ParFiniteElementSpace vpfes(&pmesh, &fec, DIM);
@@ -298,6 +464,48 @@ void diffusion(const char *filename, int p)
       TestSameMatrices(*A, blf_fa.SpMat());
       delete A;
    }
+
+   SECTION("spmat colored")
+   {
+      DOperator dop_mf(sol, {{Rho, &rho_ps}, {Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFApply mf_apply_qf;
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop_mf.AddDomainIntegrator(mf_apply_qf,
+                                 tuple{ Gradient<U>{}, Identity<Rho>{},
+                                        Gradient<Coords>{}, Weight{} },
+                                 tuple{ Gradient<U>{} }, *ir,
+                                 all_domain_attr, derivatives);
+      dop_mf.SetParameters({ &rho_coeff_cv, nodes });
+      auto dRdU = dop_mf.GetDerivative(U, {&x}, {&rho_coeff_cv, nodes});
+
+      SparseMatrix *A = nullptr;
+      dRdU->AssembleColored(A);
+      TestSameMatrices(*A, blf_fa.SpMat());
+      REQUIRE(dRdU->GetNumColors() <= A->Width());
+      delete A;
+   }
+
+   SECTION("hypre parallel mat colored")
+   {
+      DOperator dop_mf(sol, {{Rho, &rho_ps}, {Coords, mfes}}, pmesh);
+      typename Diffusion<DIM>::MFApply mf_apply_qf;
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop_mf.AddDomainIntegrator(mf_apply_qf,
+                                 tuple{ Gradient<U>{}, Identity<Rho>{},
+                                        Gradient<Coords>{}, Weight{} },
+                                 tuple{ Gradient<U>{} }, *ir,
+                                 all_domain_attr, derivatives);
+      dop_mf.SetParameters({ &rho_coeff_cv, nodes });
+      auto dRdU = dop_mf.GetDerivative(U, {&x}, {&rho_coeff_cv, nodes});
+
+      // Square operator: uses the trial_fes == test_fes branch
+      HypreParMatrix *Afa = blf_fa.ParallelAssemble();
+      HypreParMatrix *A = nullptr;
+      dRdU->AssembleColored(A);
+      TestSameMatrices(*A, *Afa);
+      delete Afa;
+      delete A;
+   }
 }
 
 TEST_CASE("dFEM Diffusion", "[Parallel][dFEM][GPU]")
@@ -91,6 +91,54 @@ void mass_action(const char *filename, int p)
       MPI_Barrier(MPI_COMM_WORLD);
    }
 
+   SECTION("domain colored")
+   {
+      const auto *ir = &IntRules.Get(pmesh.GetTypicalElementGeometry(), 2 * p);
+
+      Array<int> all_domain_attr;
+      if (pmesh.attributes.Size() > 0)
+      {
+         all_domain_attr.SetSize(pmesh.attributes.Max());
+         all_domain_attr = 1;
+      }
+
+      ParBilinearForm blf(&fes);
+      blf.AddDomainIntegrator(new MassIntegrator(one, ir));
+      blf.SetAssemblyLevel(AssemblyLevel::FULL);
+      blf.Assemble();
+      blf.Finalize();
+
+      static constexpr int U = 0, Coords = 1;
+      const auto sol = std::vector{ FieldDescriptor{ U, &fes } };
+      DifferentiableOperator dop(sol, {{Coords, nodes->ParFESpace()}}, pmesh);
+      const auto mf_mass_qf =
+         [] MFEM_HOST_DEVICE(const dscalar_t &u,
+                             const tensor<real_t, DIM, DIM> &J, const real_t &w)
+      { return tuple{u * w * det(J)}; };
+      auto derivatives = std::integer_sequence<size_t, U> {};
+      dop.AddDomainIntegrator(mf_mass_qf,
+                              tuple{ Value<U>{}, Gradient<Coords>{}, Weight{} },
+                              tuple{ Value<U>{} },
+                              *ir, all_domain_attr, derivatives);
+      dop.SetParameters({ nodes });
+      auto ddopdu = dop.GetDerivative(U, {&x}, {nodes});
+
+      SparseMatrix *A = nullptr;
+      ddopdu->AssembleColored(A);
+      TestSameMatrices(*A, blf.SpMat());
+      REQUIRE(ddopdu->GetNumColors() <= A->Width());
+      delete A;
+
+      // Square operator: uses the trial_fes == test_fes branch
+      HypreParMatrix *Amfem = blf.ParallelAssemble();
+      HypreParMatrix *Adfem = nullptr;
+      ddopdu->AssembleColored(Adfem);
+      TestSameMatrices(*Adfem, *Amfem);
+      delete Amfem;
+      delete Adfem;
+      MPI_Barrier(MPI_COMM_WORLD);
+   }
+
    // Test boundary
    // This ensures that we're not trying to test on fully periodic meshes
    if (!((std::string("../../data/periodic-square.mesh").compare(filename) == 0) ||
@@ -234,6 +282,50 @@ template <int DIM> void mass_mat_mixed(const char* filename, int p)
       delete Amfem;
       delete Adfem;
    }
+
+   SECTION("mult transpose")
+   {
+      HypreParMatrix *Amfem = blf.ParallelAssemble();
+
+      Vector X(fes0.GetTrueVSize()), Y(fes1.GetTrueVSize()),
+             Z(fes1.GetTrueVSize());
+      X.Randomize(1);
+      Amfem->MultTranspose(X, Y);
+
+      real_t norm_g, norm_l;
+      ddopdu->MultTranspose(X, Z);
+      Z -= Y;
+      norm_l = Z.Normlinf();
+      MPI_Allreduce(&norm_l, &norm_g, 1, MPI_DOUBLE, MPI_MAX, pmesh.GetComm());
+      REQUIRE(norm_g == MFEM_Approx(0.0));
+
+      dop.MultTransposeDerivative(U, {&ugf}, {&pgf, nodes}, X, Z);
+      Z -= Y;
+      norm_l = Z.Normlinf();
+      MPI_Allreduce(&norm_l, &norm_g, 1, MPI_DOUBLE, MPI_MAX, pmesh.GetComm());
+      REQUIRE(norm_g == MFEM_Approx(0.0));
+      delete Amfem;
+   }
+
+   SECTION("spmat colored")
+   {
+      SparseMatrix *A;
+      ddopdu->AssembleColored(A);
+      TestSameMatrices(*A, blf.SpMat());
+      REQUIRE(ddopdu->GetNumColors() <= A->Width());
+      delete A;
+   }
+
+   SECTION("hypre parallel mat colored")
+   {
+      HypreParMatrix *Amfem = blf.ParallelAssemble();
+
+      HypreParMatrix *Adfem;
+      ddopdu->AssembleColored(Adfem);
+      TestSameMatrices(*Adfem, *Amfem);
+      delete Amfem;
+      delete Adfem;
+   }
 }
 
 // no GPU tag to avoid failing 'hypre parallel mat' section
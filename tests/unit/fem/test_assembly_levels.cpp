@@ -391,6 +391,84 @@ TEST_CASE("NormalTraceJumpIntegrator Element Assembly", "[AssemblyLevel][GPU]")
    }
 }
 
+TEST_CASE("TraceJumpIntegrator Element Assembly", "[AssemblyLevel][GPU]")
+{
+   const auto fname = GENERATE(
+                         "../../data/inline-quad.mesh",
+                         "../../data/star-q3.mesh",
+                         "../../data/inline-hex.mesh",
+                         "../../data/fichera-q3.mesh"
+                      );
+   const int order = GENERATE(1, 2, 3);
+   const bool l2_test = GENERATE(false, true);
+
+   CAPTURE(fname, order, l2_test);
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (l2_test)
+   {
+      fec.reset(new L2_FECollection(order, dim, BasisType::GaussLobatto));
+   }
+   else
+   {
+      fec.reset(new H1_FECollection(order, dim));
+   }
+   FiniteElementSpace fes(&mesh, fec.get());
+
+   DG_Interface_FECollection hfec(order - 1, dim);
+   FiniteElementSpace hfes(&mesh, &hfec);
+
+   TraceJumpIntegrator integ;
+
+   const int nf = mesh.GetNFbyType(FaceType::Interior);
+   const int ndof_trial = hfes.GetFaceElement(0)->GetDof();
+   const int ndof_test = fes.GetFE(0)->GetDof();
+   Vector emat(ndof_trial*ndof_test*2*nf);
+   integ.AssembleEAInteriorFaces(hfes, fes, emat, false);
+
+   const TensorBasisElement *tbe =
+      dynamic_cast<const TensorBasisElement*>(fes.GetFE(0));
+   MFEM_VERIFY(tbe, "");
+   const Array<int> &dof_map = tbe->GetDofMap();
+
+   const auto e_mat = Reshape(emat.HostRead(), ndof_test, ndof_trial, 2, nf);
+
+   int fidx = 0;
+   for (int f = 0; f < mesh.GetNumFaces(); ++f)
+   {
+      const Mesh::FaceInformation info = mesh.GetFaceInformation(f);
+      if (!info.IsInterior()) { continue; }
+
+      const int el1 = info.element[0].index;
+      const int el2 = info.element[1].index;
+
+      FaceElementTransformations *FTr = mesh.GetInteriorFaceTransformations(f);
+
+      DenseMatrix elmat;
+      integ.AssembleFaceMatrix(*hfes.GetFaceElement(f),
+                               *fes.GetFE(el1),
+                               *fes.GetFE(el2),
+                               *FTr, elmat);
+      for (int ie = 0; ie < 2; ++ie)
+      {
+         for (int i_lex = 0; i_lex < ndof_test; ++i_lex)
+         {
+            const int i = dof_map.Size() > 0 ? dof_map[i_lex] : i_lex;
+            for (int j = 0; j < ndof_trial; ++j)
+            {
+               elmat(i + ie*ndof_test, j) -= e_mat(i_lex, j, ie, fidx);
+            }
+         }
+      }
+      REQUIRE(elmat.MaxMaxNorm() == MFEM_Approx(0.0));
+
+      fidx++;
+   }
+}
+
 TEST_CASE("L2 Assembly Levels", "[AssemblyLevel], [PartialAssembly], [GPU]")
 {
    const bool dg = true;
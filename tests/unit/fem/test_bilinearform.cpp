@@ -168,6 +168,70 @@ TEST_CASE("GetElementMatrices", "[BilinearForm]")
    }
 }
 
+TEST_CASE("Threaded assembly", "[BilinearForm]")
+{
+   const auto dim = GENERATE(2, 3);
+   const auto type = GENERATE(0, 1, 2);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   CAPTURE(dim, type, ordering);
+
+   const Element::Type el_type = (dim == 2) ? Element::TRIANGLE :
+                                 Element::TETRAHEDRON;
+   Mesh mesh = (dim == 2) ? Mesh::MakeCartesian2D(3, 3, el_type) :
+               Mesh::MakeCartesian3D(2, 2, 2, el_type);
+
+   const int order = 2;
+   std::unique_ptr<FiniteElementCollection> fec;
+   int vdim = 1;
+   switch (type)
+   {
+      case 0: fec.reset(new H1_FECollection(order, dim)); vdim = dim; break;
+      case 1: fec.reset(new ND_FECollection(order, dim)); break;
+      case 2: fec.reset(new L2_FECollection(order, dim)); break;
+   }
+   FiniteElementSpace fes(&mesh, fec.get(), vdim, ordering);
+
+   ConstantCoefficient lambda(1.0), mu(2.0);
+   auto add_integrators = [&](BilinearForm &a)
+   {
+      switch (type)
+      {
+         case 0:
+            a.AddDomainIntegrator(new ElasticityIntegrator(lambda, mu));
+            a.AddDomainIntegrator(new VectorMassIntegrator);
+            a.AddBoundaryIntegrator(new VectorMassIntegrator);
+            break;
+         case 1:
+            a.AddDomainIntegrator(new CurlCurlIntegrator);
+            a.AddDomainIntegrator(new VectorFEMassIntegrator);
+            break;
+         case 2:
+            a.AddDomainIntegrator(new DiffusionIntegrator);
+            a.AddInteriorFaceIntegrator(
+               new DGDiffusionIntegrator(-1.0, 2.0*dim));
+            break;
+      }
+   };
+
+   BilinearForm a(&fes);
+   add_integrators(a);
+   a.Assemble();
+   a.Finalize();
+
+   BilinearForm a_thr(&fes);
+   a_thr.UseThreadedAssembly();
+   add_integrators(a_thr);
+   a_thr.Assemble();
+   a_thr.Finalize();
+
+   const SparseMatrix &A = a.SpMat();
+   const SparseMatrix &A_thr = a_thr.SpMat();
+
+   SparseMatrix *D = Add(1.0, A, -1.0, A_thr);
+   REQUIRE(D->MaxNorm() == MFEM_Approx(0.0, 1e-12*A.MaxNorm()));
+   delete D;
+}
+
 TEST_CASE("BilinearForm print", "[SparseMatrix][BilinearForm]")
 {
 
@@ -184,3 +248,125 @@ TEST_CASE("BilinearForm print", "[SparseMatrix][BilinearForm]")
    a.Print(ss);
    REQUIRE(ss.str().length() > 0);
 }
+
+TEST_CASE("BilinearForm memory report", "[BilinearForm][MemoryReport]")
+{
+   const int order = 3;
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   H1_FECollection fec(order, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Vector x(fes.GetVSize()), y(fes.GetVSize());
+   x.Randomize(1);
+
+   auto total = [](const MemoryReport &r)
+   { return r.HostBytes() + r.DeviceBytes(); };
+
+   std::size_t bytes[3];
+   const AssemblyLevel levels[3] = { AssemblyLevel::PARTIAL,
+                                     AssemblyLevel::ELEMENT,
+                                     AssemblyLevel::LEGACY
+                                   };
+   for (int i = 0; i < 3; i++)
+   {
+      BilinearForm a(&fes);
+      a.AddDomainIntegrator(new MassIntegrator);
+      a.SetAssemblyLevel(levels[i]);
+      a.Assemble();
+      if (levels[i] == AssemblyLevel::LEGACY) { a.Finalize(); }
+      a.Mult(x, y);
+
+      const MemoryReport report = a.GetMemoryReport();
+      REQUIRE(report.GetName() == "BilinearForm");
+      bytes[i] = total(report);
+      REQUIRE(bytes[i] > 0);
+      if (levels[i] == AssemblyLevel::LEGACY)
+      {
+         REQUIRE(bytes[i] >= total(a.SpMat().GetMemoryReport()));
+      }
+
+      std::stringstream ss;
+      report.Print(ss);
+      REQUIRE(ss.str().find("BilinearForm") != std::string::npos);
+   }
+   // The element matrices are larger than the quadrature point data
+   REQUIRE(bytes[1] > bytes[0]);
+
+   MemoryReport report("simulation");
+   report.AddChild(mesh.GetMemoryReport());
+   report.AddChild(fes.GetMemoryReport());
+   REQUIRE(report.GetChildren().size() == 2);
+   REQUIRE(report.HostBytes() ==
+           mesh.GetMemoryReport().HostBytes() + fes.GetMemoryReport().HostBytes());
+   REQUIRE(mesh.GetMemoryReport().HostBytes() >=
+           std::size_t(mesh.GetNV()*3*sizeof(real_t)));
+
+   // Empty reports are not added as children
+   report.AddChild(MemoryReport("empty"));
+   REQUIRE(report.GetChildren().size() == 2);
+   REQUIRE(MemoryReport::FormatBytes(512) == "512 B");
+   REQUIRE(MemoryReport::FormatBytes(1536) == "1.5 KiB");
+}
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("ParBilinearForm memory report", "[Parallel][MemoryReport]")
+{
+   const int order = 2;
+   Mesh smesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   ParMesh pmesh(MPI_COMM_WORLD, smesh);
+   smesh.Clear();
+   H1_FECollection fec(order, pmesh.Dimension());
+   ParFiniteElementSpace fes(&pmesh, &fec);
+
+   const MemoryReport mesh_report = pmesh.GetMemoryReport();
+   REQUIRE(mesh_report.GetName() == "ParMesh");
+   REQUIRE(mesh_report.GetChildren().size() > 0);
+   REQUIRE(mesh_report.GetChildren()[0].GetName() == "Mesh");
+   REQUIRE(mesh_report.HostBytes() >=
+           pmesh.Mesh::GetMemoryReport().HostBytes());
+
+   // The prolongation matrix is accounted for once it is built
+   const std::size_t fes_bytes = fes.GetMemoryReport().HostBytes();
+   REQUIRE(fes.GetMemoryReport().GetName() == "ParFiniteElementSpace");
+   fes.GetProlongationMatrix();
+   REQUIRE(fes.GetMemoryReport().HostBytes() > fes_bytes);
+
+   ParBilinearForm a(&fes);
+   a.AddDomainIntegrator(new MassIntegrator);
+   a.Assemble();
+   a.Finalize();
+
+   MemoryReport report("simulation");
+   report.AddChild(pmesh.GetMemoryReport());
+   report.AddChild(fes.GetMemoryReport());
+   report.AddChild(a.GetMemoryReport());
+   REQUIRE(report.GetChildren().size() == 3);
+
+   // The summary is printed on rank 0, with the sum of the totals over the
+   // ranks in the first row
+   std::stringstream ss;
+   report.PrintSummary(MPI_COMM_WORLD, ss);
+   unsigned long long host = report.HostBytes(), host_sum = 0;
+   MPI_Allreduce(&host, &host_sum, 1, MPI_UNSIGNED_LONG_LONG, MPI_SUM,
+                 MPI_COMM_WORLD);
+   if (Mpi::Root())
+   {
+      const std::string summary = ss.str();
+      REQUIRE(summary.find("Memory summary") != std::string::npos);
+      REQUIRE(summary.find("ParFiniteElementSpace") != std::string::npos);
+      std::istringstream lines(summary);
+      std::string header, first;
+      std::getline(lines, header);
+      std::getline(lines, first);
+      REQUIRE(first.find("simulation") == 0);
+      REQUIRE(first.find(MemoryReport::FormatBytes(host_sum)) !=
+              std::string::npos);
+   }
+   else
+   {
+      REQUIRE(ss.str().empty());
+   }
+}
+
+#endif // MFEM_USE_MPI
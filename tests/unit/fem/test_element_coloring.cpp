@@ -0,0 +1,107 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("Element coloring", "[FiniteElementSpace]")
+{
+   const auto el_type = GENERATE(Element::TRIANGLE, Element::QUADRILATERAL,
+                                 Element::TETRAHEDRON, Element::HEXAHEDRON);
+   const auto fe_type = GENERATE(0, 1);
+   CAPTURE(el_type, fe_type);
+
+   const bool is_3d = (el_type == Element::TETRAHEDRON ||
+                       el_type == Element::HEXAHEDRON);
+   Mesh mesh = is_3d ? Mesh::MakeCartesian3D(3, 2, 2, el_type) :
+               Mesh::MakeCartesian2D(4, 3, el_type);
+   const int dim = mesh.Dimension();
+
+   const int order = 2;
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (fe_type == 0) { fec.reset(new H1_FECollection(order, dim)); }
+   else { fec.reset(new ND_FECollection(order, dim)); }
+   FiniteElementSpace fes(&mesh, fec.get());
+
+   const Table &colors = fes.GetElementColoring();
+   const Table &elem_dof = fes.GetElementToDofTable();
+
+   // Every element has exactly one color
+   Array<int> elem_color(mesh.GetNE());
+   elem_color = -1;
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      REQUIRE(colors.RowSize(c) > 0);
+      for (int k = 0; k < colors.RowSize(c); k++)
+      {
+         const int e = colors.GetRow(c)[k];
+         REQUIRE(elem_color[e] == -1);
+         elem_color[e] = c;
+      }
+   }
+   REQUIRE(elem_color.Min() >= 0);
+
+   // Elements of the same color do not share dofs
+   Array<int> dof_marker(fes.GetNDofs());
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      dof_marker = 0;
+      for (int k = 0; k < colors.RowSize(c); k++)
+      {
+         const int e = colors.GetRow(c)[k];
+         for (int j = 0; j < elem_dof.RowSize(e); j++)
+         {
+            const int d = UnsignIndex(elem_dof.GetRow(e)[j]);
+            REQUIRE(dof_marker[d] == 0);
+            dof_marker[d] = 1;
+         }
+      }
+   }
+}
+
+TEST_CASE("ElementRestriction colored scatter", "[FiniteElementSpace]")
+{
+   const auto dim = GENERATE(2, 3);
+   const auto ordering = GENERATE(Ordering::byNODES, Ordering::byVDIM);
+   const auto e_ordering = GENERATE(ElementDofOrdering::NATIVE,
+                                    ElementDofOrdering::LEXICOGRAPHIC);
+   CAPTURE(dim, ordering);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(4, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 2, 2, Element::HEXAHEDRON);
+
+   H1_FECollection fec(3, dim);
+   FiniteElementSpace fes(&mesh, &fec, 2, ordering);
+
+   ElementRestriction R(fes, e_ordering), R_colored(fes, e_ordering);
+   R.UseColoredScatter(false);
+   R_colored.UseColoredScatter(true);
+
+   Vector x(R.Height());
+   x.Randomize(1);
+
+   Vector y(R.Width()), y_colored(R.Width());
+   R.MultTranspose(x, y);
+   y_colored = 1.0e10; // overwritten by MultTranspose()
+   R_colored.MultTranspose(x, y_colored);
+   y_colored -= y;
+   REQUIRE(y_colored.Normlinf() == MFEM_Approx(0.0));
+
+   y.Randomize(2);
+   y_colored = y;
+   R.AddMultTranspose(x, y);
+   R_colored.AddMultTranspose(x, y_colored);
+   y_colored -= y;
+   REQUIRE(y_colored.Normlinf() == MFEM_Approx(0.0));
+}
@@ -485,4 +485,229 @@ TEST_CASE("Hcurl/Hdiv diagonal PA",
    }  // dimension
 }
 
+// Compare the PA diagonal of A D A^T with the diagonal of the assembled B D B^T
+void CompareDiagonalADAt(FiniteElementSpace &trial_fes,
+                         FiniteElementSpace &test_fes,
+                         const std::function<BilinearFormIntegrator*()> &integ)
+{
+   MixedBilinearForm fa_form(&trial_fes, &test_fes);
+   fa_form.AddDomainIntegrator(integ());
+   fa_form.Assemble();
+   fa_form.Finalize();
+
+   // These integrators compute their PA diagonal by probing the operator
+   BilinearFormIntegrator *pa_integ = integ();
+   pa_integ->EnableDiagonalProbing();
+   MixedBilinearForm pa_form(&trial_fes, &test_fes);
+   pa_form.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   pa_form.AddDomainIntegrator(pa_integ);
+   pa_form.Assemble();
+
+   Vector D(trial_fes.GetTrueVSize());
+   D.Randomize(1);
+
+   Vector pa_diag(test_fes.GetTrueVSize());
+   pa_form.AssembleDiagonal_ADAt(D, pa_diag);
+
+   std::unique_ptr<SparseMatrix> Bt(Transpose(fa_form.SpMat()));
+   std::unique_ptr<SparseMatrix> BDBt(Mult_AtDA(*Bt, D));
+   Vector fa_diag;
+   BDBt->GetDiag(fa_diag);
+
+   fa_diag -= pa_diag;
+   REQUIRE(fa_diag.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("Mixed Diagonal ADAt PA", "[PartialAssembly][AssembleDiagonal]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   // The element-wise computation of diag(A D A^T) is exact when the test
+   // space is discontinuous or when the mesh has a single element.
+   const int ne = GENERATE(1, 3);
+   CAPTURE(dim, order, ne);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(ne, ne, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(ne, ne, ne, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(0)*x(1);
+      y(1) += 0.05*x(0)*x(0);
+   });
+
+   H1_FECollection h1_fec(order, dim);
+   L2_FECollection l2_fec(order - 1, dim);
+   ND_FECollection nd_fec(order, dim);
+   RT_FECollection rt_fec(order - 1, dim);
+   FiniteElementSpace h1_fes(&mesh, &h1_fec);
+   FiniteElementSpace h1v_fes(&mesh, &h1_fec, dim);
+   FiniteElementSpace l2_fes(&mesh, &l2_fec);
+   FiniteElementSpace l2v_fes(&mesh, &l2_fec, dim);
+   FiniteElementSpace nd_fes(&mesh, &nd_fec);
+   FiniteElementSpace rt_fes(&mesh, &rt_fec);
+
+   FunctionCoefficient q(coeffFunction);
+   VectorFunctionCoefficient vq(dim, vectorCoeffFunction);
+   // The PA VectorDivergenceIntegrator only supports constant coefficients
+   ConstantCoefficient cq(2.0);
+
+   CompareDiagonalADAt(h1_fes, l2v_fes, [&]()
+   { return new GradientIntegrator(q); });
+   CompareDiagonalADAt(h1v_fes, l2_fes, [&]()
+   { return new VectorDivergenceIntegrator(cq); });
+   CompareDiagonalADAt(h1_fes, l2_fes, [&]()
+   { return new MixedScalarMassIntegrator(q); });
+   CompareDiagonalADAt(h1_fes, l2_fes, [&]()
+   { return new MixedDirectionalDerivativeIntegrator(vq); });
+   if (dim == 2)
+   {
+      CompareDiagonalADAt(nd_fes, l2_fes, [&]()
+      { return new MixedScalarCurlIntegrator(q); });
+   }
+
+   if (ne > 1) { return; }
+
+   CompareDiagonalADAt(l2_fes, h1_fes, [&]()
+   { return new MixedScalarWeakDivergenceIntegrator(vq); });
+   CompareDiagonalADAt(h1_fes, h1_fes, [&]()
+   { return new MixedGradGradIntegrator(q); });
+   CompareDiagonalADAt(h1_fes, nd_fes, [&]()
+   { return new MixedVectorGradientIntegrator(q); });
+   CompareDiagonalADAt(nd_fes, rt_fes, [&]()
+   { return new VectorFEMassIntegrator(q); });
+   if (dim == 3)
+   {
+      CompareDiagonalADAt(nd_fes, nd_fes, [&]()
+      { return new MixedVectorCurlIntegrator(q); });
+      CompareDiagonalADAt(nd_fes, nd_fes, [&]()
+      { return new MixedVectorWeakCurlIntegrator(q); });
+   }
+}
+
+TEST_CASE("Convection and Elasticity Component Diagonal PA",
+          "[PartialAssembly][AssembleDiagonal]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   SECTION("Convection")
+   {
+      VectorFunctionCoefficient vel(dim, vectorCoeffFunction);
+      for (bool transpose : {false, true})
+      {
+         auto integ = [&]() -> BilinearFormIntegrator*
+         {
+            auto *conv = new ConvectionIntegrator(vel, -1.0);
+            if (transpose) { return new TransposeIntegrator(conv); }
+            return conv;
+         };
+         BilinearFormIntegrator *pa_integ = integ();
+         pa_integ->EnableDiagonalProbing();
+         BilinearForm pa_form(&fes);
+         pa_form.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+         pa_form.AddDomainIntegrator(pa_integ);
+         pa_form.Assemble();
+         Vector pa_diag(fes.GetVSize());
+         pa_form.AssembleDiagonal(pa_diag);
+
+         BilinearForm fa_form(&fes);
+         fa_form.AddDomainIntegrator(integ());
+         fa_form.Assemble();
+         fa_form.Finalize();
+         Vector fa_diag(fes.GetVSize());
+         fa_form.SpMat().GetDiag(fa_diag);
+
+         fa_diag -= pa_diag;
+         REQUIRE(fa_diag.Normlinf() == MFEM_Approx(0.0));
+      }
+   }
+
+   SECTION("Elasticity component")
+   {
+      FiniteElementSpace vfes(&mesh, &fec, dim);
+      ConstantCoefficient lambda(2.0);
+      FunctionCoefficient mu(coeffFunction);
+
+      BilinearForm fa_form(&vfes);
+      fa_form.AddDomainIntegrator(new ElasticityIntegrator(lambda, mu));
+      fa_form.Assemble();
+      fa_form.Finalize();
+      const SparseMatrix &A = fa_form.SpMat();
+
+      ElasticityIntegrator parent(lambda, mu);
+      parent.AssemblePA(vfes);
+      const int n = fes.GetVSize();
+      for (int i = 0; i < dim; i++)
+      {
+         for (int j = 0; j < dim; j++)
+         {
+            auto *pa_integ = new ElasticityComponentIntegrator(parent, i, j);
+            pa_integ->EnableDiagonalProbing();
+            BilinearForm pa_form(&fes);
+            pa_form.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+            pa_form.AddDomainIntegrator(pa_integ);
+            pa_form.Assemble();
+            Vector pa_diag(n);
+            pa_form.AssembleDiagonal(pa_diag);
+
+            for (int k = 0; k < n; k++)
+            {
+               REQUIRE(pa_diag(k) == MFEM_Approx(A(i*n + k, j*n + k)));
+            }
+         }
+      }
+   }
+}
+
+TEST_CASE("DG Face Diagonal PA", "[PartialAssembly][AssembleDiagonal]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2, 3);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+
+   L2_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   VectorFunctionCoefficient vel(dim, vectorCoeffFunction);
+   ConstantCoefficient one(1.0);
+
+   auto add_integrators = [&](BilinearForm &form)
+   {
+      form.AddDomainIntegrator(new MassIntegrator(one));
+      form.AddInteriorFaceIntegrator(new DGTraceIntegrator(vel, 1.0, -0.5));
+      form.AddBdrFaceIntegrator(new DGTraceIntegrator(vel, 1.0, -0.5));
+   };
+
+   BilinearForm pa_form(&fes);
+   pa_form.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   add_integrators(pa_form);
+   pa_form.Assemble();
+   Vector pa_diag(fes.GetVSize());
+   pa_form.AssembleDiagonal(pa_diag);
+
+   BilinearForm fa_form(&fes);
+   add_integrators(fa_form);
+   fa_form.Assemble();
+   fa_form.Finalize();
+   Vector fa_diag(fes.GetVSize());
+   fa_form.SpMat().GetDiag(fa_diag);
+
+   fa_diag -= pa_diag;
+   REQUIRE(fa_diag.Normlinf() == MFEM_Approx(0.0));
+}
+
 } // namespace assemblediagonalpa
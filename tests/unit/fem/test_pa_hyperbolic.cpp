@@ -0,0 +1,119 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace pa_hyperbolic
+{
+
+// Smooth, physically admissible state for all the tested flux functions
+void State(const Vector &x, Vector &u)
+{
+   const int dim = x.Size();
+   const real_t s = std::sin(M_PI*x(0))*std::cos(M_PI*x(dim-1));
+   u = 0.0;
+   u(0) = 1.5 + 0.5*s;
+   for (int d = 1; d < u.Size(); d++) { u(d) = 0.1*d*s + 0.05*x(0); }
+   if (u.Size() == dim + 2) { u(dim + 1) = 3.0 + 0.2*s; }
+}
+
+// Perturb the mesh so that the element Jacobians are not constant
+void Perturb(const Vector &x, Vector &y)
+{
+   y = x;
+   y(0) += 0.05*std::sin(2*M_PI*x(0))*std::sin(2*M_PI*x(1));
+   y(1) += 0.03*std::sin(2*M_PI*x(0))*x(1);
+}
+
+void TestPAHyperbolic(Mesh &mesh, FluxFunction &flux, bool upwind)
+{
+   const int dim = mesh.Dimension();
+   const int neq = flux.num_equations;
+   const int order = 2;
+   DG_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec, neq, Ordering::byNODES);
+
+   std::unique_ptr<NumericalFlux> numFlux;
+   if (upwind) { numFlux.reset(new ComponentwiseUpwindFlux(flux)); }
+   else { numFlux.reset(new RusanovFlux(flux)); }
+
+   HyperbolicFormIntegrator integ_fa(*numFlux, 1), integ_pa(*numFlux, 1);
+
+   NonlinearForm nlf_fa(&fes), nlf_pa(&fes);
+   nlf_fa.AddDomainIntegrator(&integ_fa);
+   nlf_fa.AddInteriorFaceIntegrator(&integ_fa);
+   nlf_fa.UseExternalIntegrators();
+   nlf_pa.AddDomainIntegrator(&integ_pa);
+   nlf_pa.AddInteriorFaceIntegrator(&integ_pa);
+   nlf_pa.UseExternalIntegrators();
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.Setup();
+
+   VectorFunctionCoefficient state_coeff(neq, State);
+   GridFunction u(&fes);
+   u.ProjectCoefficient(state_coeff);
+
+   Vector y_fa(fes.GetVSize()), y_pa(fes.GetVSize());
+   nlf_fa.Mult(u, y_fa);
+   nlf_pa.Mult(u, y_pa);
+
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10*y_fa.Normlinf()));
+   REQUIRE(integ_pa.GetMaxCharSpeed() ==
+           MFEM_Approx(integ_fa.GetMaxCharSpeed()));
+}
+
+} // namespace pa_hyperbolic
+
+TEST_CASE("PA Hyperbolic Form Integrator", "[PartialAssembly][NonlinearPA]")
+{
+   using namespace pa_hyperbolic;
+
+   const auto dim = GENERATE(2, 3);
+   const bool upwind = GENERATE(false, true);
+   CAPTURE(dim, upwind);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.EnsureNodes();
+   mesh.Transform(Perturb);
+
+   SECTION("Advection")
+   {
+      Vector b(dim);
+      b = 1.0; b(0) = -0.5;
+      VectorConstantCoefficient b_coeff(b);
+      AdvectionFlux flux(b_coeff);
+      TestPAHyperbolic(mesh, flux, upwind);
+   }
+   SECTION("Burgers")
+   {
+      BurgersFlux flux(dim);
+      TestPAHyperbolic(mesh, flux, upwind);
+   }
+   if (!upwind)
+   {
+      SECTION("Shallow water")
+      {
+         ShallowWaterFlux flux(dim);
+         TestPAHyperbolic(mesh, flux, upwind);
+      }
+      SECTION("Euler")
+      {
+         EulerFlux flux(dim, 1.4);
+         TestPAHyperbolic(mesh, flux, upwind);
+      }
+   }
+}
@@ -693,6 +693,55 @@ TEST_CASE("PA Diffusion", "[PartialAssembly], [GPU]")
    test_pa_integrator<DiffusionIntegrator>();
 } // PA Diffusion test case
 
+TEST_CASE("PA Element Ranges", "[PartialAssembly], [GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 3);
+   CAPTURE(dim, order);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(5, 4, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 2, Element::HEXAHEDRON);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+   const int ne = mesh.GetNE();
+   const int e_split = ne / 3;
+
+   const Operator *R = fes.GetElementRestriction(
+                          ElementDofOrdering::LEXICOGRAPHIC);
+   const auto *elem_restrict = dynamic_cast<const ElementRestriction*>(R);
+   REQUIRE(elem_restrict != nullptr);
+
+   GridFunction x(&fes);
+   x.Randomize(1);
+   Vector ex(R->Height()), ex_range(R->Height());
+   R->Mult(x, ex);
+   ex_range = 0.0;
+   elem_restrict->MultRange(x, ex_range, e_split, ne);
+   elem_restrict->MultRange(x, ex_range, 0, e_split);
+   ex_range -= ex;
+   REQUIRE(ex_range.Normlinf() == MFEM_Approx(0.0));
+
+   FunctionCoefficient coeff(f1);
+   MassIntegrator mass(coeff);
+   DiffusionIntegrator diffusion(coeff);
+   BilinearFormIntegrator *integs[] = {&mass, &diffusion};
+   for (BilinearFormIntegrator *integ : integs)
+   {
+      integ->AssemblePA(fes);
+      REQUIRE(integ->SupportsAddMultPARange());
+
+      Vector ey(ex.Size()), ey_range(ex.Size());
+      ey = 0.0;
+      ey_range = 0.0;
+      integ->AddMultPA(ex, ey);
+      integ->AddMultPARange(ex, ey_range, 0, e_split);
+      integ->AddMultPARange(ex, ey_range, e_split, ne);
+      ey_range -= ey;
+      REQUIRE(ey_range.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
 TEST_CASE("PA Markers", "[PartialAssembly], [GPU]")
 {
    const bool all_tests = launch_all_non_regression_tests;
@@ -924,6 +973,71 @@ TEST_CASE("PA DG Diffusion", "[PartialAssembly], [GPU]")
    test_dg_diffusion<SymmetricMatrixConstantCoefficient>(fes);
 }
 
+template <typename FES = FiniteElementSpace>
+void test_dg_elasticity(FES &fes, real_t alpha)
+{
+   using GF_t = typename ParTypeHelper<FES>::GF_t;
+   using BLF_t = typename ParTypeHelper<FES>::BLF_t;
+
+   GF_t x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+
+   ConstantCoefficient lambda(2.0);
+   FunctionCoefficient mu([](const Vector &p) { return 1.0 + p(0)*p(0); });
+   const real_t kappa = 10.0;
+
+   IntegrationRules irs(0, Quadrature1D::GaussLobatto);
+   const IntegrationRule &ir = irs.Get(fes.GetMesh()->GetTypicalFaceGeometry(),
+                                       2*fes.GetMaxElementOrder());
+
+   BLF_t blf_fa(&fes);
+   blf_fa.AddInteriorFaceIntegrator(
+      new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+   blf_fa.AddBdrFaceIntegrator(
+      new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+   (*blf_fa.GetFBFI())[0]->SetIntegrationRule(ir);
+   (*blf_fa.GetBFBFI())[0]->SetIntegrationRule(ir);
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   OperatorHandle A_fa;
+   Array<int> empty;
+   blf_fa.FormSystemMatrix(empty, A_fa);
+   A_fa->Mult(x, y_fa);
+
+   BLF_t blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.AddInteriorFaceIntegrator(
+      new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+   blf_pa.AddBdrFaceIntegrator(
+      new DGElasticityIntegrator(lambda, mu, alpha, kappa));
+   (*blf_pa.GetFBFI())[0]->SetIntegrationRule(ir);
+   (*blf_pa.GetBFBFI())[0]->SetIntegrationRule(ir);
+   blf_pa.Assemble();
+   blf_pa.Mult(x, y_pa);
+
+   y_fa -= y_pa;
+
+   REQUIRE(y_fa.Normlinf() == MFEM_Approx(0.0));
+}
+
+TEST_CASE("PA DG Elasticity", "[PartialAssembly], [GPU]")
+{
+   const auto mesh_fname = GENERATE_COPY(from_range(get_dg_test_meshes()));
+   const int order = GENERATE(1, 2);
+   const real_t alpha = GENERATE(-1.0, 0.0, 1.0);
+   CAPTURE(order, mesh_fname, alpha);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname.c_str());
+   const int dim = mesh.Dimension();
+
+   DG_FECollection fec(order, dim, BasisType::GaussLobatto);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+   FiniteElementSpace fes_vdim(&mesh, &fec, dim, Ordering::byVDIM);
+
+   test_dg_elasticity(fes, alpha);
+   test_dg_elasticity(fes_vdim, alpha);
+}
+
 #ifdef MFEM_USE_MPI
 
 TEST_CASE("Parallel PA DG Diffusion", "[PartialAssembly][Parallel][GPU]")
@@ -945,6 +1059,70 @@ TEST_CASE("Parallel PA DG Diffusion", "[PartialAssembly][Parallel][GPU]")
    test_dg_diffusion<MatrixConstantCoefficient>(fes);
 }
 
+TEST_CASE("Parallel PA DG Elasticity", "[PartialAssembly][Parallel][GPU]")
+{
+   const auto mesh_fname = GENERATE_COPY(from_range(get_dg_test_meshes()));
+   const int order = GENERATE(1, 2);
+   CAPTURE(order, mesh_fname);
+
+   Mesh serial_mesh = Mesh::LoadFromFile(mesh_fname.c_str());
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+
+   const int dim = mesh.Dimension();
+
+   DG_FECollection fec(order, dim, BasisType::GaussLobatto);
+   ParFiniteElementSpace fes(&mesh, &fec, dim);
+
+   test_dg_elasticity(fes, -1.0);
+}
+
+TEST_CASE("Parallel PA Overlapped Mult", "[PartialAssembly][Parallel][GPU]")
+{
+   const int order = GENERATE(1, 2);
+   const bool ess_bc = GENERATE(false, true);
+   CAPTURE(order, ess_bc);
+
+   Mesh serial_mesh = Mesh::MakeCartesian3D(8, 8, 8, Element::HEXAHEDRON);
+   ParMesh mesh(MPI_COMM_WORLD, serial_mesh);
+   serial_mesh.Clear();
+
+   H1_FECollection fec(order, mesh.Dimension());
+   ParFiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_tdof_list;
+   if (ess_bc) { fes.GetBoundaryTrueDofs(ess_tdof_list); }
+
+   // With PA, the system operator overlaps the exchange of the shared dofs with
+   // the action of the domain integrators on the interior elements
+   FunctionCoefficient coeff(f1);
+   ParBilinearForm blf_fa(&fes), blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.EnableCommunicationOverlap();
+   for (ParBilinearForm *blf : {&blf_fa, &blf_pa})
+   {
+      blf->AddDomainIntegrator(new DiffusionIntegrator(coeff));
+      blf->AddDomainIntegrator(new MassIntegrator(coeff));
+      blf->AddBoundaryIntegrator(new MassIntegrator(coeff));
+      blf->Assemble();
+   }
+   OperatorHandle A_fa, A_pa;
+   blf_fa.FormSystemMatrix(ess_tdof_list, A_fa);
+   blf_pa.FormSystemMatrix(ess_tdof_list, A_pa);
+
+   Vector x(fes.GetTrueVSize()), y_fa(x.Size()), y_pa(x.Size());
+   x.Randomize(1);
+   A_fa->Mult(x, y_fa);
+   A_pa->Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+
+   // repeated applications reuse the communication buffers
+   A_pa->Mult(x, y_pa);
+   A_pa->Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0));
+}
+
 #endif
 
 } // namespace pa_kernels
@@ -978,3 +1156,67 @@ TEST_CASE("Dispatch Map Specializations")
    REQUIRE_FALSE(QI::EvalKernels::GetDispatchTable().empty());
    REQUIRE_FALSE(QI::CollocatedGradKernels::GetDispatchTable().empty());
 }
+
+TEST_CASE("Kernel Autotuning", "[PartialAssembly]")
+{
+   const std::string cache_file = "mfem_kernel_tuning_test.txt";
+   const std::string old_cache_file = KernelAutotuner::GetCacheFile();
+   const bool old_enabled = KernelAutotuner::IsEnabled();
+   const int old_num_trials = KernelAutotuner::GetNumTrials();
+   std::remove(cache_file.c_str());
+
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   // D1D = Q1D = 3, for which a specialized kernel is registered
+   const IntegrationRule &ir = IntRules.Get(Geometry::SQUARE, 5);
+
+   BilinearForm a(&fes);
+   a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a.AddDomainIntegrator(new MassIntegrator(&ir));
+   a.Assemble();
+
+   GridFunction x(&fes), y(&fes), y_ref(&fes);
+   x.Randomize(1);
+   KernelAutotuner::Disable();
+   a.Mult(x, y_ref);
+
+   KernelAutotuner::SetCacheFile(cache_file);
+   KernelAutotuner::SetNumTrials(2);
+   KernelAutotuner::Enable();
+   // Every call, while tuning and after, gives the same result
+   for (int i = 0; i < 8; i++)
+   {
+      a.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   // The choice was written to the cache file ...
+   std::ifstream in(cache_file);
+   REQUIRE(in.good());
+   std::string line, kernel, params, variant;
+   while (std::getline(in, line))
+   {
+      if (line.find("ApplyPAKernels") == std::string::npos) { continue; }
+      std::istringstream fields(line);
+      std::string cpu;
+      std::getline(fields, cpu, '\t');
+      std::getline(fields, kernel, '\t');
+      std::getline(fields, params, '\t');
+      std::getline(fields, variant, '\t');
+   }
+   REQUIRE(params == "2,3,3");
+   REQUIRE((variant == "fallback" || variant == "2,3,3"));
+
+   // ... and is found when the cache file is read again
+   KernelAutotuner::SetCacheFile(cache_file);
+   std::string cached;
+   REQUIRE(KernelAutotuner::Lookup(kernel, params, cached));
+   REQUIRE(cached == variant);
+
+   KernelAutotuner::SetCacheFile(old_cache_file);
+   KernelAutotuner::SetNumTrials(old_num_trials);
+   KernelAutotuner::Enable(old_enabled);
+   std::remove(cache_file.c_str());
+}
@@ -0,0 +1,167 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace pa_mixed
+{
+
+Mesh MakeDistortedMesh(int dim)
+{
+   Mesh mesh;
+   if (dim == 1) { mesh = Mesh::MakeCartesian1D(5); }
+   else if (dim == 2)
+   {
+      mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+   }
+   else
+   {
+      mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   }
+   mesh.EnsureNodes();
+   // Curve the mesh so that the Jacobians vary inside the elements
+   mesh.SetCurvature(2);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(0)*x(0);
+      if (x.Size() > 1) { y(1) += 0.2*x(0) + 0.05*sin(M_PI*x(0)); }
+      if (x.Size() > 2) { y(2) += 0.1*x(1)*x(0); }
+   });
+   return mesh;
+}
+
+void CompareMixedPA(FiniteElementSpace &trial_fes,
+                    FiniteElementSpace &test_fes,
+                    const std::function<BilinearFormIntegrator*()> &integ)
+{
+   MixedBilinearForm blf_fa(&trial_fes, &test_fes);
+   blf_fa.AddDomainIntegrator(integ());
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+
+   MixedBilinearForm blf_pa(&trial_fes, &test_fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_pa.AddDomainIntegrator(integ());
+   blf_pa.Assemble();
+
+   Vector x(trial_fes.GetVSize()), y_fa(test_fes.GetVSize()),
+          y_pa(test_fes.GetVSize());
+   x.Randomize(1);
+   blf_fa.Mult(x, y_fa);
+   blf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+
+   Vector xt(test_fes.GetVSize()), yt_fa(trial_fes.GetVSize()),
+          yt_pa(trial_fes.GetVSize());
+   xt.Randomize(2);
+   blf_fa.MultTranspose(xt, yt_fa);
+   blf_pa.MultTranspose(xt, yt_pa);
+   yt_pa -= yt_fa;
+   REQUIRE(yt_pa.Normlinf() == MFEM_Approx(0.0, 1e-10, 1e-10));
+}
+
+} // namespace pa_mixed
+
+TEST_CASE("PA Mixed Scalar Integrators", "[PartialAssembly]")
+{
+   using namespace pa_mixed;
+
+   const int dim = GENERATE(1, 2, 3);
+   const int order = GENERATE(1, 2, 3);
+   const bool l2_test = GENERATE(false, true);
+   CAPTURE(dim, order, l2_test);
+
+   Mesh mesh = MakeDistortedMesh(dim);
+
+   H1_FECollection trial_fec(order, dim);
+   std::unique_ptr<FiniteElementCollection> test_fec;
+   if (l2_test)
+   {
+      test_fec.reset(new L2_FECollection(order-1, dim));
+   }
+   else
+   {
+      test_fec.reset(new H1_FECollection(order, dim));
+   }
+   FiniteElementSpace trial_fes(&mesh, &trial_fec);
+   FiniteElementSpace test_fes(&mesh, test_fec.get());
+   // H1 test space of the same order as the trial space
+   FiniteElementSpace h1_fes(&mesh, &trial_fec);
+
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0); });
+   VectorFunctionCoefficient vq(dim, [](const Vector &x, Vector &v)
+   {
+      for (int d = 0; d < v.Size(); d++) { v(d) = 1.0 + (d+1)*x(0) - x(d); }
+   });
+   MatrixFunctionCoefficient mq(dim, [](const Vector &x, DenseMatrix &m)
+   {
+      for (int j = 0; j < m.Width(); j++)
+      {
+         for (int i = 0; i < m.Height(); i++)
+         {
+            m(i,j) = (i == j) ? 2.0 + x(0) : 0.1*(i + 2*j)*x(i);
+         }
+      }
+   });
+
+   SECTION("MixedScalarMassIntegrator")
+   {
+      CompareMixedPA(trial_fes, test_fes, [&]()
+      { return new MixedScalarMassIntegrator(q); });
+      CompareMixedPA(test_fes, trial_fes, [&]()
+      { return new MixedScalarMassIntegrator(); });
+   }
+
+   SECTION("MixedDirectionalDerivativeIntegrator")
+   {
+      if (dim == 1)
+      {
+         CompareMixedPA(trial_fes, test_fes, [&]()
+         { return new MixedScalarDerivativeIntegrator(q); });
+      }
+      else
+      {
+         CompareMixedPA(trial_fes, test_fes, [&]()
+         { return new MixedDirectionalDerivativeIntegrator(vq); });
+      }
+   }
+
+   SECTION("MixedScalarWeakDivergenceIntegrator")
+   {
+      if (dim == 1)
+      {
+         CompareMixedPA(test_fes, trial_fes, [&]()
+         { return new MixedScalarWeakDerivativeIntegrator(q); });
+      }
+      else
+      {
+         CompareMixedPA(test_fes, trial_fes, [&]()
+         { return new MixedScalarWeakDivergenceIntegrator(vq); });
+      }
+   }
+
+   SECTION("MixedGradGradIntegrator")
+   {
+      H1_FECollection fec2(order+1, dim);
+      FiniteElementSpace fes2(&mesh, &fec2);
+      CompareMixedPA(h1_fes, fes2, [&]()
+      { return new MixedGradGradIntegrator(q); });
+      CompareMixedPA(fes2, h1_fes, [&]()
+      { return new MixedGradGradIntegrator(vq); });
+      CompareMixedPA(h1_fes, fes2, [&]()
+      { return new MixedGradGradIntegrator(mq); });
+   }
+}
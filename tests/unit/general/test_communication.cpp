@@ -0,0 +1,67 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("GroupCommunicator Modes", "[Parallel], [GroupCommunicator]")
+{
+   const auto mode = GENERATE(GroupCommunicator::byGroup,
+                              GroupCommunicator::byNeighborPersistent,
+                              GroupCommunicator::byNeighborCollective);
+   CAPTURE(mode);
+
+   Mesh mesh = Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+   mesh.Clear();
+   H1_FECollection fec(2, 3);
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+   const int n = pfes.GetNDofs();
+
+   std::unique_ptr<GroupCommunicator> ref(pfes.ScalarGroupComm());
+   std::unique_ptr<GroupCommunicator> gc(pfes.ScalarGroupComm());
+   REQUIRE(ref->GetMode() == GroupCommunicator::byNeighbor);
+   gc->SetMode(mode);
+
+   // Repeat the operations, to reuse the persistent requests
+   for (int it = 0; it < 2; it++)
+   {
+      Array<real_t> x_ref(n), x(n);
+      Array<int> i_ref(n), i(n);
+      for (int j = 0; j < n; j++)
+      {
+         x_ref[j] = x[j] = Mpi::WorldRank() + 0.25*j + it;
+         i_ref[j] = i[j] = 7*Mpi::WorldRank() + j;
+      }
+
+      ref->Reduce<real_t>(x_ref, GroupCommunicator::Sum);
+      gc->Reduce<real_t>(x, GroupCommunicator::Sum);
+      ref->Bcast(x_ref);
+      gc->Bcast(x);
+
+      ref->Reduce<int>(i_ref, GroupCommunicator::Max);
+      gc->Reduce<int>(i, GroupCommunicator::Max);
+      ref->Bcast(i_ref);
+      gc->Bcast(i);
+
+      for (int j = 0; j < n; j++)
+      {
+         REQUIRE(x[j] == MFEM_Approx(x_ref[j]));
+         REQUIRE(i[j] == i_ref[j]);
+      }
+   }
+}
+
+#endif // MFEM_USE_MPI
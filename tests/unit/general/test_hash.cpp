@@ -0,0 +1,103 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+struct Item2 : public Hashed2 { };
+struct Item4 : public Hashed4 { };
+
+} // anonymous namespace
+
+TEST_CASE("ConcurrentHashTable", "[General][HashTable]")
+{
+   // small blocks and bins, to grow the block list and rehash several times
+   const int block_size = 16, hash_size = 4;
+   const int n = 100;
+
+   SECTION("Serial")
+   {
+      HashTable<Item2> ref(block_size, hash_size);
+      ConcurrentHashTable<Item2> table(block_size, hash_size);
+      for (int i = 0; i < n; i++)
+      {
+         for (int j = i; j < n; j += 7)
+         {
+            REQUIRE(table.GetId(i, j) == ref.GetId(i, j));
+         }
+      }
+      REQUIRE(table.Size() == ref.Size());
+      for (int i = 0; i < n; i++)
+      {
+         for (int j = 0; j < n; j++)
+         {
+            REQUIRE(table.FindId(j, i) == ref.FindId(i, j));
+         }
+      }
+      REQUIRE(table.Find(n, n+1) == nullptr);
+   }
+
+   SECTION("Concurrent")
+   {
+      const int num_threads = 4;
+      ConcurrentHashTable<Item4> table(block_size, hash_size, 4);
+
+      // all threads insert the same keys, in different orders
+      std::vector<std::vector<int>> ids(num_threads);
+      std::atomic<int> errors(0);
+      std::vector<std::thread> threads;
+      for (int t = 0; t < num_threads; t++)
+      {
+         threads.emplace_back([&, t]()
+         {
+            for (int k = 0; k < n*n; k++)
+            {
+               const int kk = (t % 2) ? n*n-1-k : k, i = kk / n, j = kk % n;
+               ids[t].push_back(table.GetId(i, j, i+j));
+               if (table.Find(j, i+j, i)->p1 != std::min(i, j)) { errors++; }
+            }
+         });
+      }
+      for (std::thread &th : threads) { th.join(); }
+      REQUIRE(errors == 0);
+
+      // each key was inserted once, and all threads got the same ids
+      REQUIRE(table.Size() == (n*(n+1))/2);
+      std::vector<int> key_ids(n*n);
+      for (int t = 0; t < num_threads; t++)
+      {
+         REQUIRE(int(ids[t].size()) == n*n);
+         for (int k = 0; k < n*n; k++)
+         {
+            const int kk = (t % 2) ? n*n-1-k : k, i = kk / n, j = kk % n;
+            if (t == 0) { key_ids[i*n + j] = ids[t][k]; }
+            else { REQUIRE(ids[t][k] == key_ids[i*n + j]); }
+         }
+      }
+      for (int i = 0; i < n; i++)
+      {
+         for (int j = 0; j < n; j++)
+         {
+            REQUIRE(key_ids[i*n + j] == key_ids[j*n + i]);
+            REQUIRE(table.FindId(i+j, j, i) == key_ids[i*n + j]);
+         }
+      }
+   }
+}
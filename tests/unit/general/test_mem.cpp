@@ -67,3 +67,55 @@ TEST_CASE("MemoryManager/Scopes",
       REQUIRE((x_data == x.HostRead()));
    }
 }
+
+TEST_CASE("MemoryManager/HostPool", "[MemoryManager]")
+{
+   MemoryManager::ReleaseHostPool();
+   const HostPoolStatistics stats0 = MemoryManager::GetHostPoolStatistics();
+   REQUIRE(stats0.num_allocs == 0);
+   REQUIRE(stats0.bytes_cached == 0);
+
+   const int n = 1000;
+   const real_t *data = nullptr;
+   for (int i = 0; i < 4; i++)
+   {
+      Vector x(n, MemoryType::HOST_POOL);
+      REQUIRE(x.GetMemory().GetMemoryType() == MemoryType::HOST_POOL);
+      REQUIRE(reinterpret_cast<uintptr_t>(x.GetData()) % 64 == 0);
+      x = real_t(i);
+      REQUIRE(x.Sum() == MFEM_Approx(real_t(i*n)));
+      // The released block is reused by the next vector of the same size
+      if (i > 0) { REQUIRE(x.GetData() == data); }
+      data = x.GetData();
+   }
+
+   const HostPoolStatistics stats = MemoryManager::GetHostPoolStatistics();
+   REQUIRE(stats.num_allocs - stats0.num_allocs == 4);
+   REQUIRE(stats.num_hits - stats0.num_hits == 3);
+   REQUIRE(stats.HitRate() == MFEM_Approx(0.75));
+   REQUIRE(stats.bytes_in_use == stats0.bytes_in_use);
+   REQUIRE(stats.peak_bytes >= n*sizeof(real_t));
+   REQUIRE(stats.bytes_cached >= n*sizeof(real_t));
+
+   MemoryManager::ReleaseHostPool();
+   REQUIRE(MemoryManager::GetHostPoolStatistics().bytes_cached == 0);
+
+   // A power-of-two request fills its size class exactly
+   {
+      const size_t bytes0 = MemoryManager::GetHostPoolStatistics().bytes_in_use;
+      Vector x(512, MemoryType::HOST_POOL);
+      REQUIRE(MemoryManager::GetHostPoolStatistics().bytes_in_use - bytes0 ==
+              512*sizeof(real_t));
+   }
+
+   // Released blocks exceeding the cache limit are freed
+   MemoryManager::SetHostPoolCacheLimit(1024*sizeof(real_t));
+   {
+      Vector x(512, MemoryType::HOST_POOL), y(512, MemoryType::HOST_POOL),
+             z(512, MemoryType::HOST_POOL);
+   }
+   REQUIRE(MemoryManager::GetHostPoolStatistics().bytes_cached ==
+           1024*sizeof(real_t));
+   MemoryManager::SetHostPoolCacheLimit(size_t(1) << 30);
+   MemoryManager::ReleaseHostPool();
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+using namespace mfem;
+
+#include "unit_tests.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+TEST_CASE("RegionTimer", "[General][RegionTimer]")
+{
+   const bool was_enabled = RegionTimer::IsEnabled();
+   RegionTimer::Reset();
+
+   SECTION("Disabled")
+   {
+      RegionTimer::Disable();
+      {
+         RegionTimerScope scope("test::disabled");
+      }
+      REQUIRE(RegionTimer::GetCount("test::disabled") == 0);
+   }
+
+   SECTION("Nested regions")
+   {
+      RegionTimer::Enable();
+      RegionTimer::EnableTrace();
+      for (int i = 0; i < 3; i++)
+      {
+         RegionTimerScope outer("test::outer");
+         for (int j = 0; j < 2; j++)
+         {
+            RegionTimer::Begin("test::inner");
+            RegionTimer::End("test::inner");
+         }
+      }
+      RegionTimer::Disable();
+      RegionTimer::EnableTrace(false);
+
+      REQUIRE(RegionTimer::GetCount("test::outer") == 3);
+      REQUIRE(RegionTimer::GetCount("test::inner") == 6);
+      REQUIRE(RegionTimer::GetTime("test::outer") >=
+              RegionTimer::GetTime("test::inner"));
+
+      std::ostringstream json;
+      RegionTimer::PrintJSON(json);
+      const std::string s = json.str();
+      const size_t outer = s.find("\"name\": \"test::outer\"");
+      const size_t children = s.find("\"children\"");
+      const size_t inner = s.find("\"name\": \"test::inner\"");
+      REQUIRE(outer != std::string::npos);
+      REQUIRE(children > outer);
+      REQUIRE(inner > children);
+      REQUIRE(std::count(s.begin(), s.end(), '{') ==
+              std::count(s.begin(), s.end(), '}'));
+      REQUIRE(std::count(s.begin(), s.end(), '[') ==
+              std::count(s.begin(), s.end(), ']'));
+
+      std::ostringstream trace;
+      RegionTimer::PrintChromeTrace(trace);
+      const std::string t = trace.str();
+      int num_events = 0;
+      for (size_t pos = t.find("\"ph\": \"X\""); pos != std::string::npos;
+           pos = t.find("\"ph\": \"X\"", pos + 1)) { num_events++; }
+      REQUIRE(num_events == 9);
+
+      std::ostringstream text;
+      RegionTimer::Print(text);
+      REQUIRE(text.str().find("  test::inner") != std::string::npos);
+
+      RegionTimer::Reset();
+      REQUIRE(RegionTimer::GetCount("test::outer") == 0);
+   }
+
+#ifndef MFEM_USE_CALIPER
+   SECTION("Instrumented library calls")
+   {
+      Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+      H1_FECollection fec(2, mesh.Dimension());
+      FiniteElementSpace fes(&mesh, &fec);
+      BilinearForm a(&fes);
+      a.AddDomainIntegrator(new MassIntegrator);
+      a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      a.Assemble();
+
+      Vector b(fes.GetVSize()), x(fes.GetVSize());
+      b.Randomize(1);
+      x = 0.0;
+      CGSolver cg;
+      cg.SetOperator(a);
+      cg.SetMaxIter(5);
+      cg.SetRelTol(0.0);
+
+      RegionTimer::Enable();
+      cg.Mult(b, x);
+      RegionTimer::Disable();
+
+      REQUIRE(RegionTimer::GetCount("CGSolver::Mult") == 1);
+      REQUIRE(RegionTimer::GetCount("CGSolver::Iteration") >= 5);
+      REQUIRE(RegionTimer::GetCount("ElementRestriction::Mult") > 0);
+      RegionTimer::Reset();
+   }
+#endif
+
+   RegionTimer::Enable(was_enabled);
+}
@@ -0,0 +1,186 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+namespace krylov_solvers
+{
+
+// Assemble the matrix and the right-hand side of a Poisson problem
+void MakePoissonSystem(Mesh &mesh, int order, SparseMatrix &A, Vector &B)
+{
+   H1_FECollection fec(order, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list;
+   fes.GetBoundaryTrueDofs(ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   Vector X, B_ref;
+   SparseMatrix A_ref;
+   a.FormLinearSystem(ess_tdof_list, x, b, A_ref, X, B_ref);
+   // A_ref and B_ref reference the data of the forms, which go out of scope
+   A = A_ref;
+   B = B_ref;
+}
+
+} // namespace krylov_solvers
+
+TEST_CASE("PipelinedCGSolver", "[IterativeSolvers]")
+{
+   using namespace krylov_solvers;
+
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   SparseMatrix A;
+   Vector B;
+   MakePoissonSystem(mesh, 3, A, B);
+   DSmoother jacobi(A);
+
+   const real_t rtol = 1e-10;
+   CGSolver cg;
+   PipelinedCGSolver pcg;
+   for (IterativeSolver *solver : {(IterativeSolver*)&cg,
+                                   (IterativeSolver*)&pcg})
+   {
+      solver->SetRelTol(rtol);
+      solver->SetAbsTol(0.0);
+      solver->SetMaxIter(500);
+      solver->SetOperator(A);
+      if (use_prec) { solver->SetPreconditioner(jacobi); }
+   }
+
+   Vector X_cg(B.Size()), X_pcg(B.Size());
+   X_cg = 0.0;
+   X_pcg = 0.0;
+   cg.Mult(B, X_cg);
+   pcg.Mult(B, X_pcg);
+
+   REQUIRE(cg.GetConverged());
+   REQUIRE(pcg.GetConverged());
+   REQUIRE(std::abs(pcg.GetNumIterations() - cg.GetNumIterations()) <= 2);
+   REQUIRE(pcg.GetInitialNorm() == MFEM_Approx(cg.GetInitialNorm()));
+
+   // Check the true residual of the pipelined solution
+   Vector R(B.Size());
+   A.Mult(X_pcg, R);
+   R -= B;
+   REQUIRE(R.Norml2() <= 1e-6*B.Norml2());
+
+   X_pcg -= X_cg;
+   REQUIRE(X_pcg.Normlinf() <= 1e-6*X_cg.Normlinf());
+}
+
+TEST_CASE("SStepGMRESSolver", "[IterativeSolvers]")
+{
+   using namespace krylov_solvers;
+
+   const bool use_prec = GENERATE(false, true);
+   const int s = GENERATE(1, 3, 5);
+   const int kdim = GENERATE(12, 50);
+   CAPTURE(use_prec, s, kdim);
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   SparseMatrix A;
+   Vector B;
+   MakePoissonSystem(mesh, 2, A, B);
+   DSmoother jacobi(A);
+
+   const real_t rtol = 1e-8;
+   GMRESSolver gmres;
+   SStepGMRESSolver sgmres;
+   gmres.SetKDim(kdim);
+   sgmres.SetKDim(kdim);
+   sgmres.SetStepSize(s);
+   for (IterativeSolver *solver : {(IterativeSolver*)&gmres,
+                                   (IterativeSolver*)&sgmres})
+   {
+      solver->SetRelTol(rtol);
+      solver->SetAbsTol(0.0);
+      solver->SetMaxIter(1000);
+      solver->SetOperator(A);
+      if (use_prec) { solver->SetPreconditioner(jacobi); }
+   }
+
+   Vector X_gmres(B.Size()), X_sgmres(B.Size());
+   X_gmres = 0.0;
+   X_sgmres = 0.0;
+   gmres.Mult(B, X_gmres);
+   sgmres.Mult(B, X_sgmres);
+
+   REQUIRE(gmres.GetConverged());
+   REQUIRE(sgmres.GetConverged());
+   REQUIRE(sgmres.GetInitialNorm() == MFEM_Approx(gmres.GetInitialNorm()));
+   REQUIRE(sgmres.GetNumIterations() <= gmres.GetNumIterations() + 5 + s);
+
+   X_sgmres -= X_gmres;
+   REQUIRE(X_sgmres.Normlinf() <= 1e-5*X_gmres.Normlinf());
+}
+
+TEST_CASE("SStepGMRESSolver reductions", "[IterativeSolvers]")
+{
+   using namespace krylov_solvers;
+
+   const int s = GENERATE(2, 4);
+   const int kdim = 48;
+   CAPTURE(s);
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   SparseMatrix A;
+   Vector B;
+   MakePoissonSystem(mesh, 2, A, B);
+
+   SStepGMRESSolver sgmres;
+   sgmres.SetKDim(kdim);
+   sgmres.SetStepSize(s);
+   sgmres.SetRelTol(1e-8);
+   sgmres.SetAbsTol(0.0);
+   sgmres.SetMaxIter(1000);
+   sgmres.SetOperator(A);
+
+   // Count the global reductions of the block orthogonalization
+   const bool was_enabled = RegionTimer::IsEnabled();
+   RegionTimer::Reset();
+   RegionTimer::Enable();
+   Vector X(B.Size());
+   X = 0.0;
+   sgmres.Mult(B, X);
+   RegionTimer::Enable(was_enabled);
+   const long num_reductions =
+      RegionTimer::GetCount("SStepGMRESSolver::BlockDot");
+   RegionTimer::Reset();
+
+   REQUIRE(sgmres.GetConverged());
+   const int iters = sgmres.GetNumIterations();
+   // kdim is a multiple of s, so the restarts do not add partial blocks
+   const int num_blocks = (iters + s - 1)/s;
+   CAPTURE(iters, num_blocks, num_reductions);
+   // One reduction per block, plus one for the blocks that are
+   // reorthogonalized; GMRESSolver uses (at least) one per iteration.
+   REQUIRE(num_reductions >= num_blocks);
+   REQUIRE(num_reductions <= 2*num_blocks);
+   REQUIRE(num_reductions < iters);
+}
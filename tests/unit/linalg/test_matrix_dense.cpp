@@ -362,6 +362,7 @@ TEST_CASE("Batched Linear Algebra",
           "[DenseMatrix][GPU]")
 {
    auto backend = GENERATE(BatchedLinAlg::NATIVE,
+                           BatchedLinAlg::SIMD,
                            BatchedLinAlg::GPU_BLAS,
                            BatchedLinAlg::MAGMA);
    // Skip unavailable backends
@@ -369,7 +370,9 @@ TEST_CASE("Batched Linear Algebra",
    CAPTURE(backend);
 
    const int n = 3;
-   const int n_mat = 4;
+   // (a batch size that is not a multiple of the SIMD width is also tested)
+   const int n_mat = GENERATE(4, 11);
+   CAPTURE(n_mat);
    const int n_rhs = 2;
 
    DenseTensor A_batch(n, n, n_mat);
@@ -494,6 +497,84 @@ TEST_CASE("Batched Linear Algebra",
    }
 }
 
+TEST_CASE("Batched Linear Algebra pivoting", "[DenseMatrix]")
+{
+   // Matrices that are not diagonally dominant, so that the matrices of a batch
+   // use different pivots
+   const int n = 5;
+   const int n_mat = GENERATE(1, 13);
+   CAPTURE(n_mat);
+
+   DenseTensor A(n, n, n_mat);
+   Vector A_vec(A.Data(), A.TotalSize());
+   A_vec.Randomize(3);
+   A_vec -= 0.5;
+
+   const BatchedLinAlgBase &native = BatchedLinAlg::Get(BatchedLinAlg::NATIVE);
+   const BatchedLinAlgBase &simd = BatchedLinAlg::Get(BatchedLinAlg::SIMD);
+
+   DenseTensor LU_native = A, LU_simd = A;
+   Array<int> P_native, P_simd;
+   native.LUFactor(LU_native, P_native);
+   simd.LUFactor(LU_simd, P_simd);
+   LU_native.HostRead();
+   LU_simd.HostRead();
+   P_native.HostRead();
+   P_simd.HostRead();
+   for (int i = 0; i < P_native.Size(); i++)
+   {
+      REQUIRE(P_simd[i] == P_native[i]);
+   }
+   for (int i = 0; i < A.TotalSize(); i++)
+   {
+      REQUIRE(LU_simd.Data()[i] == MFEM_Approx(LU_native.Data()[i]));
+   }
+
+   Vector x_native(n*2*n_mat), x_simd;
+   x_native.Randomize(4);
+   x_simd = x_native;
+   native.LUSolve(LU_native, P_native, x_native);
+   simd.LUSolve(LU_simd, P_simd, x_simd);
+   x_native.HostRead();
+   x_simd.HostRead();
+   for (int i = 0; i < x_native.Size(); i++)
+   {
+      REQUIRE(x_simd[i] == MFEM_Approx(x_native[i]));
+   }
+
+   DenseTensor A_inv = A;
+   simd.Invert(A_inv);
+   A_inv.HostRead();
+   for (int e = 0; e < n_mat; e++)
+   {
+      DenseMatrix I(n);
+      Mult(A(e), A_inv(e), I);
+      for (int i = 0; i < n; i++) { I(i, i) -= 1.0; }
+      REQUIRE(I.MaxMaxNorm() == MFEM_Approx(0.0));
+   }
+
+   // products with one and two right-hand sides, which the SIMD backend
+   // computes matrix by matrix and interleaved, respectively
+   for (int n_rhs = 1; n_rhs <= 2; n_rhs++)
+   {
+      for (BatchedLinAlg::Op op : {BatchedLinAlg::N, BatchedLinAlg::T})
+      {
+         Vector b(n*n_rhs*n_mat), y_native(n*n_rhs*n_mat), y_simd;
+         b.Randomize(5);
+         y_native.Randomize(6);
+         y_simd = y_native;
+         native.AddMult(A, b, y_native, 2.0, 0.5, op);
+         simd.AddMult(A, b, y_simd, 2.0, 0.5, op);
+         y_native.HostRead();
+         y_simd.HostRead();
+         for (int i = 0; i < y_native.Size(); i++)
+         {
+            REQUIRE(y_simd[i] == MFEM_Approx(y_native[i]));
+         }
+      }
+   }
+}
+
 TEST_CASE("DenseTensor copy", "[DenseMatrix][DenseTensor]")
 {
    DenseTensor t1(2,3,4);
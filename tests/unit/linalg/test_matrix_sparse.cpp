@@ -290,4 +290,51 @@ TEST_CASE("SparseMatrix cuSPARSE Bug", "[SparseMatrix][GPU]")
    REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("SellCSparseMatrix", "[SparseMatrix]")
+{
+   const auto C = GENERATE(1, 4, 8, 16);
+   const auto sigma = GENERATE(1, 32, 1000);
+   CAPTURE(C, sigma);
+
+   // Rectangular matrix with variable row lengths, some rows are empty
+   const int m = 101, n = 73;
+   SparseMatrix A(m, n);
+   for (int i = 0; i < m; i++)
+   {
+      if (i % 10 == 3) { continue; }
+      for (int j = (5*i) % n; j < n; j += 1 + (i % 7))
+      {
+         A.Set(i, j, 1.0 + i - 0.5*j);
+      }
+   }
+   A.Finalize();
+
+   SellCSparseMatrix S(A, C, sigma);
+   REQUIRE(S.Height() == m);
+   REQUIRE(S.Width() == n);
+   REQUIRE(S.NumNonZeroElems() == A.NumNonZeroElems());
+   REQUIRE(S.NumStoredElems() >= A.NumNonZeroElems());
+
+   Vector x(n), y(m), y_sellc(m);
+   x.Randomize(1);
+   A.Mult(x, y);
+   S.Mult(x, y_sellc);
+   y_sellc -= y;
+   REQUIRE(y_sellc.Normlinf() == MFEM_Approx(0.0));
+
+   y.Randomize(2);
+   y_sellc = y;
+   A.AddMult(x, y, -2.0);
+   S.AddMult(x, y_sellc, -2.0);
+   y_sellc -= y;
+   REQUIRE(y_sellc.Normlinf() == MFEM_Approx(0.0));
+
+   Vector z(n), z_sellc(n);
+   y.Randomize(3);
+   A.MultTranspose(y, z);
+   S.MultTranspose(y, z_sellc);
+   z_sellc -= z;
+   REQUIRE(z_sellc.Normlinf() == MFEM_Approx(0.0));
+}
+
 } // namespace mfem
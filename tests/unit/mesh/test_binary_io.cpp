@@ -0,0 +1,141 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+#include <cstdio>
+#include <sstream>
+
+using namespace mfem;
+
+namespace
+{
+
+std::string PrintToString(const Mesh &mesh)
+{
+   std::ostringstream os;
+   os.precision(16);
+   mesh.Print(os);
+   return os.str();
+}
+
+// Save the mesh in binary format and compare its text output with the ones of
+// the meshes loaded through the mapping and through the stream reader.
+void TestBinaryRoundTrip(const Mesh &mesh)
+{
+   const std::string fname = "binary_io_test.mesh";
+   mesh.SaveBinary(fname);
+
+   const std::string expected = PrintToString(mesh);
+
+   Mesh mapped = Mesh::LoadFromBinaryFile(fname);
+   REQUIRE(mapped.GetNE() == mesh.GetNE());
+   REQUIRE(mapped.GetNBE() == mesh.GetNBE());
+   REQUIRE(mapped.GetNV() == mesh.GetNV());
+   REQUIRE(PrintToString(mapped) == expected);
+
+   Mesh streamed(fname);
+   REQUIRE(PrintToString(streamed) == expected);
+
+   REQUIRE(std::remove(fname.c_str()) == 0);
+}
+
+} // anonymous namespace
+
+TEST_CASE("Binary mesh I/O", "[Mesh][BinaryIO]")
+{
+   SECTION("Conforming 2D")
+   {
+      Mesh mesh = Mesh::MakeCartesian2D(3, 4, Element::TRIANGLE);
+      TestBinaryRoundTrip(mesh);
+   }
+
+   SECTION("Conforming 3D")
+   {
+      Mesh mesh = Mesh::MakeCartesian3D(2, 3, 2, Element::HEXAHEDRON);
+      TestBinaryRoundTrip(mesh);
+   }
+
+   SECTION("Curved")
+   {
+      Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+      mesh.SetCurvature(2, false, 2, Ordering::byVDIM);
+      TestBinaryRoundTrip(mesh);
+   }
+
+   SECTION("Nonconforming 2D")
+   {
+      Mesh mesh = Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL);
+      mesh.EnsureNCMesh();
+      mesh.GeneralRefinement(Array<int> {0, 4});
+      mesh.GeneralRefinement(Array<int> {1});
+      TestBinaryRoundTrip(mesh);
+   }
+
+   SECTION("Nonconforming 3D curved")
+   {
+      Mesh mesh = Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+      mesh.EnsureNCMesh();
+      mesh.GeneralRefinement(Array<int> {0, 5});
+      mesh.SetCurvature(2);
+      TestBinaryRoundTrip(mesh);
+   }
+}
+
+TEST_CASE("Binary GridFunction I/O", "[GridFunction][BinaryIO]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL);
+   const int dim = mesh.Dimension();
+
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+   GridFunction gf(&fes);
+   VectorFunctionCoefficient coeff(dim, [](const Vector &x, Vector &y)
+   {
+      y(0) = x(0)*x(1);
+      y(1) = x(0) - x(1)*x(1);
+   });
+   gf.ProjectCoefficient(coeff);
+
+   QuadratureSpace qspace(&mesh, 3);
+   QuadratureFunction qf(qspace, 2);
+   qf.Randomize(1);
+
+   gf.SaveBinary("binary_io_test.gf");
+   qf.SaveBinary("binary_io_test.qf");
+
+   {
+      BinarySectionReader input("binary_io_test.gf");
+#ifndef _WIN32
+      REQUIRE(input.IsMapped());
+#endif
+      GridFunction gf_in(&mesh, input);
+      REQUIRE(!gf_in.OwnsData());
+      REQUIRE(gf_in.FESpace()->GetVDim() == dim);
+      REQUIRE(gf_in.FESpace()->GetOrdering() == fes.GetOrdering());
+      gf_in -= gf;
+      REQUIRE(gf_in.Normlinf() == 0.0);
+   }
+
+   {
+      BinarySectionReader input("binary_io_test.qf");
+      QuadratureFunction qf_in(&mesh, input);
+      REQUIRE(!qf_in.OwnsData());
+      REQUIRE(qf_in.GetVDim() == 2);
+      REQUIRE(qf_in.GetSpace()->GetSize() == qspace.GetSize());
+      qf_in -= qf;
+      REQUIRE(qf_in.Normlinf() == 0.0);
+   }
+
+   REQUIRE(std::remove("binary_io_test.gf") == 0);
+   REQUIRE(std::remove("binary_io_test.qf") == 0);
+}
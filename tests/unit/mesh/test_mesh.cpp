@@ -197,6 +197,76 @@ TEST_CASE("Hilbert reordering boundary element consistency", "[Mesh]")
    }
 }
 
+TEST_CASE("Space-filling curve partitioning", "[Mesh]")
+{
+   Mesh mesh = Mesh::MakeCartesian3D(5, 4, 3, Element::HEXAHEDRON);
+   const int ne = mesh.GetNE(), nparts = 7;
+
+   // Hilbert (6) and Morton (7) partitionings have parts of equal size
+   for (int part_method : {6, 7})
+   {
+      std::unique_ptr<int[]> partitioning(
+         mesh.GeneratePartitioning(nparts, part_method));
+      Array<int> sizes(nparts);
+      sizes = 0;
+      for (int i = 0; i < ne; i++)
+      {
+         REQUIRE(partitioning[i] >= 0);
+         REQUIRE(partitioning[i] < nparts);
+         sizes[partitioning[i]]++;
+      }
+      REQUIRE(sizes.Min() == ne/nparts);
+      REQUIRE(sizes.Max() <= ne/nparts + 1);
+   }
+
+   Array<int> ordering;
+   mesh.GetMortonElementOrdering(ordering);
+   REQUIRE(ordering.Size() == ne);
+   ordering.Sort();
+   for (int i = 0; i < ne; i++) { REQUIRE(ordering[i] == i); }
+}
+
+TEST_CASE("Space-filling curve reordering of elements and dofs",
+          "[Mesh][FiniteElementSpace]")
+{
+   Mesh mesh = Mesh::MakeCartesian3D(3, 4, 2, Element::HEXAHEDRON);
+   Array<int> ordering;
+   mesh.GetHilbertElementOrdering(ordering);
+   mesh.ReorderElements(ordering);
+
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+   Array<int> ess_bdr(mesh.bdr_attributes.Max()), ess_dofs, ess_dofs_reordered;
+   ess_bdr = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_dofs);
+
+   fes.ReorderElementToDofTable();
+
+   // the dofs of the boundary elements are dofs of their adjacent elements
+   Array<int> bdr_dofs, el_dofs;
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      int el, info;
+      mesh.GetBdrElementAdjacentElement(i, el, info);
+      fes.GetBdrElementDofs(i, bdr_dofs);
+      fes.GetElementDofs(el, el_dofs);
+      for (int dof : bdr_dofs) { REQUIRE(el_dofs.Find(dof) >= 0); }
+   }
+   fes.GetEssentialTrueDofs(ess_bdr, ess_dofs_reordered);
+   REQUIRE(ess_dofs_reordered.Size() == ess_dofs.Size());
+
+   // the dofs are numbered in element order
+   fes.GetElementDofs(0, el_dofs);
+   el_dofs.Sort();
+   for (int i = 0; i < el_dofs.Size(); i++) { REQUIRE(el_dofs[i] == i); }
+
+   // a quadratic function is represented exactly
+   FunctionCoefficient coeff([](const Vector &x) { return x(0)*x(1) + x(2); });
+   GridFunction gf(&fes);
+   gf.ProjectCoefficient(coeff);
+   REQUIRE(gf.ComputeL2Error(coeff) == MFEM_Approx(0.0));
+}
+
 TEST_CASE("MakeSimplicial", "[Mesh]")
 {
    auto mesh_fname = GENERATE("../../data/star.mesh",
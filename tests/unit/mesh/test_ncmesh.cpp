@@ -182,6 +182,113 @@ TEST_CASE("NCMesh 3D Derefined Volume", "[NCMesh]")
    REQUIRE(derefined_volume == MFEM_Approx(original_volume));
 } // test case
 
+// Test case: Verify that the geometric factors updated incrementally after a
+//            nonconforming refinement match newly computed ones, and that they
+//            are used correctly by the partial assembly of a mass matrix.
+TEST_CASE("NCMesh incremental geometric factors", "[NCMesh]")
+{
+   const int dim = GENERATE(2, 3);
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(4, 4, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   mesh.SetCurvature(2);
+   mesh.EnsureNCMesh();
+
+   const IntegrationRule &ir =
+      IntRules.Get(mesh.GetTypicalElementGeometry(), 5);
+   const int flags = GeometricFactors::COORDINATES |
+                     GeometricFactors::JACOBIANS |
+                     GeometricFactors::DETERMINANTS;
+   const GeometricFactors *geom = mesh.GetGeometricFactors(ir, flags);
+
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   for (int it = 0; it < 2; it++)
+   {
+      mesh.GeneralRefinement(Array<int> {0, mesh.GetNE()/2});
+      fes.Update();
+
+      // the cached factors are updated in place
+      REQUIRE(mesh.GetGeometricFactors(ir, flags) == geom);
+      GeometricFactors fresh(&mesh, ir, flags);
+      REQUIRE(geom->X.Size() == fresh.X.Size());
+      REQUIRE(geom->J.Size() == fresh.J.Size());
+      REQUIRE(geom->detJ.Size() == fresh.detJ.Size());
+
+      Vector diff(geom->X);
+      diff -= fresh.X;
+      REQUIRE(diff.Normlinf() < EPS);
+      diff = geom->J;
+      diff -= fresh.J;
+      REQUIRE(diff.Normlinf() < EPS);
+      diff = geom->detJ;
+      diff -= fresh.detJ;
+      REQUIRE(diff.Normlinf() < EPS);
+   }
+
+   BilinearForm a_pa(&fes), a_fa(&fes);
+   a_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   a_pa.AddDomainIntegrator(new MassIntegrator(&ir));
+   a_fa.AddDomainIntegrator(new MassIntegrator(&ir));
+   a_pa.Assemble();
+   a_fa.Assemble();
+   a_fa.Finalize();
+
+   Vector x(fes.GetVSize()), y_pa(fes.GetVSize()), y_fa(fes.GetVSize());
+   x.Randomize(1);
+   a_pa.Mult(x, y_pa);
+   a_fa.Mult(x, y_fa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() < EPS);
+} // test case
+
+// Test case: Verify the consistency of the face and edge lists of nonconforming
+//            meshes of different element types: no face or edge appears
+//            twice, the master ranges and the slave point matrices are valid.
+//            (note: with the OpenMP backend the lists are built by several
+//            threads; the slaves whose master is not a face/edge of a leaf
+//            element are not listed)
+TEST_CASE("NCMesh face and edge lists", "[NCMesh]")
+{
+   auto check_list = [](const NCMesh::NCList &list, int num_entities)
+   {
+      Array<int> count(num_entities);
+      count = 0;
+      for (const NCMesh::MeshId &id : list.conforming) { count[id.index]++; }
+      for (const NCMesh::Master &master : list.masters)
+      {
+         count[master.index]++;
+         REQUIRE(master.slaves_begin < master.slaves_end);
+         REQUIRE(master.slaves_end <= list.slaves.Size());
+         for (int i = master.slaves_begin; i < master.slaves_end; i++)
+         {
+            REQUIRE(list.slaves[i].master == master.index);
+         }
+      }
+      for (const NCMesh::Slave &slave : list.slaves)
+      {
+         REQUIRE(slave.master >= 0);
+         REQUIRE(int(slave.matrix) <
+                 list.point_matrices[slave.Geom()].Size());
+         if (slave.index >= 0) { count[slave.index]++; }
+      }
+      for (int i = 0; i < num_entities; i++) { REQUIRE(count[i] <= 1); }
+   };
+
+   const auto type = GENERATE(Element::HEXAHEDRON, Element::WEDGE,
+                              Element::TETRAHEDRON);
+   Mesh mesh = Mesh::MakeCartesian3D(3, 3, 3, type);
+   mesh.EnsureNCMesh(true);
+   for (int it = 0; it < 3; it++)
+   {
+      mesh.RandomRefinement(0.3, type != Element::TETRAHEDRON);
+   }
+
+   check_list(mesh.ncmesh->GetFaceList(), mesh.GetNumFaces());
+   check_list(mesh.ncmesh->GetEdgeList(), mesh.GetNEdges());
+} // test case
+
 
 #ifdef MFEM_USE_MPI
 
@@ -223,6 +223,66 @@ TEST_CASE("ParMeshMakeSimplicial", "[Parallel], [ParMesh]")
    REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("ParMeshRestart", "[Parallel], [ParMesh]")
+{
+   // Save a mesh and a grid function on all ranks and load them on about half
+   // of the ranks: the global sizes and the error of the grid function must be
+   // the same.
+   const int dim = GENERATE(2, 3);
+   const bool curved = GENERATE(false, true);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(4, 5, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(3, 3, 2, Element::HEXAHEDRON);
+   if (curved) { mesh.SetCurvature(2); }
+   ParMesh pmesh(MPI_COMM_WORLD, mesh);
+
+   FunctionCoefficient coeff([](const Vector &x)
+   {
+      return sin(x(0)) + x(1)*x(1);
+   });
+   H1_FECollection fec(3, dim);
+   ParFiniteElementSpace pfes(&pmesh, &fec);
+   ParGridFunction gf(&pfes);
+   gf.ProjectCoefficient(coeff);
+
+   const HYPRE_BigInt true_size = pfes.GlobalTrueVSize();
+   const real_t error = gf.ComputeL2Error(coeff);
+
+   pmesh.SaveRestart("restart_test_mesh");
+   gf.SaveRestart("restart_test_gf");
+
+   int nranks, myid;
+   MPI_Comm_size(MPI_COMM_WORLD, &nranks);
+   MPI_Comm_rank(MPI_COMM_WORLD, &myid);
+   const int new_nranks = std::max(1, nranks/2);
+   MPI_Comm comm;
+   MPI_Comm_split(MPI_COMM_WORLD, (myid < new_nranks) ? 0 : MPI_UNDEFINED,
+                  myid, &comm);
+
+   if (comm != MPI_COMM_NULL)
+   {
+      ParMesh new_pmesh = ParMesh::LoadRestart(comm, "restart_test_mesh");
+      REQUIRE(new_pmesh.GetGlobalNE() == mesh.GetNE());
+      REQUIRE((new_pmesh.GetNodes() != NULL) == curved);
+
+      auto new_gf = ParGridFunction::LoadRestart(&new_pmesh, "restart_test_gf");
+      REQUIRE(new_gf->ParFESpace()->GlobalTrueVSize() == true_size);
+      REQUIRE(new_gf->ComputeL2Error(coeff) == MFEM_Approx(error));
+
+      MPI_Comm_free(&comm);
+   }
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   const char *names[] = {"restart_test_mesh", "restart_test_gf",
+                          "restart_test_mesh_nodes"
+                         };
+   for (const std::string name : names)
+   {
+      std::remove(MakeParFilename(name + ".", myid).c_str());
+   }
+}
+
 #endif // MFEM_USE_MPI
 
 } // namespace mfem
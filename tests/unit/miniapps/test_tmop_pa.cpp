@@ -262,13 +262,17 @@ int tmop(int id, Req &res, int argc, char *argv[])
       case 77:  metric.reset(new TMOP_Metric_077); break;
       case 80:  metric.reset(new TMOP_Metric_080(0.5)); break; // combo
       case 94:  metric.reset(new TMOP_Metric_094); break;      // combo
+      case 301: metric.reset(new TMOP_Metric_301); break;
       case 302: metric.reset(new TMOP_Metric_302); break;
       case 303: metric.reset(new TMOP_Metric_303); break;
       case 315: metric.reset(new TMOP_Metric_315); break;
+      case 316: metric.reset(new TMOP_Metric_316); break;
       case 318: metric.reset(new TMOP_Metric_318); break;
       case 321: metric.reset(new TMOP_Metric_321); break;
+      case 328: metric.reset(new TMOP_Metric_328); break;      // combo
       case 332: metric.reset(new TMOP_Metric_332(0.5)); break; // combo
       case 338: metric.reset(new TMOP_Metric_338); break;      // combo
+      case 360: metric.reset(new TMOP_Metric_360); break;
       default:
       {
          cout << "Unknown metric_id: " << metric_id << endl;
@@ -1242,7 +1246,17 @@ static void tmop_tests(int id = 0, bool all = false)
           .QOR({ 4, 2 })
           .NEWTON_RTOLERANCE(1e-12)
           .TID({ 5 })
-          .MID({ 315, 318, 332, 338 }))
+          .MID({ 315, 316, 318, 332, 338 }))
+   .Run(id, all);
+
+   Launch(Launch::Args("Cube + Shape & shape+size metrics")
+          .MESH("../../miniapps/meshing/cube.mesh")
+          .REFINE(1)
+          .JI(jitter)
+          .POR({ 1, 2 })
+          .QOR({ 2, 4 })
+          .TID({ 2, 3 })
+          .MID({ 301, 328, 360 }))
    .Run(id, all);
 
    // Note: order 1 has no interior nodes, so all residuals are zero and the